@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/geometry/trig_buff.hpp>
 #include <ori/simcars/map/map_interface.hpp>
 #include <ori/simcars/map/lane_interface.hpp>
@@ -33,29 +34,30 @@ class BasicDrivingAgentController : public virtual IDrivingAgentController
     temporal::Duration time_step;
     size_t steering_lookahead_steps;
 
-public:
-    BasicDrivingAgentController(map::IMap<T_map_id> const *map, temporal::Duration time_step, size_t steering_lookahead_steps)
-        : trig_buff(geometry::TrigBuff::get_instance()), map(map), time_step(time_step),
-          steering_lookahead_steps(steering_lookahead_steps)
+    map::ILane<T_map_id> const* get_current_lane(geometry::Vec const &position) const
     {
-    }
+        // Reused across calls on the same thread, so looking up lanes does not allocate once it has grown to fit
+        static thread_local structures::stl::STLStackArray<map::ILane<T_map_id> const*> lanes;
 
-    void modify_state(agent::IReadOnlyEntityState const *original_state, agent::IEntityState *modified_state) const override
-    {
-        this->modify_driving_agent_state(
-                    dynamic_cast<IDrivingAgentState const*>(original_state),
-                    dynamic_cast<IDrivingAgentState*>(modified_state));
+        // TODO: Accomodate branching lanes
+        map->get_encapsulating_lanes(position, &lanes);
+
+        return lanes.count() > 0 ? lanes[0] : nullptr;
     }
 
-    void modify_driving_agent_state(agent::IReadOnlyDrivingAgentState const *original_state,
-                                    agent::IDrivingAgentState *modified_state) const override
+    // Returns false if no steer could be determined, in which case the original steer should be held, the current lane
+    // is null when the agent is not on a lane
+    bool calc_actuation(agent::IReadOnlyDrivingAgentState const *original_state,
+                        FP_DATA_TYPE aligned_linear_velocity,
+                        FP_DATA_TYPE aligned_linear_acceleration,
+                        geometry::Vec const &position, FP_DATA_TYPE rotation,
+                        map::ILane<T_map_id> const *current_lane,
+                        FP_DATA_TYPE &new_aligned_linear_acceleration,
+                        FP_DATA_TYPE &new_steer) const
     {
-        FP_DATA_TYPE aligned_linear_velocity = original_state->get_aligned_linear_velocity_variable()->get_value();
-
-        FP_DATA_TYPE new_aligned_linear_acceleration;
-
         IValuelessConstant const *aligned_linear_velocity_goal_valueless_variable =
-                original_state->get_parameter_value(original_state->get_name() + ".aligned_linear_velocity.goal");
+                original_state->get_parameter_value(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity_goal);
 
         if (aligned_linear_velocity_goal_valueless_variable == nullptr)
         {
@@ -71,148 +73,75 @@ public:
 
             FP_DATA_TYPE aligned_linear_velocity_error = aligned_linear_velocity_goal.get_goal_value() - aligned_linear_velocity;
             temporal::Duration time_diff = aligned_linear_velocity_goal.get_goal_time() - original_state->get_time();
-            new_aligned_linear_acceleration = aligned_linear_velocity_error / std::max(time_diff.count(), time_step.count());
+            new_aligned_linear_acceleration =
+                    aligned_linear_velocity_error / FP_DATA_TYPE(std::max(time_diff.count(), time_step.count()));
             new_aligned_linear_acceleration = std::min(new_aligned_linear_acceleration, MAX_ALIGNED_LINEAR_ACCELERATION);
             new_aligned_linear_acceleration = std::max(new_aligned_linear_acceleration, MIN_ALIGNED_LINEAR_ACCELERATION);
             assert(!std::isnan(new_aligned_linear_acceleration));
         }
 
-        IConstant<FP_DATA_TYPE> *new_aligned_linear_acceleration_variable =
-                    new BasicConstant(
-                        modified_state->get_name(),
-                        "aligned_linear_acceleration.indirect_actuation",
-                        new_aligned_linear_acceleration);
-        modified_state->set_aligned_linear_acceleration_variable(new_aligned_linear_acceleration_variable);
-
-
-
-        FP_DATA_TYPE aligned_linear_acceleration = original_state->get_aligned_linear_acceleration_variable()->get_value();
-
         FP_DATA_TYPE mean_aligned_linear_acceleration =
-                (0.5 * (aligned_linear_acceleration + new_aligned_linear_acceleration) / steering_lookahead_steps) +
+                (FP_DATA_TYPE(0.5) * (aligned_linear_acceleration + new_aligned_linear_acceleration) /
+                 steering_lookahead_steps) +
                 ((steering_lookahead_steps - 1) * new_aligned_linear_acceleration / steering_lookahead_steps);
 
-        FP_DATA_TYPE lookahead_distance_covered =
-                aligned_linear_velocity * (time_step * steering_lookahead_steps).count() +
-                0.5 * mean_aligned_linear_acceleration * std::pow((time_step * steering_lookahead_steps).count(), 2);
+        FP_DATA_TYPE lookahead_duration = FP_DATA_TYPE((time_step * steering_lookahead_steps).count());
 
-        geometry::Vec position = original_state->get_position_variable()->get_value();
-        FP_DATA_TYPE rotation = original_state->get_rotation_variable()->get_value();
-
-        map::ILaneArray<T_map_id> const *lanes;
-
-        // TODO: Accomodate branching lanes
-        lanes = map->get_encapsulating_lanes(position);
+        FP_DATA_TYPE lookahead_distance_covered =
+                aligned_linear_velocity * lookahead_duration +
+                FP_DATA_TYPE(0.5) * mean_aligned_linear_acceleration * lookahead_duration * lookahead_duration;
 
-        if (lanes->count() > 0)
+        if (current_lane != nullptr)
         {
-            map::ILane<T_map_id> const *lane = (*lanes)[0];
+            geometry::ArcLengthTable const *arc_lengths = &current_lane->get_left_boundary_arc_lengths();
 
-            map::ILane<T_map_id> const *current_lane = lane;
+            if (arc_lengths->get_segment_count() == 0)
+            {
+                return false;
+            }
 
-            bool found_start = false;
+            // No lookahead start lies on the lane's boundary when the agent is before its start or beyond its end,
+            // so the steer is held
+            size_t start_segment_idx;
+            FP_DATA_TYPE start_arc_position = arc_lengths->project_unclamped(position, start_segment_idx);
+            if (start_arc_position < 0.0f || start_arc_position > arc_lengths->get_length())
+            {
+                return false;
+            }
 
-            FP_DATA_TYPE distance_remaining = lookahead_distance_covered;
+            FP_DATA_TYPE lookahead_arc_position = start_arc_position + lookahead_distance_covered;
 
             geometry::Vec start_direction, end_direction, end_point;
 
             size_t i;
 
-            FP_DATA_TYPE previous_distance_along_link = std::nanf("");
-
             while (true)
             {
-                geometry::Vecs const &left_boundary = current_lane->get_left_boundary();
-
-                for (i = 0;
-                     i < left_boundary.cols() - 1;
-                     ++i)
+                if (lookahead_arc_position < arc_lengths->get_length())
                 {
-                    geometry::Vec on_boundary = left_boundary.col(i + 1) - left_boundary.col(i);
-                    if (!found_start)
-                    {
-                        geometry::Vec from_boundary = position - left_boundary.col(i);
-                        geometry::Vec on_boundary_normalised = on_boundary.normalized();
-                        FP_DATA_TYPE distance_along_link = on_boundary_normalised.dot(from_boundary);
-
-                        //std::cerr << "distance_along_link: " << distance_along_link << std::endl;
-                        //std::cerr << "on_boundary.norm(): " << on_boundary.norm() << std::endl;
-
-                        if (distance_along_link >= 0 && distance_along_link <= on_boundary.norm())
-                        {
-                            //std::cerr << "start found!" << std::endl;
-                            found_start = true;
-                            start_direction = on_boundary_normalised;
-                            distance_remaining += distance_along_link;
-                        }
-                        else
-                        {
-                            if (!std::isnan(previous_distance_along_link))
-                            {
-                                if ((distance_along_link >= 0 && previous_distance_along_link < 0) ||
-                                        (distance_along_link < 0 && previous_distance_along_link >= 0))
-                                {
-                                    //std::cerr << "Error sign changed" << std::endl;
-                                    found_start = true;
-                                    start_direction = on_boundary_normalised;
-                                    distance_remaining += distance_along_link;
-                                }
-
-                                //if (std::abs(distance_along_link) > std::abs(previous_distance_along_link))
-                                //{
-                                //    std::cerr << "Error increased" << std::endl;
-                                //}
-                            }
-
-                            previous_distance_along_link = distance_along_link;
-                        }
-                    }
-
-                    if (found_start)
-                    {
-                        distance_remaining -= on_boundary.norm();
-
-                        if (distance_remaining < 0)
-                        {
-                            end_direction = on_boundary.normalized();
-                            end_point = left_boundary.col(i + 1);
-                            break;
-                        }
-                    }
+                    i = arc_lengths->get_segment(lookahead_arc_position);
+                    end_direction = arc_lengths->get_direction(i);
+                    end_point = arc_lengths->get_point(i + 1);
+                    break;
                 }
 
-                if (distance_remaining >= 0)
+                map::ILane<T_map_id> const *straight_fore_lane = current_lane->get_straight_fore_lane();
+                if (straight_fore_lane != nullptr &&
+                        straight_fore_lane->get_left_boundary_arc_lengths().get_segment_count() > 0)
                 {
-                    map::ILane<T_map_id> const *straight_fore_lane = current_lane->get_straight_fore_lane();
-                    if (straight_fore_lane != nullptr)
-                    {
-                        //std::cerr << "new lane!" << std::endl;
-                        current_lane = straight_fore_lane;
-                    }
-                    else
-                    {
-                        size_t last_index = left_boundary.cols() - 1;
-                        end_direction = (left_boundary.col(last_index) - left_boundary.col(last_index - 1)).normalized();
-                        end_point = left_boundary.col(last_index - 1);
-                        break;
-                    }
+                    lookahead_arc_position -= arc_lengths->get_length();
+                    current_lane = straight_fore_lane;
+                    arc_lengths = &current_lane->get_left_boundary_arc_lengths();
                 }
                 else
                 {
+                    i = arc_lengths->get_segment_count() - 1;
+                    end_direction = arc_lengths->get_direction(i);
+                    end_point = arc_lengths->get_point(i);
                     break;
                 }
             }
 
-            if (!found_start)
-            {
-                modified_state->set_steer_variable(original_state->get_steer_variable()->constant_shallow_copy());
-                delete lanes;
-                return;
-            }
-
-            geometry::TrigBuff const *trig_buff = geometry::TrigBuff::get_instance();
-
-            // TODO: Remove previous start direction assignments
             start_direction = geometry::Vec(trig_buff->get_cos(rotation), trig_buff->get_sin(rotation));
 
             geometry::Vecs const &right_boundary = current_lane->get_right_boundary();
@@ -237,8 +166,8 @@ public:
             geometry::Vec midpoint_direction = (lane_midpoint - position).normalized();
 
             FP_DATA_TYPE lane_midpoint_dot_prod = start_direction.dot(midpoint_direction);
-            lane_midpoint_dot_prod = std::min(lane_midpoint_dot_prod, 1.0f);
-            lane_midpoint_dot_prod = std::max(lane_midpoint_dot_prod, -1.0f);
+            lane_midpoint_dot_prod = std::min(lane_midpoint_dot_prod, FP_DATA_TYPE(1));
+            lane_midpoint_dot_prod = std::max(lane_midpoint_dot_prod, FP_DATA_TYPE(-1));
             FP_DATA_TYPE lane_midpoint_angle_mag = std::acos(lane_midpoint_dot_prod);
             FP_DATA_TYPE lane_midpoint_angle;
             if (midpoint_direction.dot(trig_buff->get_rot_mat(lane_midpoint_angle_mag) * start_direction) >=
@@ -267,9 +196,86 @@ public:
             FP_DATA_TYPE lane_orientation_steer = lane_orientation_angle / lookahead_distance_covered;
 
 
-            FP_DATA_TYPE new_steer = (lane_midpoint_steer + lane_orientation_steer) / 2.0f;
+            new_steer = (lane_midpoint_steer + lane_orientation_steer) / 2.0f;
             assert(!std::isnan(new_steer));
+        }
+        else
+        {
+            // Driving agent not on lane
+            return false;
+        }
+
+        return true;
+    }
+
+    void modify_buffered_driving_agent_state_on_lane(agent::DrivingSceneStateBuffer *state_buffer, size_t idx,
+                                                     map::ILane<T_map_id> const *current_lane) const
+    {
+        agent::IReadOnlyDrivingAgentState const *original_state = state_buffer->get_current_state(idx);
 
+        FP_DATA_TYPE new_steer;
+
+        bool steer_found = calc_actuation(
+                    original_state,
+                    state_buffer->current.aligned_linear_velocities[idx],
+                    state_buffer->current.aligned_linear_accelerations[idx],
+                    state_buffer->current.get_position(idx),
+                    state_buffer->current.rotations[idx],
+                    current_lane,
+                    state_buffer->next.aligned_linear_accelerations[idx], new_steer);
+
+        if (steer_found)
+        {
+            state_buffer->next.steers[idx] = new_steer;
+        }
+        else
+        {
+            state_buffer->next.steers[idx] = original_state->get_steer_variable()->get_value();
+        }
+    }
+
+public:
+    // The process wide trigonometry buffer is used unless one is given for this simulation context
+    BasicDrivingAgentController(map::IMap<T_map_id> const *map, temporal::Duration time_step, size_t steering_lookahead_steps,
+                                geometry::TrigBuff const *trig_buff = nullptr)
+        : trig_buff(trig_buff != nullptr ? trig_buff : geometry::TrigBuff::get_instance()), map(map), time_step(time_step),
+          steering_lookahead_steps(steering_lookahead_steps)
+    {
+    }
+
+    void modify_state(agent::IReadOnlyEntityState const *original_state, agent::IEntityState *modified_state) const override
+    {
+        this->modify_driving_agent_state(
+                    dynamic_cast<IDrivingAgentState const*>(original_state),
+                    dynamic_cast<IDrivingAgentState*>(modified_state));
+    }
+
+    void modify_driving_agent_state(agent::IReadOnlyDrivingAgentState const *original_state,
+                                    agent::IDrivingAgentState *modified_state) const override
+    {
+        FP_DATA_TYPE new_aligned_linear_acceleration;
+        FP_DATA_TYPE new_steer;
+
+        geometry::Vec position = original_state->get_position_variable()->get_value();
+
+        bool steer_found = calc_actuation(
+                    original_state,
+                    original_state->get_aligned_linear_velocity_variable()->get_value(),
+                    original_state->get_aligned_linear_acceleration_variable()->get_value(),
+                    position,
+                    original_state->get_rotation_variable()->get_value(),
+                    get_current_lane(position),
+                    new_aligned_linear_acceleration, new_steer);
+
+        IConstant<FP_DATA_TYPE> *new_aligned_linear_acceleration_variable =
+                    new BasicConstant(
+                        modified_state->get_name(),
+                        "aligned_linear_acceleration.indirect_actuation",
+                        new_aligned_linear_acceleration);
+        modified_state->set_aligned_linear_acceleration_variable(new_aligned_linear_acceleration_variable);
+
+        if (steer_found)
+        {
             IConstant<FP_DATA_TYPE> *new_steer_variable =
                     new BasicConstant(
                         modified_state->get_name(),
@@ -279,11 +285,38 @@ public:
         }
         else
         {
-            // Driving agent not on lane
             modified_state->set_steer_variable(original_state->get_steer_variable()->constant_shallow_copy());
         }
+    }
 
-        delete lanes;
+    void modify_buffered_driving_agent_state(agent::DrivingSceneStateBuffer *state_buffer,
+                                             size_t idx) const override
+    {
+        modify_buffered_driving_agent_state_on_lane(state_buffer, idx,
+                                                    get_current_lane(state_buffer->current.get_position(idx)));
+    }
+
+    void modify_buffered_driving_agent_states(agent::DrivingSceneStateBuffer *state_buffer,
+                                              structures::IArray<size_t> const *idxs) const override
+    {
+        // Reused across calls on the same thread, as are the lanes of single agents
+        static thread_local geometry::Vecs positions;
+        static thread_local structures::stl::STLStackArray<map::ILane<T_map_id> const*> current_lanes;
+
+        positions.resize(2, idxs->count());
+        size_t i;
+        for (i = 0; i < idxs->count(); ++i)
+        {
+            positions.col(i) = state_buffer->current.get_position((*idxs)[i]);
+        }
+
+        // TODO: Accomodate branching lanes
+        map->get_first_encapsulating_lanes(positions, &current_lanes);
+
+        for (i = 0; i < idxs->count(); ++i)
+        {
+            modify_buffered_driving_agent_state_on_lane(state_buffer, (*idxs)[i], current_lanes[i]);
+        }
     }
 };
 
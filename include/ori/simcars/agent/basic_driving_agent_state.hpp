@@ -1,8 +1,10 @@
 #pragma once
 
-#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/agent/parameter_registry.hpp>
 #include <ori/simcars/agent/driving_agent_state_abstract.hpp>
 
+#include <vector>
+
 namespace ori
 {
 namespace simcars
@@ -16,10 +18,11 @@ class BasicDrivingAgentState : public virtual ADrivingAgentState
     temporal::Time time;
     bool delete_dicts;
 
-    void set_parameter_value(IValuelessConstant *parameter_value);
-
 protected:
-    structures::stl::STLDictionary<std::string, IValuelessConstant*> parameter_dict;
+    // Indexed by parameter handle, with parameters not present in the state left as null
+    std::vector<IValuelessConstant*> parameters_by_handle;
+
+    void set_parameter_value(ParameterHandle parameter_handle, IValuelessConstant *parameter_value);
 
 public:
     BasicDrivingAgentState(std::string const &name, temporal::Time time, bool delete_dicts = true);
@@ -35,7 +38,10 @@ public:
 
     structures::IArray<IValuelessConstant const*>* get_parameter_values() const override;
     IValuelessConstant const* get_parameter_value(std::string const &parameter_name) const override;
+    IValuelessConstant const* get_parameter_value(ParameterHandle parameter_handle) const override;
 
+    // Constants are stored under their parameter's handle without comparing names, they must belong to this
+    // state's agent and parameter, which is only checked in debug builds
     void set_id_constant(IConstant<uint32_t> *id_constant) override;
     void set_ego_constant(IConstant<bool> *ego_constant) override;
     void set_bb_length_constant(IConstant<FP_DATA_TYPE> *bb_length_constant) override;
@@ -56,6 +62,11 @@ public:
 
     structures::IArray<IValuelessConstant*>* get_mutable_parameter_values() override;
     IValuelessConstant* get_mutable_parameter_value(std::string const &parameter_name) override;
+    IValuelessConstant* get_mutable_parameter_value(ParameterHandle parameter_handle) override;
+
+    // Null when the parameter is not present or the state shares its parameters with another state, so that
+    // whatever is returned can be written to without affecting any other state
+    IValuelessConstant* get_owned_mutable_parameter_value(ParameterHandle parameter_handle);
 };
 
 }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <ori/simcars/geometry/trig_buff.hpp>
 #include <ori/simcars/agent/scene_interface.hpp>
 #include <ori/simcars/agent/driving_agent_controller_interface.hpp>
+#include <ori/simcars/agent/driving_agent_ttc_calculator_interface.hpp>
 #include <ori/simcars/agent/driving_simulator_interface.hpp>
+#include <ori/simcars/agent/driving_scene_state_buffer.hpp>
 
 namespace ori
 {
@@ -14,9 +17,23 @@ namespace agent
 class BasicDrivingSimulator : public virtual IDrivingSimulator
 {
     IDrivingAgentController const *controller;
+    IDrivingAgentTTCCalculator const *ttc_calculator;
+    geometry::TrigBuff const *trig_buff;
+
+    // Brute force pairwise checks are retained for validating the broad phase against
+    bool broad_phase_enabled;
+
+    void simulate_buffered_driving_agents(DrivingSceneStateBuffer *state_buffer, size_t begin, size_t end,
+                                          temporal::Duration time_step) const;
 
 public:
-    BasicDrivingSimulator(IDrivingAgentController const *controller);
+    // Times to collision are calculated with swept bounding boxes unless another calculator is given, and the
+    // process wide trigonometry buffer is used unless one is given for this simulation context. Give a
+    // HeuristicDrivingAgentTTCCalculator to reproduce the TTCs, and so the SafeSpeedy rewards, of earlier versions.
+    BasicDrivingSimulator(IDrivingAgentController const *controller,
+                          bool broad_phase_enabled = true,
+                          IDrivingAgentTTCCalculator const *ttc_calculator = nullptr,
+                          geometry::TrigBuff const *trig_buff = nullptr);
 
     void simulate(agent::IReadOnlySceneState const *current_state, agent::ISceneState *next_state, temporal::Duration time_step) const override;
 
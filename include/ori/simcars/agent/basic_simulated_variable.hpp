@@ -1,14 +1,15 @@
 #pragma once
 
 #include <ori/simcars/structures/stl/stl_concat_array.hpp>
-#include <ori/simcars/temporal/temporal_rounding_dictionary.hpp>
+#include <ori/simcars/temporal/temporal_series.hpp>
 #include <ori/simcars/agent/constant_interface.hpp>
 #include <ori/simcars/agent/entity_state_interface.hpp>
 #include <ori/simcars/agent/simulation_scene_interface.hpp>
 #include <ori/simcars/agent/simulated_variable_abstract.hpp>
-#include <ori/simcars/agent/basic_event.hpp>
+#include <ori/simcars/agent/event_arena.hpp>
 
 #include <stdexcept>
+#include <mutex>
 
 namespace ori
 {
@@ -26,7 +27,12 @@ class BasicSimulatedVariable : public virtual ASimulatedVariable<T>
     mutable temporal::Time simulation_start_time;
     temporal::Time simulation_end_time;
 
-    mutable temporal::TemporalRoundingDictionary<IEvent<T>*> time_event_dict;
+    mutable temporal::TemporalSeries<EventIndex> time_event_dict;
+
+    // Serialises propagation as for BasicVariable, with the same requirement upon variables before they are shared
+    mutable std::mutex propagation_mutex;
+
+    EventArena<T> event_arena;
 
     void simulation_check(temporal::Time time) const
     {
@@ -44,6 +50,12 @@ class BasicSimulatedVariable : public virtual ASimulatedVariable<T>
         }
     }
 
+    BasicSimulatedVariable(BasicSimulatedVariable<T> const &variable) :
+        original_variable(variable.original_variable), simulation_scene(variable.simulation_scene),
+        simulation_start_time(variable.simulation_start_time),
+        simulation_end_time(variable.simulation_end_time),
+        time_event_dict(variable.time_event_dict), event_arena(variable.event_arena, this, time_event_dict) {}
+
 public:
     BasicSimulatedVariable(IVariable<T> const *original_variable,
                       ISimulationScene *simulation_scene,
@@ -63,7 +75,7 @@ public:
                       temporal::Duration time_step) :
         original_variable(original_variable), simulation_scene(simulation_scene),
         simulation_end_time(simulation_end_time),
-        time_event_dict(time_step, nullptr)
+        time_event_dict(time_step, NULL_EVENT_INDEX), event_arena(this)
     {
         if (simulation_start_time < original_variable->get_min_temporal_limit())
         {
@@ -90,38 +102,13 @@ public:
         }
     }
 
-    ~BasicSimulatedVariable()
-    {
-        structures::IArray<IEvent<T>*> const *events = time_event_dict.get_values();
-
-        for (size_t i = 0; i < events->count(); ++i)
-        {
-            delete (*events)[i];
-        }
-    }
-
     /*
      * NOTE: This should not be called directly by external code, as the simulation scene will not have a pointer to the
      * resulting copy and thus any new simulation data will not be propogated to the copy.
      */
     ISimulatedVariable<T>* simulated_variable_deep_copy() const override
     {
-        BasicSimulatedVariable<T> *variable =
-                new BasicSimulatedVariable<T>(original_variable, simulation_scene, simulation_start_time,
-                                         simulation_end_time, simulation_start_time < simulation_end_time,
-                                         time_event_dict.get_time_window_step());
-
-        size_t i;
-
-        structures::IArray<temporal::Time> const *times = time_event_dict.get_keys();
-        for(i = 0; i < times->count(); ++i)
-        {
-            IEvent<T> *event = time_event_dict[(*times)[i]];
-            if (event != nullptr)
-            {
-                variable->time_event_dict.update((*times)[i], event->event_shallow_copy());
-            }
-        }
+        BasicSimulatedVariable<T> *variable = new BasicSimulatedVariable<T>(*this);
 
         variable->propogate_events_forward(this->get_max_temporal_limit());
 
@@ -172,10 +159,14 @@ public:
 
     void propogate_events_forward() const override
     {
+        std::lock_guard<std::mutex> propagation_guard(propagation_mutex);
+
         time_event_dict.propogate_values_forward();
     }
     void propogate_events_forward(temporal::Time time_window_end) const override
     {
+        std::lock_guard<std::mutex> propagation_guard(propagation_mutex);
+
         time_event_dict.propogate_values_forward(time_window_end);
     }
 
@@ -191,7 +182,7 @@ public:
         {
             if (time_event_dict.contains(time))
             {
-                value = time_event_dict[time]->get_value();
+                value = event_arena[time_event_dict[time]].get_value();
                 return true;
             }
             else
@@ -227,17 +218,17 @@ public:
 
         simulation_check(time_window_end);
 
-        structures::IArray<IEvent<T>*> const *unfiltered_simulated_events =
-                time_event_dict.get_values();
         structures::IStackArray<IEvent<T> const*> *filtered_simulated_events =
                 new structures::stl::STLStackArray<IEvent<T> const*>;
 
-        for (size_t i = 0; i < unfiltered_simulated_events->count(); ++i)
+        for (size_t i = 0; i < time_event_dict.get_run_count(); ++i)
         {
-            if ((*unfiltered_simulated_events)[i]->get_time() >= time_window_start
-                    && (*unfiltered_simulated_events)[i]->get_time() <= time_window_end)
+            EventIndex event_index = time_event_dict.get_run_value(i);
+            if (event_index != NULL_EVENT_INDEX &&
+                    event_arena[event_index].get_time() >= time_window_start &&
+                    event_arena[event_index].get_time() <= time_window_end)
             {
-                filtered_simulated_events->push_back((*unfiltered_simulated_events)[i]);
+                filtered_simulated_events->push_back(&event_arena[event_index]);
             }
         }
 
@@ -268,7 +259,13 @@ public:
         }
         else
         {
-            IEvent<T> const *prospective_event = time_event_dict[time];
+            EventIndex prospective_event_index = time_event_dict[time];
+            if (prospective_event_index == NULL_EVENT_INDEX)
+            {
+                return nullptr;
+            }
+
+            IEvent<T> const *prospective_event = &event_arena[prospective_event_index];
             if (!exact || prospective_event->get_time() == time)
             {
                 return prospective_event;
@@ -284,9 +281,8 @@ public:
     {
         if (time_event_dict.contains(time, true))
         {
-            IEvent<T> *event = time_event_dict[time];
+            // The event itself is freed along with the arena, and left out of copies of it
             time_event_dict.erase(time);
-            delete event;
             return true;
         }
         else
@@ -302,18 +298,15 @@ public:
         {
             if (time_event_dict.contains(time))
             {
-                IEvent<T> *other_event = time_event_dict[time];
-                if (time == other_event->get_time())
+                ArenaEvent<T> &other_event = event_arena[time_event_dict[time]];
+                if (time == other_event.get_time())
                 {
-                    other_event->set_value(value);
+                    other_event.set_value(value);
                     return;
                 }
             }
 
-            time_event_dict.update(time,
-                                   new BasicEvent(this->get_entity_name(),
-                                                  this->get_parameter_name(),
-                                                  value, time));
+            time_event_dict.update(time, event_arena.push_back(value, time));
         }
     }
 
@@ -329,17 +322,17 @@ public:
 
         simulation_check(time_window_end);
 
-        structures::IArray<IEvent<T>*> const *unfiltered_simulated_events =
-                time_event_dict.get_values();
         structures::IStackArray<IEvent<T>*> *filtered_simulated_events =
                 new structures::stl::STLStackArray<IEvent<T>*>;
 
-        for (size_t i = 0; i < unfiltered_simulated_events->count(); ++i)
+        for (size_t i = 0; i < time_event_dict.get_run_count(); ++i)
         {
-            if ((*unfiltered_simulated_events)[i]->get_time() >= time_window_start
-                    && (*unfiltered_simulated_events)[i]->get_time() <= time_window_end)
+            EventIndex event_index = time_event_dict.get_run_value(i);
+            if (event_index != NULL_EVENT_INDEX &&
+                    event_arena[event_index].get_time() >= time_window_start &&
+                    event_arena[event_index].get_time() <= time_window_end)
             {
-                filtered_simulated_events->push_back((*unfiltered_simulated_events)[i]);
+                filtered_simulated_events->push_back(&event_arena[event_index]);
             }
         }
 
@@ -352,7 +345,13 @@ public:
 
         if (time >= simulation_start_time + simulation_scene->get_time_step())
         {
-            IEvent<T> *prospective_event = time_event_dict[time];
+            EventIndex prospective_event_index = time_event_dict[time];
+            if (prospective_event_index == NULL_EVENT_INDEX)
+            {
+                return nullptr;
+            }
+
+            IEvent<T> *prospective_event = &event_arena[prospective_event_index];
             if (!exact || prospective_event->get_time() == time)
             {
                 return prospective_event;
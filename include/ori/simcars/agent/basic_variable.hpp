@@ -1,11 +1,12 @@
 #pragma once
 
 #include <ori/simcars/structures/stl/stl_stack_array.hpp>
-#include <ori/simcars/temporal/temporal_rounding_dictionary.hpp>
+#include <ori/simcars/temporal/temporal_series.hpp>
 #include <ori/simcars/agent/variable_abstract.hpp>
-#include <ori/simcars/agent/basic_event.hpp>
+#include <ori/simcars/agent/event_arena.hpp>
 
 #include <stdexcept>
+#include <mutex>
 
 namespace ori
 {
@@ -22,22 +23,25 @@ class BasicVariable : public AVariable<T>
 
     IValuelessVariable::Type const type;
 
-    mutable temporal::TemporalRoundingDictionary<IEvent<T>*> time_event_dict;
+    mutable temporal::TemporalSeries<EventIndex> time_event_dict;
+
+    // Forks share the variables of their parent between threads, so propagation is serialised. Readers are not
+    // locked out. That is only safe over a range that has already been propagated, where propagating writes
+    // nothing; propagating beyond the end of the series grows it, moving the values readers are reading. A
+    // variable must therefore be propagated up to the end of every simulation it will take part in before it is
+    // shared.
+    mutable std::mutex propagation_mutex;
+
+    EventArena<T> event_arena;
+
+    BasicVariable(BasicVariable<T> const &variable) : entity_name(variable.entity_name),
+        variable_name(variable.variable_name), type(variable.type),
+        time_event_dict(variable.time_event_dict), event_arena(variable.event_arena, this, time_event_dict) {}
 
 public:
     BasicVariable(std::string const &entity_name, std::string const &parameter_name, IValuelessVariable::Type type,
              temporal::Duration time_step) : entity_name(entity_name), variable_name(parameter_name), type(type),
-        time_event_dict(time_step, nullptr) {}
-
-    ~BasicVariable()
-    {
-        structures::IArray<IEvent<T>*> const *events = time_event_dict.get_values();
-
-        for (size_t i = 0; i < events->count(); ++i)
-        {
-            delete (*events)[i];
-        }
-    }
+        time_event_dict(time_step, NULL_EVENT_INDEX), event_arena(this) {}
 
     IValuelessVariable* valueless_deep_copy() const override
     {
@@ -46,22 +50,7 @@ public:
 
     IVariable<T>* variable_deep_copy() const override
     {
-        BasicVariable<T> *variable =
-                new BasicVariable<T>(
-                    entity_name,
-                    variable_name,
-                    type,
-                    time_event_dict.get_time_window_step());
-
-        structures::IArray<temporal::Time> const *times = time_event_dict.get_keys();
-        for(size_t i = 0; i < times->count(); ++i)
-        {
-            IEvent<T> *event = time_event_dict[(*times)[i]];
-            if (event != nullptr)
-            {
-                variable->time_event_dict.update((*times)[i], event->event_shallow_copy());
-            }
-        }
+        BasicVariable<T> *variable = new BasicVariable<T>(*this);
 
         variable->propogate_events_forward(this->get_max_temporal_limit());
 
@@ -105,10 +94,14 @@ public:
 
     void propogate_events_forward() const override
     {
+        std::lock_guard<std::mutex> propagation_guard(propagation_mutex);
+
         time_event_dict.propogate_values_forward();
     }
     void propogate_events_forward(temporal::Time time_window_end) const override
     {
+        std::lock_guard<std::mutex> propagation_guard(propagation_mutex);
+
         time_event_dict.propogate_values_forward(time_window_end);
     }
 
@@ -116,7 +109,7 @@ public:
     {
         if (time_event_dict.contains(time))
         {
-            value = time_event_dict[time]->get_value();
+            value = event_arena[time_event_dict[time]].get_value();
             return true;
         }
         else
@@ -136,18 +129,17 @@ public:
             return new structures::stl::STLStackArray<IEvent<T> const*>;
         }
 
-        structures::IArray<IEvent<T>*> const *unfiltered_events =
-                time_event_dict.get_values();
         structures::IStackArray<IEvent<T> const*> *filtered_events =
                 new structures::stl::STLStackArray<IEvent<T> const*>;
 
-        for (size_t i = 0; i < unfiltered_events->count(); ++i)
+        for (size_t i = 0; i < time_event_dict.get_run_count(); ++i)
         {
-            if ((*unfiltered_events)[i] != nullptr &&
-                    (*unfiltered_events)[i]->get_time() >= time_window_start &&
-                    (*unfiltered_events)[i]->get_time() <= time_window_end)
+            EventIndex event_index = time_event_dict.get_run_value(i);
+            if (event_index != NULL_EVENT_INDEX &&
+                    event_arena[event_index].get_time() >= time_window_start &&
+                    event_arena[event_index].get_time() <= time_window_end)
             {
-                filtered_events->push_back((*unfiltered_events)[i]);
+                filtered_events->push_back(&event_arena[event_index]);
             }
         }
 
@@ -156,7 +148,13 @@ public:
 
     IEvent<T> const* get_event(temporal::Time time, bool exact) const override
     {
-        IEvent<T> const *prospective_event = time_event_dict[time];
+        EventIndex prospective_event_index = time_event_dict[time];
+        if (prospective_event_index == NULL_EVENT_INDEX)
+        {
+            return nullptr;
+        }
+
+        IEvent<T> const *prospective_event = &event_arena[prospective_event_index];
         if (!exact || prospective_event->get_time() == time)
         {
             return prospective_event;
@@ -171,9 +169,8 @@ public:
     {
         if (time_event_dict.contains(time, true))
         {
-            IEvent<T> *event = time_event_dict[time];
+            // The event itself is freed along with the arena, and left out of copies of it
             time_event_dict.erase(time);
-            delete event;
             return true;
         }
         else
@@ -186,17 +183,15 @@ public:
     {
         if (time_event_dict.contains(time))
         {
-            IEvent<T> *other_event = time_event_dict[time];
-            if (time == other_event->get_time())
+            ArenaEvent<T> &other_event = event_arena[time_event_dict[time]];
+            if (time == other_event.get_time())
             {
-                other_event->set_value(value);
+                other_event.set_value(value);
                 return;
             }
         }
 
-        time_event_dict.update(time, new BasicEvent(this->get_entity_name(),
-                                                    this->get_parameter_name(),
-                                                    value, time));
+        time_event_dict.update(time, event_arena.push_back(value, time));
     }
 
     structures::IArray<IEvent<T>*>* get_mutable_events(
@@ -210,17 +205,17 @@ public:
             return new structures::stl::STLStackArray<IEvent<T>*>;
         }
 
-        structures::IArray<IEvent<T>*> const *unfiltered_events =
-                time_event_dict.get_values();
         structures::IStackArray<IEvent<T>*> *filtered_events =
                 new structures::stl::STLStackArray<IEvent<T>*>;
 
-        for (size_t i = 0; i < unfiltered_events->count(); ++i)
+        for (size_t i = 0; i < time_event_dict.get_run_count(); ++i)
         {
-            if ((*unfiltered_events)[i]->get_time() >= time_window_start
-                    && (*unfiltered_events)[i]->get_time() <= time_window_end)
+            EventIndex event_index = time_event_dict.get_run_value(i);
+            if (event_index != NULL_EVENT_INDEX &&
+                    event_arena[event_index].get_time() >= time_window_start &&
+                    event_arena[event_index].get_time() <= time_window_end)
             {
-                filtered_events->push_back((*unfiltered_events)[i]);
+                filtered_events->push_back(&event_arena[event_index]);
             }
         }
 
@@ -229,7 +224,13 @@ public:
 
     IEvent<T>* get_mutable_event(temporal::Time time, bool exact) override
     {
-        IEvent<T> *prospective_event = time_event_dict[time];
+        EventIndex prospective_event_index = time_event_dict[time];
+        if (prospective_event_index == NULL_EVENT_INDEX)
+        {
+            return nullptr;
+        }
+
+        IEvent<T> *prospective_event = &event_arena[prospective_event_index];
         if (!exact || prospective_event->get_time() == time)
         {
             return prospective_event;
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ori/simcars/structures/set_interface.hpp>
+#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/agent/file_based_scene_interface.hpp>
+#include <ori/simcars/agent/driving_scene_abstract.hpp>
+#include <ori/simcars/agent/binary/binary_driving_agent.hpp>
+
+#include <memory>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+// Read-only driving scene over a memory mapped binary scene file (see binary_scene_format.hpp), agent
+// data is never copied out of the mapping. Deep copies share the mapping and are read-only as well,
+// fork the scene (see DrivingSceneFork) to modify it. Agents may still be obtained mutably, so that
+// simulation scenes can be constructed straight from a binary scene, but their parameters cannot.
+class BinaryScene : public virtual IFileBasedScene, public virtual ADrivingScene
+{
+    std::shared_ptr<BinarySceneFile const> scene_file;
+
+    geometry::Vec min_spatial_limits, max_spatial_limits;
+    temporal::Duration time_step;
+    temporal::Time min_temporal_limit, max_temporal_limit;
+
+    structures::stl::STLDictionary<std::string, IDrivingAgent*> driving_agent_dict;
+
+    BinaryScene(std::shared_ptr<BinarySceneFile const> const &scene_file);
+
+public:
+    ~BinaryScene();
+
+    static BinaryScene* load(std::string const &input_file_path_str,
+                             structures::ISet<std::string>* agent_names = nullptr);
+
+    // Writes any driving scene to a binary scene file, sampling every variable once per time step
+    static void write(IDrivingScene const *driving_scene, std::string const &output_file_path_str);
+
+    void save(std::string const &output_file_path_str) const override;
+
+    IDrivingScene* driving_scene_deep_copy() const override;
+
+    geometry::Vec get_min_spatial_limits() const override;
+    geometry::Vec get_max_spatial_limits() const override;
+
+    temporal::Duration get_time_step() const override;
+
+    temporal::Time get_min_temporal_limit() const override;
+    temporal::Time get_max_temporal_limit() const override;
+
+    structures::IArray<IDrivingAgent const*>* get_driving_agents() const override;
+    IDrivingAgent const* get_driving_agent(std::string const &driving_agent_name) const override;
+
+    structures::IArray<IDrivingAgent*>* get_mutable_driving_agents() override;
+    IDrivingAgent* get_mutable_driving_agent(std::string const &driving_agent_name) override;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ori/simcars/agent/binary/binary_scene_format.hpp>
+
+#include <string>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+// Read-only memory mapping of a binary scene file. The header, agent table and column bounds are
+// validated when the file is opened, after which columns are read straight out of the mapping.
+class BinarySceneFile
+{
+    void *data;
+    size_t size;
+
+public:
+    BinarySceneFile(std::string const &input_file_path_str);
+    BinarySceneFile(BinarySceneFile const&) = delete;
+
+    ~BinarySceneFile();
+
+    BinarySceneHeader const& get_header() const;
+
+    size_t get_agent_count() const;
+    BinarySceneAgentEntry const& get_agent_entry(size_t agent_idx) const;
+
+    void const* get_column(BinarySceneAgentEntry const &agent_entry, BinarySceneColumn column) const;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <ori/simcars/geometry/typedefs.hpp>
+#include <ori/simcars/temporal/typedefs.hpp>
+
+#include <type_traits>
+#include <limits>
+#include <bit>
+#include <cstdint>
+
+#define BINARY_SCENE_MAGIC "SCBSCENE"
+#define BINARY_SCENE_MAGIC_LENGTH 8
+#define BINARY_SCENE_VERSION 2
+#define BINARY_SCENE_BYTE_ORDER_MARK 0x01020304
+#define BINARY_SCENE_AGENT_NAME_LENGTH 64
+#define BINARY_SCENE_COLUMN_ALIGNMENT 64
+// NaNs with payloads arithmetic never produces, so NaN values recorded in a scene are kept distinct
+#define BINARY_SCENE_MISSING_FLOAT_BITS 0x7FC0DEAD
+#define BINARY_SCENE_MISSING_DOUBLE_BITS 0x7FF8DEADDEADDEAD
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+// Layout of a binary scene file (version 2), all values are stored in the byte order of the machine
+// that wrote the file (checked on load through the byte order mark), and scalars are stored as the
+// FP_DATA_TYPE of the build that wrote the file (checked on load through the scalar size):
+//
+//   BinarySceneHeader
+//   BinarySceneAgentEntry * agent_count
+//   Columns, each aligned to BINARY_SCENE_COLUMN_ALIGNMENT bytes
+//
+// Every agent has one contiguous column per variable with one slot per time step, starting from the
+// minimum temporal limit of the agent. Slots for which the variable had no value hold the missing
+// value of the column's element type. Times are stored in milliseconds since epoch.
+
+enum class BinarySceneColumn : uint32_t
+{
+    POSITION = 0,
+    LINEAR_VELOCITY = 1,
+    ALIGNED_LINEAR_VELOCITY = 2,
+    LINEAR_ACCELERATION = 3,
+    ALIGNED_LINEAR_ACCELERATION = 4,
+    EXTERNAL_LINEAR_ACCELERATION = 5,
+    ROTATION = 6,
+    STEER = 7,
+    ANGULAR_VELOCITY = 8,
+    TTC = 9,
+    CUMILATIVE_COLLISION_TIME = 10,
+    COUNT = 11
+};
+
+#define BINARY_SCENE_COLUMN_COUNT size_t(BinarySceneColumn::COUNT)
+
+struct BinarySceneHeader
+{
+    char magic[BINARY_SCENE_MAGIC_LENGTH];
+    uint32_t version;
+    uint32_t byte_order_mark;
+    uint32_t scalar_size;
+    uint32_t reserved;
+    uint64_t agent_count;
+    int64_t time_step;
+    int64_t min_temporal_limit;
+    int64_t max_temporal_limit;
+    FP_DATA_TYPE min_spatial_limits[2];
+    FP_DATA_TYPE max_spatial_limits[2];
+};
+
+struct BinarySceneColumnEntry
+{
+    uint64_t offset;
+    // Slots outside of [first_slot, end_slot) are known to be missing
+    uint64_t first_slot;
+    uint64_t end_slot;
+};
+
+struct BinarySceneAgentEntry
+{
+    char name[BINARY_SCENE_AGENT_NAME_LENGTH];
+    uint32_t id;
+    uint32_t ego;
+    int32_t driving_agent_class;
+    FP_DATA_TYPE bb_length;
+    FP_DATA_TYPE bb_width;
+    FP_DATA_TYPE min_spatial_limits[2];
+    FP_DATA_TYPE max_spatial_limits[2];
+    int64_t min_temporal_limit;
+    int64_t max_temporal_limit;
+    uint64_t slot_count;
+    BinarySceneColumnEntry columns[BINARY_SCENE_COLUMN_COUNT];
+};
+
+static_assert(std::is_trivially_copyable<BinarySceneHeader>::value &&
+              std::is_trivially_copyable<BinarySceneAgentEntry>::value,
+              "Binary scene records must be trivially copyable");
+static_assert(sizeof(BinarySceneHeader) % alignof(BinarySceneAgentEntry) == 0,
+              "Binary scene agent table would be misaligned");
+
+// Bit patterns of the scalar types a binary scene may be written with
+template <typename T>
+struct BinarySceneScalarTraits;
+
+template <>
+struct BinarySceneScalarTraits<float>
+{
+    typedef uint32_t Bits;
+
+    static constexpr Bits missing_bits = BINARY_SCENE_MISSING_FLOAT_BITS;
+};
+
+template <>
+struct BinarySceneScalarTraits<double>
+{
+    typedef uint64_t Bits;
+
+    static constexpr Bits missing_bits = BINARY_SCENE_MISSING_DOUBLE_BITS;
+};
+
+// Converts between variable values and the elements stored in the columns of a binary scene
+template <typename T>
+struct BinarySceneColumnTraits;
+
+template <>
+struct BinarySceneColumnTraits<geometry::Vec>
+{
+    typedef BinarySceneScalarTraits<FP_DATA_TYPE> ScalarTraits;
+
+    struct Element
+    {
+        FP_DATA_TYPE x;
+        FP_DATA_TYPE y;
+    };
+
+    static Element encode(geometry::Vec const &value)
+    {
+        return Element{value.x(), value.y()};
+    }
+    static Element encode_missing()
+    {
+        FP_DATA_TYPE const missing = std::bit_cast<FP_DATA_TYPE>(ScalarTraits::missing_bits);
+        return Element{missing, missing};
+    }
+    static bool decode(Element const &element, geometry::Vec &value)
+    {
+        if (std::bit_cast<ScalarTraits::Bits>(element.x) == ScalarTraits::missing_bits)
+        {
+            return false;
+        }
+        value = geometry::Vec(element.x, element.y);
+        return true;
+    }
+};
+
+template <>
+struct BinarySceneColumnTraits<FP_DATA_TYPE>
+{
+    typedef BinarySceneScalarTraits<FP_DATA_TYPE> ScalarTraits;
+
+    typedef FP_DATA_TYPE Element;
+
+    static Element encode(FP_DATA_TYPE const &value)
+    {
+        return value;
+    }
+    static Element encode_missing()
+    {
+        return std::bit_cast<FP_DATA_TYPE>(ScalarTraits::missing_bits);
+    }
+    static bool decode(Element const &element, FP_DATA_TYPE &value)
+    {
+        if (std::bit_cast<ScalarTraits::Bits>(element) == ScalarTraits::missing_bits)
+        {
+            return false;
+        }
+        value = element;
+        return true;
+    }
+};
+
+template <>
+struct BinarySceneColumnTraits<temporal::Duration>
+{
+    typedef int64_t Element;
+
+    static Element encode(temporal::Duration const &value)
+    {
+        return value.count();
+    }
+    static Element encode_missing()
+    {
+        return std::numeric_limits<int64_t>::min();
+    }
+    static bool decode(Element const &element, temporal::Duration &value)
+    {
+        if (element == std::numeric_limits<int64_t>::min())
+        {
+            return false;
+        }
+        value = temporal::Duration(element);
+        return true;
+    }
+};
+
+}
+}
+}
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <ori/simcars/utils/exceptions.hpp>
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/agent/variable_abstract.hpp>
+#include <ori/simcars/agent/basic_variable.hpp>
+#include <ori/simcars/agent/event_arena.hpp>
+#include <ori/simcars/agent/binary/binary_scene_format.hpp>
+
+#include <vector>
+#include <mutex>
+#include <stdexcept>
+#include <cstring>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+// Read-only variable backed by a column of a memory mapped binary scene, values are decoded straight
+// from the column. Each run of consecutive slots holding the same value is treated as one event at the
+// start of the run, as a propagated BasicVariable would be, but event objects are only created (all at
+// once) the first time events are requested. Deep copies are BasicVariables, so forks of a binary
+// scene can be modified as usual.
+template <typename T>
+class MappedVariable : public AVariable<T>
+{
+    typedef typename BinarySceneColumnTraits<T>::Element Element;
+
+    std::string const entity_name;
+    std::string const variable_name;
+
+    IValuelessVariable::Type const type;
+
+    Element const *column;
+    size_t const first_slot;
+    size_t const end_slot;
+
+    temporal::Time const time_window_start;
+    temporal::Duration const time_step;
+
+    mutable std::once_flag events_materialised_flag;
+    mutable EventArena<T> *event_arena;
+    mutable std::vector<EventIndex> slot_event_indices;
+
+    bool get_slot(temporal::Time time, size_t &slot) const
+    {
+        if (time < time_window_start)
+        {
+            return false;
+        }
+
+        slot = (time - time_window_start).count() / time_step.count();
+        return slot >= first_slot && slot < end_slot;
+    }
+
+    temporal::Time get_slot_time(size_t slot) const
+    {
+        return time_window_start + time_step * temporal::DurationRep(slot);
+    }
+
+    void materialise_events() const
+    {
+        std::call_once(events_materialised_flag, [this]()
+        {
+            event_arena = new EventArena<T>(this);
+            slot_event_indices.resize(end_slot - first_slot, NULL_EVENT_INDEX);
+
+            T value;
+            for (size_t slot = first_slot; slot < end_slot; ++slot)
+            {
+                if (BinarySceneColumnTraits<T>::decode(column[slot], value))
+                {
+                    if (slot > first_slot && slot_event_indices[slot - first_slot - 1] != NULL_EVENT_INDEX &&
+                            std::memcmp(&column[slot], &column[slot - 1], sizeof(Element)) == 0)
+                    {
+                        slot_event_indices[slot - first_slot] = slot_event_indices[slot - first_slot - 1];
+                    }
+                    else
+                    {
+                        slot_event_indices[slot - first_slot] = event_arena->push_back(value,
+                                                                                        get_slot_time(slot));
+                    }
+                }
+            }
+        });
+    }
+
+public:
+    MappedVariable(std::string const &entity_name, std::string const &variable_name, IValuelessVariable::Type type,
+                   void const *column, BinarySceneColumnEntry const &column_entry,
+                   temporal::Time time_window_start, temporal::Duration time_step) :
+        entity_name(entity_name), variable_name(variable_name), type(type),
+        column(static_cast<Element const*>(column)), first_slot(column_entry.first_slot),
+        end_slot(column_entry.end_slot), time_window_start(time_window_start), time_step(time_step),
+        event_arena(nullptr) {}
+    MappedVariable(MappedVariable<T> const&) = delete;
+
+    ~MappedVariable()
+    {
+        delete event_arena;
+    }
+
+    IValuelessVariable* valueless_deep_copy() const override
+    {
+        return variable_deep_copy();
+    }
+
+    IVariable<T>* variable_deep_copy() const override
+    {
+        IVariable<T> *variable = new BasicVariable<T>(entity_name, variable_name, type, time_step);
+
+        T value;
+        for (size_t slot = first_slot; slot < end_slot; ++slot)
+        {
+            if (BinarySceneColumnTraits<T>::decode(column[slot], value))
+            {
+                variable->set_value(get_slot_time(slot), value);
+            }
+        }
+
+        return variable;
+    }
+
+    std::string get_entity_name() const override
+    {
+        return entity_name;
+    }
+
+    std::string get_variable_name() const override
+    {
+        return variable_name;
+    }
+
+    IValuelessVariable::Type get_type() const override
+    {
+        return type;
+    }
+
+    temporal::Time get_min_temporal_limit() const override
+    {
+        if (first_slot == end_slot)
+        {
+            throw std::out_of_range("Mapped variable is empty");
+        }
+
+        return get_slot_time(first_slot);
+    }
+
+    temporal::Time get_last_event_time() const override
+    {
+        return this->get_max_temporal_limit();
+    }
+
+    temporal::Time get_max_temporal_limit() const override
+    {
+        if (first_slot == end_slot)
+        {
+            throw std::out_of_range("Mapped variable is empty");
+        }
+
+        return get_slot_time(end_slot - 1);
+    }
+
+    bool has_event(temporal::Time time) const override
+    {
+        T value;
+        return get_value(time, value);
+    }
+
+    void propogate_events_forward() const override {}
+    void propogate_events_forward(temporal::Time time_window_end) const override {}
+
+    bool get_value(temporal::Time time, T &value) const override
+    {
+        size_t slot;
+        return get_slot(time, slot) && BinarySceneColumnTraits<T>::decode(column[slot], value);
+    }
+
+    structures::IArray<IEvent<T> const*>* get_events(
+            temporal::Time time_window_start,
+            temporal::Time time_window_end) const override
+    {
+        structures::IStackArray<IEvent<T> const*> *filtered_events =
+                new structures::stl::STLStackArray<IEvent<T> const*>;
+
+        materialise_events();
+
+        for (size_t i = 0; i < event_arena->count(); ++i)
+        {
+            if ((*event_arena)[i].get_time() >= time_window_start &&
+                    (*event_arena)[i].get_time() <= time_window_end)
+            {
+                filtered_events->push_back(&(*event_arena)[i]);
+            }
+        }
+
+        return filtered_events;
+    }
+
+    IEvent<T> const* get_event(temporal::Time time, bool exact) const override
+    {
+        size_t slot;
+        if (!get_slot(time, slot))
+        {
+            return nullptr;
+        }
+
+        materialise_events();
+
+        EventIndex event_index = slot_event_indices[slot - first_slot];
+        if (event_index == NULL_EVENT_INDEX)
+        {
+            return nullptr;
+        }
+
+        IEvent<T> const *event = &(*event_arena)[event_index];
+        if (!exact || event->get_time() == time)
+        {
+            return event;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    bool remove_value(temporal::Time time) override
+    {
+        throw utils::NotImplementedException();
+    }
+
+    void set_value(temporal::Time time, T const &value) override
+    {
+        throw utils::NotImplementedException();
+    }
+
+    structures::IArray<IEvent<T>*>* get_mutable_events(
+            temporal::Time time_window_start,
+            temporal::Time time_window_end) override
+    {
+        throw utils::NotImplementedException();
+    }
+
+    IEvent<T>* get_mutable_event(temporal::Time time, bool exact) override
+    {
+        throw utils::NotImplementedException();
+    }
+};
+
+}
+}
+}
+}
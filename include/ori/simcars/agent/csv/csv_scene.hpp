@@ -22,7 +22,8 @@ class CSVScene : public virtual AFileBasedScene<CSVScene>
 
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
-    void load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names) override;
+    void load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names,
+                   utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings) override;
 
 public:
     static CSVScene* construct_from(IScene *scene);
@@ -1,13 +1,15 @@
 #pragma once
 
-#define ACTION_BACKED_ACCELERATION_THRESHOLD 2e-7f
-#define MIN_ALIGNED_LINEAR_VELOCITY_CHANGE_DURATION_THRESHOLD 1.0f
-#define MIN_ALIGNED_LINEAR_VELOCITY_DIFF_THRESHOLD 1e-3f
+#include <ori/simcars/geometry/defines.hpp>
 
-#define MIN_LANE_CHANGE_DURATION_THRESHOLD 2.5f
+#define ACTION_BACKED_ACCELERATION_THRESHOLD FP_DATA_TYPE(2e-7)
+#define MIN_ALIGNED_LINEAR_VELOCITY_CHANGE_DURATION_THRESHOLD FP_DATA_TYPE(1.0)
+#define MIN_ALIGNED_LINEAR_VELOCITY_DIFF_THRESHOLD FP_DATA_TYPE(1e-3)
 
-#define MAX_ALIGNED_LINEAR_VELOCITY 3.13e-2f
-#define MIN_ALIGNED_LINEAR_VELOCITY 0.0f
+#define MIN_LANE_CHANGE_DURATION_THRESHOLD FP_DATA_TYPE(2.5)
 
-#define MAX_ALIGNED_LINEAR_ACCELERATION 3.5e-6f
-#define MIN_ALIGNED_LINEAR_ACCELERATION -6.56e-6f
+#define MAX_ALIGNED_LINEAR_VELOCITY FP_DATA_TYPE(3.13e-2)
+#define MIN_ALIGNED_LINEAR_VELOCITY FP_DATA_TYPE(0.0)
+
+#define MAX_ALIGNED_LINEAR_ACCELERATION FP_DATA_TYPE(3.5e-6)
+#define MIN_ALIGNED_LINEAR_ACCELERATION FP_DATA_TYPE(-6.56e-6)
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <ori/simcars/structures/array_interface.hpp>
 #include <ori/simcars/agent/controller_interface.hpp>
 #include <ori/simcars/agent/driving_agent_state_interface.hpp>
+#include <ori/simcars/agent/driving_scene_state_buffer.hpp>
 
 namespace ori
 {
@@ -14,6 +16,10 @@ class IDrivingAgentController : public virtual IController
 {
 public:
     virtual void modify_driving_agent_state(agent::IReadOnlyDrivingAgentState const *original_state, agent::IDrivingAgentState *modified_state) const = 0;
+    virtual void modify_buffered_driving_agent_state(agent::DrivingSceneStateBuffer *state_buffer, size_t idx) const = 0;
+    // Same result as modifying each of the indexed states in turn, lanes are looked up for all of them at once
+    virtual void modify_buffered_driving_agent_states(agent::DrivingSceneStateBuffer *state_buffer,
+                                                      structures::IArray<size_t> const *idxs) const = 0;
 };
 
 }
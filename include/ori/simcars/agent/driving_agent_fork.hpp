@@ -0,0 +1,127 @@
+#pragma once
+
+#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/agent/driving_agent_abstract.hpp>
+#include <ori/simcars/agent/driving_scene_interface.hpp>
+
+#define FORKED_PARAMETER_BIN_COUNT 16
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Copy-on-write view of another driving agent. Parameters are read from the parent agent until they
+// are first accessed mutably, at which point the fork takes its own copy of that parameter alone.
+// The parent agent must outlive the fork and must not be modified while the fork exists.
+class DrivingAgentFork : public virtual ADrivingAgent
+{
+    IDrivingAgent const *parent_driving_agent;
+
+    // Kept so that parameters looked up by name can be resolved to handles without asking the parent for its name
+    std::string const name;
+
+    IDrivingScene const *driving_scene;
+
+    structures::stl::STLDictionary<ParameterHandle, IValuelessConstant*> forked_constant_dict;
+    structures::stl::STLDictionary<ParameterHandle, IValuelessVariable*> forked_variable_dict;
+
+    IValuelessConstant* fork_constant_parameter(ParameterHandle constant_handle,
+                                                IValuelessConstant const *parent_constant);
+    IValuelessVariable* fork_variable_parameter(ParameterHandle variable_handle,
+                                                IValuelessVariable const *parent_variable);
+
+public:
+    DrivingAgentFork(IDrivingAgent const *parent_driving_agent,
+                     IDrivingScene const *driving_scene = nullptr);
+    DrivingAgentFork(DrivingAgentFork const&) = delete;
+
+    ~DrivingAgentFork();
+
+    IDrivingAgent const* get_parent_driving_agent() const;
+
+    size_t get_forked_parameter_count() const;
+
+    std::string get_name() const override;
+
+    geometry::Vec get_min_spatial_limits() const override;
+    geometry::Vec get_max_spatial_limits() const override;
+
+    temporal::Time get_min_temporal_limit() const override;
+    temporal::Time get_max_temporal_limit() const override;
+
+    using ADrivingAgent::get_constant_parameter;
+    using ADrivingAgent::get_variable_parameter;
+    using ADrivingAgent::get_mutable_constant_parameter;
+    using ADrivingAgent::get_mutable_variable_parameter;
+
+    structures::IArray<IValuelessConstant const*>* get_constant_parameters() const override;
+    IValuelessConstant const* get_constant_parameter(std::string const &constant_name) const override;
+    IValuelessConstant const* get_constant_parameter(ParameterHandle constant_handle) const override;
+
+    structures::IArray<IValuelessVariable const*>* get_variable_parameters() const override;
+    IValuelessVariable const* get_variable_parameter(std::string const &variable_name) const override;
+    IValuelessVariable const* get_variable_parameter(ParameterHandle variable_handle) const override;
+
+    structures::IArray<IValuelessEvent const*>* get_events() const override;
+
+    IDrivingAgent* driving_agent_deep_copy(IDrivingScene *driving_scene = nullptr) const override;
+
+    IDrivingScene const* get_driving_scene() const override;
+
+    IConstant<uint32_t> const* get_id_constant() const override;
+    IConstant<bool> const* get_ego_constant() const override;
+    IConstant<FP_DATA_TYPE> const* get_bb_length_constant() const override;
+    IConstant<FP_DATA_TYPE> const* get_bb_width_constant() const override;
+    IConstant<DrivingAgentClass> const* get_driving_agent_class_constant() const override;
+
+    IVariable<geometry::Vec> const* get_position_variable() const override;
+    IVariable<geometry::Vec> const* get_linear_velocity_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_aligned_linear_velocity_variable() const override;
+    IVariable<geometry::Vec> const* get_linear_acceleration_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_aligned_linear_acceleration_variable() const override;
+    IVariable<geometry::Vec> const* get_external_linear_acceleration_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_rotation_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_steer_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_angular_velocity_variable() const override;
+    IVariable<temporal::Duration> const* get_ttc_variable() const override;
+    IVariable<temporal::Duration> const* get_cumilative_collision_time_variable() const override;
+
+
+    // Forks every parameter of the parent agent
+    structures::IArray<IValuelessConstant*>* get_mutable_constant_parameters() override;
+    IValuelessConstant* get_mutable_constant_parameter(std::string const &constant_name) override;
+    IValuelessConstant* get_mutable_constant_parameter(ParameterHandle constant_handle) override;
+
+    // Forks every parameter of the parent agent
+    structures::IArray<IValuelessVariable*>* get_mutable_variable_parameters() override;
+    IValuelessVariable* get_mutable_variable_parameter(std::string const &variable_name) override;
+    IValuelessVariable* get_mutable_variable_parameter(ParameterHandle variable_handle) override;
+
+    structures::IArray<IValuelessEvent*>* get_mutable_events() override;
+
+    // Forks only the parameter accessed
+    IConstant<uint32_t>* get_mutable_id_constant() override;
+    IConstant<bool>* get_mutable_ego_constant() override;
+    IConstant<FP_DATA_TYPE>* get_mutable_bb_length_constant() override;
+    IConstant<FP_DATA_TYPE>* get_mutable_bb_width_constant() override;
+    IConstant<DrivingAgentClass>* get_mutable_driving_agent_class_constant() override;
+
+    IVariable<geometry::Vec>* get_mutable_position_variable() override;
+    IVariable<geometry::Vec>* get_mutable_linear_velocity_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_aligned_linear_velocity_variable() override;
+    IVariable<geometry::Vec>* get_mutable_linear_acceleration_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_aligned_linear_acceleration_variable() override;
+    IVariable<geometry::Vec>* get_mutable_external_linear_acceleration_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_rotation_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_steer_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_angular_velocity_variable() override;
+    IVariable<temporal::Duration>* get_mutable_ttc_variable() override;
+    IVariable<temporal::Duration>* get_mutable_cumilative_collision_time_variable() override;
+};
+
+}
+}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <ori/simcars/structures/array_interface.hpp>
+#include <ori/simcars/temporal/typedefs.hpp>
+#include <ori/simcars/agent/driving_scene_state_buffer.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+class IDrivingAgentTTCCalculator
+{
+public:
+    virtual ~IDrivingAgentTTCCalculator() = default;
+
+    // Smallest time to collision between the buffered agent at the given index and any of the candidate agents,
+    // given the next states of the agents, or the limit if no collision is anticipated sooner
+    virtual temporal::Duration calc_smallest_buffered_ttc(
+            DrivingSceneStateBuffer const *state_buffer, size_t idx,
+            structures::IArray<size_t> const *candidate_indices, temporal::Duration ttc_limit) const = 0;
+};
+
+}
+}
+}
@@ -40,7 +40,7 @@ class DrivingGoalExtractionAgent : public virtual ADrivingAgent
                     new BasicVariable<Goal<FP_DATA_TYPE>>(
                         this->get_name(), "aligned_linear_velocity", IValuelessVariable::Type::GOAL, driving_scene->get_time_step());
 
-        temporal::Duration min_duration_threshold(temporal::DurationRep(1000.0 * MIN_ALIGNED_LINEAR_VELOCITY_CHANGE_DURATION_THRESHOLD));
+        temporal::Duration min_duration_threshold(temporal::DurationRep(FP_DATA_TYPE(1000) * MIN_ALIGNED_LINEAR_VELOCITY_CHANGE_DURATION_THRESHOLD));
 
         temporal::Time current_time;
         temporal::Time action_start_time = this->get_min_temporal_limit();
@@ -238,7 +238,7 @@ class DrivingGoalExtractionAgent : public virtual ADrivingAgent
     {
         IVariable<geometry::Vec> const *position_variable = this->get_position_variable();
 
-        temporal::Duration min_duration_threshold(temporal::DurationRep(1000.0 * MIN_LANE_CHANGE_DURATION_THRESHOLD));
+        temporal::Duration min_duration_threshold(temporal::DurationRep(FP_DATA_TYPE(1000) * MIN_LANE_CHANGE_DURATION_THRESHOLD));
 
         lane_goal_variable =
                     new BasicVariable<Goal<int32_t>>(
@@ -447,6 +447,10 @@ public:
     {
         return driving_agent->get_constant_parameter(constant_name);
     }
+    IValuelessConstant const* get_constant_parameter(ParameterHandle constant_handle) const override
+    {
+        return driving_agent->get_constant_parameter(constant_handle);
+    }
 
     structures::IArray<IValuelessVariable const*>* get_variable_parameters() const override
     {
@@ -513,6 +517,24 @@ public:
             return driving_agent->get_variable_parameter(variable_name);
         }
     }
+    IValuelessVariable const* get_variable_parameter(ParameterHandle variable_handle) const override
+    {
+        DrivingAgentParameterHandles const &handles =
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
+
+        if (variable_handle == handles.aligned_linear_velocity_goal)
+        {
+            return aligned_linear_velocity_goal_variable;
+        }
+        else if (variable_handle == handles.lane_goal)
+        {
+            return lane_goal_variable;
+        }
+        else
+        {
+            return driving_agent->get_variable_parameter(variable_handle);
+        }
+    }
 
     structures::IArray<IValuelessEvent const*>* get_events() const override
     {
@@ -657,6 +679,10 @@ public:
     {
         return driving_agent->get_mutable_constant_parameter(constant_name);
     }
+    IValuelessConstant* get_mutable_constant_parameter(ParameterHandle constant_handle) override
+    {
+        return driving_agent->get_mutable_constant_parameter(constant_handle);
+    }
 
     structures::IArray<IValuelessVariable*>* get_mutable_variable_parameters() override
     {
@@ -723,6 +749,24 @@ public:
             return driving_agent->get_mutable_variable_parameter(variable_name);
         }
     }
+    IValuelessVariable* get_mutable_variable_parameter(ParameterHandle variable_handle) override
+    {
+        DrivingAgentParameterHandles const &handles =
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
+
+        if (variable_handle == handles.aligned_linear_velocity_goal)
+        {
+            return aligned_linear_velocity_goal_variable;
+        }
+        else if (variable_handle == handles.lane_goal)
+        {
+            return lane_goal_variable;
+        }
+        else
+        {
+            return driving_agent->get_mutable_variable_parameter(variable_handle);
+        }
+    }
 
     structures::IArray<IValuelessEvent*>* get_mutable_events() override
     {
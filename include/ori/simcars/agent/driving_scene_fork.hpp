@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/agent/driving_scene_abstract.hpp>
+#include <ori/simcars/agent/driving_agent_fork.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Copy-on-write view of another driving scene, each agent of the parent scene is wrapped in a
+// DrivingAgentFork so only the parameters an intervention touches are ever copied. Deep copies of
+// a fork are forks of the same parent. The parent scene must outlive the fork (and any deep copies of
+// it) and must not be modified while they exist.
+class DrivingSceneFork : public virtual ADrivingScene
+{
+    IDrivingScene const *parent_driving_scene;
+
+    structures::stl::STLDictionary<std::string, IDrivingAgent*> driving_agent_dict;
+
+    DrivingSceneFork(IDrivingScene const *parent_driving_scene, size_t driving_agent_count);
+
+public:
+    ~DrivingSceneFork();
+
+    static DrivingSceneFork* construct_from(IDrivingScene const *parent_driving_scene);
+
+    IDrivingScene const* get_parent_driving_scene() const;
+
+    IDrivingScene* driving_scene_deep_copy() const override;
+
+    geometry::Vec get_min_spatial_limits() const override;
+    geometry::Vec get_max_spatial_limits() const override;
+
+    temporal::Duration get_time_step() const override;
+
+    temporal::Time get_min_temporal_limit() const override;
+    temporal::Time get_max_temporal_limit() const override;
+
+    structures::IArray<IDrivingAgent const*>* get_driving_agents() const override;
+    IDrivingAgent const* get_driving_agent(std::string const &driving_agent_name) const override;
+
+
+    structures::IArray<IDrivingAgent*>* get_mutable_driving_agents() override;
+    IDrivingAgent* get_mutable_driving_agent(std::string const &driving_agent_name) override;
+};
+
+}
+}
+}
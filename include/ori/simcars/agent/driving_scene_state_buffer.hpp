@@ -0,0 +1,109 @@
+#pragma once
+
+#include <ori/simcars/geometry/typedefs.hpp>
+#include <ori/simcars/geometry/o_box.hpp>
+#include <ori/simcars/temporal/typedefs.hpp>
+#include <ori/simcars/agent/read_only_driving_agent_state_interface.hpp>
+#include <ori/simcars/agent/driving_agent_state_interface.hpp>
+
+#include <vector>
+#include <cstdint>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Per agent values for a single point in time, stored as parallel arrays so that the same operation
+// can be applied across all agents in one pass
+class DrivingAgentStateColumns
+{
+public:
+    std::vector<FP_DATA_TYPE> position_xs;
+    std::vector<FP_DATA_TYPE> position_ys;
+    std::vector<FP_DATA_TYPE> linear_velocity_xs;
+    std::vector<FP_DATA_TYPE> linear_velocity_ys;
+    std::vector<FP_DATA_TYPE> aligned_linear_velocities;
+    std::vector<FP_DATA_TYPE> linear_acceleration_xs;
+    std::vector<FP_DATA_TYPE> linear_acceleration_ys;
+    std::vector<FP_DATA_TYPE> aligned_linear_accelerations;
+    std::vector<FP_DATA_TYPE> external_linear_acceleration_xs;
+    std::vector<FP_DATA_TYPE> external_linear_acceleration_ys;
+    std::vector<FP_DATA_TYPE> rotations;
+    std::vector<FP_DATA_TYPE> steers;
+    std::vector<FP_DATA_TYPE> angular_velocities;
+    std::vector<temporal::Duration> ttcs;
+    std::vector<temporal::Duration> cumilative_collision_times;
+
+    void resize(size_t count);
+
+    geometry::Vec get_position(size_t idx) const;
+    geometry::Vec get_linear_velocity(size_t idx) const;
+    geometry::Vec get_linear_acceleration(size_t idx) const;
+    geometry::Vec get_external_linear_acceleration(size_t idx) const;
+
+    void set_position(size_t idx, geometry::Vec const &position);
+    void set_linear_velocity(size_t idx, geometry::Vec const &linear_velocity);
+    void set_linear_acceleration(size_t idx, geometry::Vec const &linear_acceleration);
+    void set_external_linear_acceleration(size_t idx,
+                                          geometry::Vec const &external_linear_acceleration);
+};
+
+// Holds the current and next state of every agent in a scene for a single simulation time step, the
+// next state is only written back to the underlying agent states when committed
+class DrivingSceneStateBuffer
+{
+    std::vector<IReadOnlyDrivingAgentState const*> current_states;
+    std::vector<IDrivingAgentState*> next_states;
+
+public:
+    DrivingAgentStateColumns current;
+    DrivingAgentStateColumns next;
+
+    std::vector<FP_DATA_TYPE> bb_lengths;
+    std::vector<FP_DATA_TYPE> bb_widths;
+    std::vector<FP_DATA_TYPE> bb_half_spans;
+
+    // Bounding boxes of the next states along with their axis aligned half extents, computed once per agent per
+    // time step and only refreshed when an agent's next kinematics are simulated again
+    std::vector<geometry::OBox> bounding_boxes;
+    std::vector<FP_DATA_TYPE> aligned_bb_half_widths;
+    std::vector<FP_DATA_TYPE> aligned_bb_half_heights;
+
+    // Whether the next state was unpopulated, and thus needs to be simulated, at the start of the
+    // time step
+    std::vector<uint8_t> simulation_flags;
+
+    // Whether the next state is to be overwritten by simulated values when committed, this differs
+    // from the simulation flag once an agent following recorded values has been pushed off course
+    std::vector<uint8_t> commit_flags;
+
+    // Scratch space for kinematics passes
+    std::vector<FP_DATA_TYPE> rotation_coss;
+    std::vector<FP_DATA_TYPE> rotation_sins;
+    std::vector<FP_DATA_TYPE> inverse_rotation_coss;
+    std::vector<FP_DATA_TYPE> inverse_rotation_sins;
+
+    size_t count() const;
+    IReadOnlyDrivingAgentState const* get_current_state(size_t idx) const;
+    IDrivingAgentState* get_next_state(size_t idx) const;
+
+    void clear();
+    size_t push_back(IReadOnlyDrivingAgentState const *current_state,
+                     IDrivingAgentState *next_state);
+    void load_states(size_t idx);
+    void load_current_state(size_t idx);
+    void load_next_actuation(size_t idx);
+    // Requires the rotation scratch space to hold the next rotation
+    void update_bounding_box(size_t idx);
+    bool check_aligned_bounding_box_overlap(size_t idx_1, size_t idx_2) const;
+
+    void commit_next_kinematics(size_t idx) const;
+    void commit_next_collision_state(size_t idx) const;
+};
+
+}
+}
+}
@@ -65,9 +65,11 @@ public:
 
     structures::IArray<IValuelessConstant const*>* get_constant_parameters() const override;
     IValuelessConstant const* get_constant_parameter(std::string const &constant_name) const override;
+    IValuelessConstant const* get_constant_parameter(ParameterHandle constant_handle) const override;
 
     structures::IArray<IValuelessVariable const*>* get_variable_parameters() const override;
     IValuelessVariable const* get_variable_parameter(std::string const &variable_name) const override;
+    IValuelessVariable const* get_variable_parameter(ParameterHandle variable_handle) const override;
 
     structures::IArray<IValuelessEvent const*>* get_events() const override;
 
@@ -98,9 +100,11 @@ public:
 
     structures::IArray<IValuelessConstant*>* get_mutable_constant_parameters() override;
     IValuelessConstant* get_mutable_constant_parameter(std::string const &constant_name) override;
+    IValuelessConstant* get_mutable_constant_parameter(ParameterHandle constant_handle) override;
 
     structures::IArray<IValuelessVariable*>* get_mutable_variable_parameters() override;
     IValuelessVariable* get_mutable_variable_parameter(std::string const &variable_name) override;
+    IValuelessVariable* get_mutable_variable_parameter(ParameterHandle variable_handle) override;
 
     structures::IArray<IValuelessEvent*>* get_mutable_events() override;
 
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ori/simcars/structures/array_interface.hpp>
+#include <ori/simcars/utils/work_stealing_thread_pool.hpp>
+#include <ori/simcars/temporal/typedefs.hpp>
+#include <ori/simcars/agent/driving_simulation_scene_interface.hpp>
+
+#include <vector>
+#include <chrono>
+#include <functional>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Constructs a simulation scene for one run of a batch, typically by deep copying a shared scene and
+// applying an intervention to the copy
+typedef std::function<IDrivingSimulationScene*()> DrivingSimulationSceneBuilder;
+
+class DrivingSimulationBatchResult
+{
+public:
+    // Wall time taken by each scene of the batch, including construction for built scenes
+    std::vector<std::chrono::microseconds> scene_wall_times;
+
+    // Wall time taken by the batch as a whole
+    std::chrono::microseconds wall_time;
+
+    // Simulated time summed across all scenes of the batch
+    temporal::Duration simulated_time;
+
+    float get_real_time_factor() const;
+};
+
+// Simulates independent scenes concurrently across a pool of worker threads, scenes must not share
+// any mutable state (a single simulator may be shared, as simulators are const)
+class DrivingSimulationBatchRunner
+{
+    utils::WorkStealingThreadPool *thread_pool;
+
+public:
+    // A thread count of zero uses one thread per hardware thread
+    DrivingSimulationBatchRunner(size_t thread_count = 0);
+    DrivingSimulationBatchRunner(DrivingSimulationBatchRunner const&) = delete;
+
+    ~DrivingSimulationBatchRunner();
+
+    size_t get_thread_count() const;
+
+    DrivingSimulationBatchResult run(
+            structures::IArray<IDrivingSimulationScene*> *simulation_scenes,
+            temporal::Time simulation_start_time, temporal::Time simulation_end_time) const;
+
+    // Built scenes are written to the corresponding index of simulation_scenes and are owned by the
+    // caller
+    DrivingSimulationBatchResult run(
+            std::vector<DrivingSimulationSceneBuilder> const &simulation_scene_builders,
+            structures::IArray<IDrivingSimulationScene*> *simulation_scenes,
+            temporal::Time simulation_start_time, temporal::Time simulation_end_time) const;
+};
+
+}
+}
+}
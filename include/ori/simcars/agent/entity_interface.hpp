@@ -6,6 +6,7 @@
 #include <ori/simcars/agent/valueless_constant_interface.hpp>
 #include <ori/simcars/agent/valueless_variable_interface.hpp>
 #include <ori/simcars/agent/entity_state_interface.hpp>
+#include <ori/simcars/agent/parameter_registry.hpp>
 #include <ori/simcars/agent/scene_interface.hpp>
 
 namespace ori
@@ -37,9 +38,11 @@ public:
 
     virtual structures::IArray<IValuelessConstant const*>* get_constant_parameters() const = 0;
     virtual IValuelessConstant const* get_constant_parameter(std::string const &constant_name) const = 0;
+    virtual IValuelessConstant const* get_constant_parameter(ParameterHandle constant_handle) const = 0;
 
     virtual structures::IArray<IValuelessVariable const*>* get_variable_parameters() const = 0;
     virtual IValuelessVariable const* get_variable_parameter(std::string const &variable_name) const = 0;
+    virtual IValuelessVariable const* get_variable_parameter(ParameterHandle variable_handle) const = 0;
 
     virtual structures::IArray<IValuelessEvent const*>* get_events() const = 0;
 
@@ -48,9 +51,11 @@ public:
 
     virtual structures::IArray<IValuelessConstant*>* get_mutable_constant_parameters() = 0;
     virtual IValuelessConstant* get_mutable_constant_parameter(std::string const &constant_name) = 0;
+    virtual IValuelessConstant* get_mutable_constant_parameter(ParameterHandle constant_handle) = 0;
 
     virtual structures::IArray<IValuelessVariable*>* get_mutable_variable_parameters() = 0;
     virtual IValuelessVariable* get_mutable_variable_parameter(std::string const &variable_name) = 0;
+    virtual IValuelessVariable* get_mutable_variable_parameter(ParameterHandle variable_handle) = 0;
 
     virtual structures::IArray<IValuelessEvent*>* get_mutable_events() = 0;
 
@@ -14,6 +14,7 @@ class IEntityState : public virtual IReadOnlyEntityState
 public:
     virtual structures::IArray<IValuelessConstant*>* get_mutable_parameter_values() = 0;
     virtual IValuelessConstant* get_mutable_parameter_value(std::string const &parameter_name) = 0;
+    virtual IValuelessConstant* get_mutable_parameter_value(ParameterHandle parameter_handle) = 0;
 };
 
 }
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <ori/simcars/temporal/temporal_series.hpp>
+#include <ori/simcars/agent/valueless_variable_interface.hpp>
+#include <ori/simcars/agent/event_abstract.hpp>
+#include <ori/simcars/agent/basic_event.hpp>
+
+#include <deque>
+#include <vector>
+#include <cstdint>
+
+#define NULL_EVENT_INDEX SIZE_MAX
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+typedef size_t EventIndex;
+
+// Event owned by an event arena, names are taken from the variable owning the arena rather than being
+// stored per event
+template <typename T>
+class ArenaEvent : public virtual AEvent<T>
+{
+    IValuelessVariable const *variable;
+
+    T value;
+    temporal::Time time;
+
+public:
+    ArenaEvent(IValuelessVariable const *variable, T const &value, temporal::Time time) :
+        variable(variable), value(value), time(time) {}
+
+    IConstant<T>* constant_shallow_copy() const override
+    {
+        return this->event_shallow_copy();
+    }
+
+    IEvent<T>* event_shallow_copy() const override
+    {
+        return new BasicEvent<T>(variable->get_entity_name(), variable->get_parameter_name(), value,
+                                 time);
+    }
+
+    T const& get_value() const override
+    {
+        return value;
+    }
+
+    std::string get_entity_name() const override
+    {
+        return variable->get_entity_name();
+    }
+
+    std::string get_parameter_name() const override
+    {
+        return variable->get_parameter_name();
+    }
+
+    temporal::Time get_time() const override
+    {
+        return time;
+    }
+
+    void set_value(T const &value) override
+    {
+        this->value = value;
+    }
+};
+
+// Stores the events of a single variable in contiguous blocks instead of allocating each separately.
+// Events are only ever freed together with the arena, so an event index (and a pointer to the event)
+// remains valid for the lifetime of the arena, even once the event has been removed from its variable.
+// Copies of the arena only take the events its variable still indexes, so removed events are reclaimed
+// whenever the variable is deep copied.
+template <typename T>
+class EventArena
+{
+    IValuelessVariable const *variable;
+
+    std::deque<ArenaEvent<T>> events;
+
+public:
+    EventArena(IValuelessVariable const *variable) : variable(variable) {}
+    // The given series is the copy of the variable's series made for the new arena, its indices are remapped to
+    // those of the copied events, which keep their order
+    EventArena(EventArena<T> const &event_arena, IValuelessVariable const *variable,
+               temporal::TemporalSeries<EventIndex> &time_event_dict) :
+        variable(variable)
+    {
+        std::vector<bool> live_flags(event_arena.events.size(), false);
+        std::vector<EventIndex> copied_indices(event_arena.events.size(), NULL_EVENT_INDEX);
+
+        size_t i;
+        for (i = 0; i < time_event_dict.get_run_count(); ++i)
+        {
+            EventIndex const index = time_event_dict.get_run_value(i);
+            if (index != NULL_EVENT_INDEX)
+            {
+                live_flags[index] = true;
+            }
+        }
+
+        for (i = 0; i < live_flags.size(); ++i)
+        {
+            if (live_flags[i])
+            {
+                ArenaEvent<T> const &event = event_arena.events[i];
+                copied_indices[i] = events.size();
+                events.emplace_back(variable, event.get_value(), event.get_time());
+            }
+        }
+
+        time_event_dict.remap_values(
+                    [&copied_indices](EventIndex index)
+                    {
+                        return copied_indices[index];
+                    });
+    }
+    EventArena(EventArena<T> const&) = delete;
+
+    size_t count() const
+    {
+        return events.size();
+    }
+
+    ArenaEvent<T> const& operator [](EventIndex index) const
+    {
+        return events[index];
+    }
+    ArenaEvent<T>& operator [](EventIndex index)
+    {
+        return events[index];
+    }
+
+    EventIndex push_back(T const &value, temporal::Time time)
+    {
+        events.emplace_back(variable, value, time);
+        return events.size() - 1;
+    }
+};
+
+}
+}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <ori/simcars/agent/driving_agent_ttc_calculator_interface.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Anticipates a collision when the relative velocity of a pair of agents points within a cone about the line
+// between their centres, the cone being wide enough to take in the span of the other agent, and takes the time to
+// close the distance between the centres as the time to collision
+class HeuristicDrivingAgentTTCCalculator : public virtual IDrivingAgentTTCCalculator
+{
+public:
+    temporal::Duration calc_smallest_buffered_ttc(
+            DrivingSceneStateBuffer const *state_buffer, size_t idx,
+            structures::IArray<size_t> const *candidate_indices, temporal::Duration ttc_limit) const override;
+};
+
+}
+}
+}
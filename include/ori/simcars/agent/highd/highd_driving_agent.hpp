@@ -2,6 +2,7 @@
 
 #include <ori/simcars/structures/stl/stl_dictionary.hpp>
 #include <ori/simcars/agent/driving_agent_abstract.hpp>
+#include <ori/simcars/agent/highd/highd_tracks.hpp>
 
 #include <rapidcsv.h>
 
@@ -47,7 +48,7 @@ protected:
 public:
     HighDDrivingAgent(IDrivingScene const *driving_scene, size_t tracks_meta_row,
                       rapidcsv::Document const &tracks_meta_csv_document,
-                      rapidcsv::Document const &tracks_csv_document);
+                      HighDTracks const &tracks);
 
     ~HighDDrivingAgent();
 
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ori/simcars/structures/set_interface.hpp>
+#include <ori/simcars/agent/lazy_driving_agent_source_interface.hpp>
+#include <ori/simcars/agent/highd/highd_tracks.hpp>
+
+#include <rapidcsv.h>
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace highd
+{
+
+// Indexes a HighD recording once, keeping only its typed columns around, so that agents can be decoded one at a
+// time by a LazyDrivingScene
+class HighDLazyDrivingAgentSource : public virtual ILazyDrivingAgentSource
+{
+    rapidcsv::Document tracks_meta_csv_document;
+    HighDTracks tracks;
+
+    std::vector<size_t> tracks_meta_rows;
+    std::vector<LazyDrivingAgentEntry> driving_agent_entries;
+
+    HighDLazyDrivingAgentSource(std::ifstream &input_filestream_1, std::ifstream &input_filestream_2,
+                                structures::ISet<std::string>* agent_names);
+
+public:
+    static std::shared_ptr<HighDLazyDrivingAgentSource const> load(std::string const &input_file_1_path_str,
+                                                                   std::string const &input_file_2_path_str,
+                                                                   structures::ISet<std::string>* agent_names = nullptr);
+
+    temporal::Duration get_time_step() const override;
+
+    size_t get_driving_agent_count() const override;
+    LazyDrivingAgentEntry const& get_driving_agent_entry(size_t driving_agent_idx) const override;
+
+    IDrivingAgent* load_driving_agent(IDrivingScene const *driving_scene, size_t driving_agent_idx) const override;
+};
+
+}
+}
+}
+}
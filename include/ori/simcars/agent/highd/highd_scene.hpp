@@ -25,7 +25,8 @@ class HighDScene : public virtual ATwoFileBasedScene<HighDScene>, public virtual
 protected:
     void save_virt(std::ofstream &output_filestream_1, std::ofstream &output_filestream_2) const override;
     void load_virt(std::ifstream &input_filestream_1, std::ifstream &input_filestream_2,
-                   structures::ISet<std::string>* agent_names) override;
+                   structures::ISet<std::string>* agent_names,
+                   utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings) override;
 
 public:
     ~HighDScene();
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/geometry/defines.hpp>
+
+#include <rapidcsv.h>
+
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace highd
+{
+
+// Columns of a HighD tracks file converted once up front, along with an index of the rows belonging to
+// each agent id, so agents can be constructed without scanning the file or looking columns up by name
+class HighDTracks
+{
+    std::vector<FP_DATA_TYPE> position_x_column;
+    std::vector<FP_DATA_TYPE> position_y_column;
+    std::vector<FP_DATA_TYPE> linear_velocity_x_column;
+    std::vector<FP_DATA_TYPE> linear_velocity_y_column;
+    std::vector<FP_DATA_TYPE> linear_acceleration_x_column;
+    std::vector<FP_DATA_TYPE> linear_acceleration_y_column;
+    std::vector<FP_DATA_TYPE> ttc_column;
+
+    structures::stl::STLDictionary<uint32_t, size_t> id_start_row_dict;
+    structures::stl::STLDictionary<uint32_t, size_t> id_end_row_dict;
+
+public:
+    HighDTracks(rapidcsv::Document const &tracks_csv_document);
+
+    // Rows of an agent are [start_row, end_row)
+    bool get_rows(uint32_t id, size_t &start_row, size_t &end_row) const;
+
+    FP_DATA_TYPE get_position_x(size_t row) const;
+    FP_DATA_TYPE get_position_y(size_t row) const;
+    FP_DATA_TYPE get_linear_velocity_x(size_t row) const;
+    FP_DATA_TYPE get_linear_velocity_y(size_t row) const;
+    FP_DATA_TYPE get_linear_acceleration_x(size_t row) const;
+    FP_DATA_TYPE get_linear_acceleration_y(size_t row) const;
+    FP_DATA_TYPE get_ttc(size_t row) const;
+};
+
+}
+}
+}
+}
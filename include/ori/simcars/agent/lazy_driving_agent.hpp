@@ -0,0 +1,133 @@
+#pragma once
+
+#include <ori/simcars/agent/driving_agent_abstract.hpp>
+#include <ori/simcars/agent/lazy_driving_agent_source_interface.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+class LazyDrivingScene;
+
+// Stand-in for an agent of a LazyDrivingScene, its name and limits come from the index of the recording, anything
+// else has the scene decode the agent first and holds it for the life of the scene. Accessing the agent mutably pins
+// it, so modifications are never lost to eviction. Reading an agent through a LazyDrivingAgentBorrow instead allows
+// it to be evicted once the borrow goes out of scope.
+class LazyDrivingAgent : public virtual ADrivingAgent
+{
+    LazyDrivingScene const *driving_scene;
+    size_t driving_agent_idx;
+    LazyDrivingAgentEntry const *driving_agent_entry;
+
+    IDrivingAgent const* get_materialised_driving_agent() const;
+    IDrivingAgent* get_mutable_materialised_driving_agent();
+
+    IDrivingAgent const* borrow() const;
+    void release() const;
+
+    friend class LazyDrivingAgentBorrow;
+
+public:
+    LazyDrivingAgent(LazyDrivingScene const *driving_scene, size_t driving_agent_idx,
+                     LazyDrivingAgentEntry const *driving_agent_entry);
+    LazyDrivingAgent(LazyDrivingAgent const&) = delete;
+
+    bool is_materialised() const;
+
+    std::string get_name() const override;
+
+    geometry::Vec get_min_spatial_limits() const override;
+    geometry::Vec get_max_spatial_limits() const override;
+
+    temporal::Time get_min_temporal_limit() const override;
+    temporal::Time get_max_temporal_limit() const override;
+
+    using ADrivingAgent::get_constant_parameter;
+    using ADrivingAgent::get_variable_parameter;
+    using ADrivingAgent::get_mutable_constant_parameter;
+    using ADrivingAgent::get_mutable_variable_parameter;
+
+    structures::IArray<IValuelessConstant const*>* get_constant_parameters() const override;
+    IValuelessConstant const* get_constant_parameter(std::string const &constant_name) const override;
+    IValuelessConstant const* get_constant_parameter(ParameterHandle constant_handle) const override;
+
+    structures::IArray<IValuelessVariable const*>* get_variable_parameters() const override;
+    IValuelessVariable const* get_variable_parameter(std::string const &variable_name) const override;
+    IValuelessVariable const* get_variable_parameter(ParameterHandle variable_handle) const override;
+
+    structures::IArray<IValuelessEvent const*>* get_events() const override;
+
+    IDrivingAgent* driving_agent_deep_copy(IDrivingScene *driving_scene = nullptr) const override;
+
+    IDrivingScene const* get_driving_scene() const override;
+
+    IConstant<uint32_t> const* get_id_constant() const override;
+    IConstant<bool> const* get_ego_constant() const override;
+    IConstant<FP_DATA_TYPE> const* get_bb_length_constant() const override;
+    IConstant<FP_DATA_TYPE> const* get_bb_width_constant() const override;
+    IConstant<DrivingAgentClass> const* get_driving_agent_class_constant() const override;
+
+    IVariable<geometry::Vec> const* get_position_variable() const override;
+    IVariable<geometry::Vec> const* get_linear_velocity_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_aligned_linear_velocity_variable() const override;
+    IVariable<geometry::Vec> const* get_linear_acceleration_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_aligned_linear_acceleration_variable() const override;
+    IVariable<geometry::Vec> const* get_external_linear_acceleration_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_rotation_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_steer_variable() const override;
+    IVariable<FP_DATA_TYPE> const* get_angular_velocity_variable() const override;
+    IVariable<temporal::Duration> const* get_ttc_variable() const override;
+    IVariable<temporal::Duration> const* get_cumilative_collision_time_variable() const override;
+
+
+    structures::IArray<IValuelessConstant*>* get_mutable_constant_parameters() override;
+    IValuelessConstant* get_mutable_constant_parameter(std::string const &constant_name) override;
+    IValuelessConstant* get_mutable_constant_parameter(ParameterHandle constant_handle) override;
+
+    structures::IArray<IValuelessVariable*>* get_mutable_variable_parameters() override;
+    IValuelessVariable* get_mutable_variable_parameter(std::string const &variable_name) override;
+    IValuelessVariable* get_mutable_variable_parameter(ParameterHandle variable_handle) override;
+
+    structures::IArray<IValuelessEvent*>* get_mutable_events() override;
+
+    IConstant<uint32_t>* get_mutable_id_constant() override;
+    IConstant<bool>* get_mutable_ego_constant() override;
+    IConstant<FP_DATA_TYPE>* get_mutable_bb_length_constant() override;
+    IConstant<FP_DATA_TYPE>* get_mutable_bb_width_constant() override;
+    IConstant<DrivingAgentClass>* get_mutable_driving_agent_class_constant() override;
+
+    IVariable<geometry::Vec>* get_mutable_position_variable() override;
+    IVariable<geometry::Vec>* get_mutable_linear_velocity_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_aligned_linear_velocity_variable() override;
+    IVariable<geometry::Vec>* get_mutable_linear_acceleration_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_aligned_linear_acceleration_variable() override;
+    IVariable<geometry::Vec>* get_mutable_external_linear_acceleration_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_rotation_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_steer_variable() override;
+    IVariable<FP_DATA_TYPE>* get_mutable_angular_velocity_variable() override;
+    IVariable<temporal::Duration>* get_mutable_ttc_variable() override;
+    IVariable<temporal::Duration>* get_mutable_cumilative_collision_time_variable() override;
+};
+
+// Borrows an agent of a LazyDrivingScene for as long as it is in scope, decoding it if need be. Anything obtained
+// through the borrow is only valid while it is in scope, as the agent may be evicted once every borrow of it is gone.
+class LazyDrivingAgentBorrow
+{
+    LazyDrivingAgent const *driving_agent;
+    IDrivingAgent const *materialised_driving_agent;
+
+public:
+    LazyDrivingAgentBorrow(LazyDrivingAgent const *driving_agent);
+    LazyDrivingAgentBorrow(LazyDrivingAgentBorrow const&) = delete;
+
+    ~LazyDrivingAgentBorrow();
+
+    IDrivingAgent const* get_driving_agent() const;
+};
+
+}
+}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ori/simcars/geometry/typedefs.hpp>
+#include <ori/simcars/temporal/typedefs.hpp>
+#include <ori/simcars/agent/driving_agent_interface.hpp>
+
+#include <string>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Everything about an agent that is known from indexing a recording, without decoding its history
+class LazyDrivingAgentEntry
+{
+public:
+    std::string name;
+
+    geometry::Vec min_spatial_limits, max_spatial_limits;
+    temporal::Time min_temporal_limit, max_temporal_limit;
+
+    size_t frame_count;
+};
+
+// Recording that has been indexed up front, so any one of its agents can be decoded on its own
+class ILazyDrivingAgentSource
+{
+public:
+    virtual ~ILazyDrivingAgentSource() = default;
+
+    virtual temporal::Duration get_time_step() const = 0;
+
+    virtual size_t get_driving_agent_count() const = 0;
+    virtual LazyDrivingAgentEntry const& get_driving_agent_entry(size_t driving_agent_idx) const = 0;
+
+    // Must be safe to call concurrently, the returned agent is owned by the caller
+    virtual IDrivingAgent* load_driving_agent(IDrivingScene const *driving_scene, size_t driving_agent_idx) const = 0;
+};
+
+}
+}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <ori/simcars/structures/stl/stl_dictionary.hpp>
+#include <ori/simcars/agent/driving_scene_abstract.hpp>
+#include <ori/simcars/agent/lazy_driving_agent_source_interface.hpp>
+#include <ori/simcars/agent/lazy_driving_agent.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <list>
+
+// Rough memory taken up by a decoded agent per frame of its history, used to account against the memory budget
+#define LAZY_DRIVING_AGENT_BYTES_PER_FRAME 128
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Driving scene over an indexed recording, agents are only decoded when first accessed beyond their name and
+// limits. Agents are counted as borrowed for as long as any LazyDrivingAgentBorrow of them is in scope, and once
+// decoded agents exceed the memory budget the least recently borrowed agents that are no longer borrowed are evicted.
+// Agents accessed directly rather than through a borrow are held for the life of the scene, as variables, constants
+// and events obtained from them may still be held anywhere, including other threads. Agents accessed mutably are
+// never evicted either. Deep copies share the source and carry over agents that were accessed mutably.
+class LazyDrivingScene : public virtual ADrivingScene
+{
+    std::shared_ptr<ILazyDrivingAgentSource const> driving_agent_source;
+    size_t memory_budget;
+
+    geometry::Vec min_spatial_limits, max_spatial_limits;
+    temporal::Time min_temporal_limit, max_temporal_limit;
+
+    std::vector<LazyDrivingAgent*> driving_agents;
+    structures::stl::STLDictionary<std::string, LazyDrivingAgent*> driving_agent_dict;
+
+    mutable std::mutex materialised_driving_agents_mutex;
+    mutable std::vector<IDrivingAgent*> materialised_driving_agents;
+    mutable std::vector<bool> pinned_driving_agents;
+    mutable std::vector<bool> held_driving_agents;
+    mutable std::vector<size_t> driving_agent_borrow_counts;
+    mutable size_t materialised_size;
+
+    // Materialised agents which are neither pinned, held nor borrowed, least recently borrowed first
+    mutable std::list<size_t> eviction_queue;
+    mutable std::vector<std::list<size_t>::iterator> eviction_queue_itrs;
+
+    LazyDrivingScene(std::shared_ptr<ILazyDrivingAgentSource const> const &driving_agent_source,
+                     size_t memory_budget);
+
+    enum class MaterialiseMode
+    {
+        BORROW,
+        HOLD,
+        PIN
+    };
+
+    size_t get_driving_agent_size(size_t driving_agent_idx) const;
+
+    // Must be called with the materialised agents mutex held
+    bool is_driving_agent_evictable(size_t driving_agent_idx) const;
+    void mark_driving_agent(size_t driving_agent_idx, MaterialiseMode mode) const;
+
+    IDrivingAgent* materialise_driving_agent(size_t driving_agent_idx, MaterialiseMode mode) const;
+    void release_driving_agent(size_t driving_agent_idx) const;
+    bool is_driving_agent_materialised(size_t driving_agent_idx) const;
+
+    friend class LazyDrivingAgent;
+
+public:
+    ~LazyDrivingScene();
+
+    // A memory budget of zero never evicts agents
+    static LazyDrivingScene* construct_from(
+            std::shared_ptr<ILazyDrivingAgentSource const> const &driving_agent_source, size_t memory_budget = 0);
+
+    std::shared_ptr<ILazyDrivingAgentSource const> get_driving_agent_source() const;
+
+    size_t get_memory_budget() const;
+    size_t get_materialised_size() const;
+    size_t get_materialised_driving_agent_count() const;
+
+    IDrivingScene* driving_scene_deep_copy() const override;
+
+    geometry::Vec get_min_spatial_limits() const override;
+    geometry::Vec get_max_spatial_limits() const override;
+
+    temporal::Duration get_time_step() const override;
+
+    temporal::Time get_min_temporal_limit() const override;
+    temporal::Time get_max_temporal_limit() const override;
+
+    structures::IArray<IDrivingAgent const*>* get_driving_agents() const override;
+    IDrivingAgent const* get_driving_agent(std::string const &driving_agent_name) const override;
+
+
+    structures::IArray<IDrivingAgent*>* get_mutable_driving_agents() override;
+    IDrivingAgent* get_mutable_driving_agent(std::string const &driving_agent_name) override;
+};
+
+}
+}
+}
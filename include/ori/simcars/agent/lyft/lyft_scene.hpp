@@ -24,7 +24,8 @@ class LyftScene : public virtual AFileBasedScene<LyftScene>, public virtual ADri
 
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
-    void load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names) override;
+    void load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names,
+                   utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings) override;
 
 public:
     ~LyftScene();
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Identifies a parameter name (e.g. "position.base") independently of the entity it belongs to
+typedef uint32_t ParameterHandle;
+
+class DrivingAgentParameterHandles
+{
+public:
+    ParameterHandle id;
+    ParameterHandle ego;
+    ParameterHandle bb_length;
+    ParameterHandle bb_width;
+    ParameterHandle driving_agent_class;
+    ParameterHandle position;
+    ParameterHandle linear_velocity;
+    ParameterHandle aligned_linear_velocity;
+    ParameterHandle linear_acceleration;
+    ParameterHandle aligned_linear_acceleration;
+    ParameterHandle external_linear_acceleration;
+    ParameterHandle rotation;
+    ParameterHandle steer;
+    ParameterHandle angular_velocity;
+    ParameterHandle ttc;
+    ParameterHandle cumilative_collision_time;
+    ParameterHandle aligned_linear_velocity_goal;
+    ParameterHandle lane_goal;
+};
+
+// Interns parameter names to compact integer handles, handles are never invalidated so they can be
+// resolved once and then used for any number of lookups without building or hashing strings
+class ParameterRegistry
+{
+    mutable std::shared_mutex names_mutex;
+    std::deque<std::string> parameter_names;
+    std::unordered_map<std::string_view, ParameterHandle> parameter_handles;
+
+    DrivingAgentParameterHandles driving_agent_parameter_handles;
+
+    ParameterRegistry();
+    ParameterRegistry(ParameterRegistry const&) = delete;
+    ParameterRegistry(ParameterRegistry&&) = delete;
+
+public:
+    static ParameterRegistry* get_instance();
+
+    size_t count() const;
+
+    ParameterHandle intern(std::string const &parameter_name);
+    bool get_handle(std::string_view parameter_name, ParameterHandle &parameter_handle) const;
+    bool get_handle(std::string const &entity_name, std::string const &full_name,
+                    ParameterHandle &parameter_handle) const;
+
+    std::string const& get_parameter_name(ParameterHandle parameter_handle) const;
+    std::string get_full_name(std::string const &entity_name, ParameterHandle parameter_handle) const;
+
+    DrivingAgentParameterHandles const& get_driving_agent_parameter_handles() const;
+};
+
+}
+}
+}
@@ -25,7 +25,8 @@ class PLGScene : public virtual AFileBasedScene<PLGScene>, public virtual ADrivi
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
     void load_virt(std::ifstream &input_filestream,
-                   structures::ISet<std::string>* agent_names) override;
+                   structures::ISet<std::string>* agent_names,
+                   utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings) override;
 
 public:
     ~PLGScene();
@@ -2,6 +2,7 @@
 
 #include <ori/simcars/temporal/typedefs.hpp>
 #include <ori/simcars/agent/valueless_constant_interface.hpp>
+#include <ori/simcars/agent/parameter_registry.hpp>
 
 namespace ori
 {
@@ -22,6 +23,7 @@ public:
 
     virtual structures::IArray<IValuelessConstant const*>* get_parameter_values() const = 0;
     virtual IValuelessConstant const* get_parameter_value(std::string const &parameter_name) const = 0;
+    virtual IValuelessConstant const* get_parameter_value(ParameterHandle parameter_handle) const = 0;
 };
 
 }
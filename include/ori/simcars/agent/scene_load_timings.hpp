@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+class SceneLoadTimings
+{
+public:
+    // Wall time spent reading and indexing the input files
+    std::chrono::microseconds parse_time = std::chrono::microseconds::zero();
+
+    // Wall time spent constructing agents, for formats whose agents are constructed while the input is still being
+    // parsed, this only covers construction not overlapped by parsing
+    std::chrono::microseconds construction_time = std::chrono::microseconds::zero();
+
+    // Wall time spent inserting agents into the scene and computing the scene limits
+    std::chrono::microseconds merge_time = std::chrono::microseconds::zero();
+
+    // Wall time taken by the load as a whole
+    std::chrono::microseconds total_time = std::chrono::microseconds::zero();
+};
+
+}
+}
+}
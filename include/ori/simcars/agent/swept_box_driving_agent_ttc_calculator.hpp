@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ori/simcars/agent/driving_agent_ttc_calculator_interface.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Takes the time to collision as the earliest time at which the bounding boxes of a pair of agents touch, with
+// each agent keeping its velocity and orientation
+class SweptBoxDrivingAgentTTCCalculator : public virtual IDrivingAgentTTCCalculator
+{
+public:
+    temporal::Duration calc_smallest_buffered_ttc(
+            DrivingSceneStateBuffer const *state_buffer, size_t idx,
+            structures::IArray<size_t> const *candidate_indices, temporal::Duration ttc_limit) const override;
+};
+
+}
+}
+}
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <ori/simcars/utils/exceptions.hpp>
+#include <ori/simcars/utils/work_stealing_thread_pool.hpp>
 #include <ori/simcars/structures/set_interface.hpp>
 #include <ori/simcars/agent/two_file_based_scene_interface.hpp>
+#include <ori/simcars/agent/scene_load_timings.hpp>
 
 #include <fstream>
 #include <filesystem>
+#include <chrono>
 
 namespace ori
 {
@@ -21,8 +24,10 @@ protected:
     ATwoFileBasedScene() = default;
 
     virtual void save_virt(std::ofstream &output_filestream_1, std::ofstream &output_filestream_2) const = 0;
+    // Agents are constructed across the thread pool when one is given, timings are only recorded when given
     virtual void load_virt(std::ifstream &input_filestream_1, std::ifstream &input_filestream_2,
-                           structures::ISet<std::string>* agent_names) = 0;
+                           structures::ISet<std::string>* agent_names,
+                           utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings) = 0;
 
 public:
     ~ATwoFileBasedScene() override
@@ -54,8 +59,13 @@ public:
     }
 
     static T_scene* load(std::string const &input_file_1_path_str, std::string const &input_file_2_path_str,
-                               structures::ISet<std::string>* agent_names = nullptr)
+                               structures::ISet<std::string>* agent_names = nullptr,
+                               utils::WorkStealingThreadPool *thread_pool = nullptr,
+                               SceneLoadTimings *load_timings = nullptr)
     {
+        std::chrono::time_point<std::chrono::high_resolution_clock> start_time =
+                std::chrono::high_resolution_clock::now();
+
         std::filesystem::path input_file_1_path(input_file_1_path_str);
 
         if (!std::filesystem::is_regular_file(input_file_1_path))
@@ -76,7 +86,13 @@ public:
 
         ATwoFileBasedScene<T_scene> *scene = new T_scene;
 
-        scene->load_virt(input_filestream_1, input_filestream_2, agent_names);
+        scene->load_virt(input_filestream_1, input_filestream_2, agent_names, thread_pool, load_timings);
+
+        if (load_timings != nullptr)
+        {
+            load_timings->total_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::high_resolution_clock::now() - start_time);
+        }
 
         return dynamic_cast<T_scene*>(scene);
     }
@@ -25,6 +25,7 @@ public:
 
     structures::IArray<IValuelessConstant const*>* get_parameter_values() const override;
     IValuelessConstant const* get_parameter_value(std::string const &parameter_name) const override;
+    IValuelessConstant const* get_parameter_value(ParameterHandle parameter_handle) const override;
 
     IConstant<uint32_t> const* get_id_constant() const override;
     IConstant<bool> const* get_ego_constant() const override;
@@ -44,10 +45,12 @@ public:
     IConstant<temporal::Duration> const* get_cumilative_collision_time_variable() const override;
 
     IDrivingAgent const* get_agent() const;
+    IDrivingAgent* get_mutable_agent();
 
 
     structures::IArray<IValuelessConstant*>* get_mutable_parameter_values() override;
     IValuelessConstant* get_mutable_parameter_value(std::string const &parameter_name) override;
+    IValuelessConstant* get_mutable_parameter_value(ParameterHandle parameter_handle) override;
 
     void set_id_constant(IConstant<uint32_t> *id_constant) override;
     void set_ego_constant(IConstant<bool> *ego_constant) override;
@@ -24,6 +24,7 @@ public:
 
     structures::IArray<IValuelessConstant const*>* get_parameter_values() const override;
     IValuelessConstant const* get_parameter_value(std::string const &parameter_name) const override;
+    IValuelessConstant const* get_parameter_value(ParameterHandle parameter_handle) const override;
 
     IConstant<uint32_t> const* get_id_constant() const override;
     IConstant<bool> const* get_ego_constant() const override;
@@ -2,6 +2,7 @@
 
 #include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/structures/stl/stl_set.hpp>
+#include <ori/simcars/utils/work_stealing_thread_pool.hpp>
 #include <ori/simcars/map/map_interface.hpp>
 #include <ori/simcars/agent/basic_fp_action_sampler.hpp>
 #include <ori/simcars/agent/driving_goal_extraction_scene.hpp>
@@ -12,15 +13,22 @@
 #include <ori/simcars/agent/basic_driving_agent_agency_calculator.hpp>
 #include <ori/simcars/causal/causal_discoverer_interface.hpp>
 #include <ori/simcars/causal/necessary_fp_goal_causal_link_tester.hpp>
+#include <ori/simcars/causal/simulation_rollout_cache.hpp>
 
 #ifdef CD_DEBUG_PRINT
 #include <iostream>
-#else
-#include <thread>
 #endif
 
+#include <algorithm>
+#include <stdexcept>
+
 #define GOLDEN_RATIO_MAGIC_NUM 0x9e3779b9
 
+// Deep copies of the scene held at once by a single causal link test, and how many of those are
+// rollouts borrowed from the rollout cache when rollouts are cached
+#define SCENE_COPIES_PER_LINK_TEST 4
+#define CACHED_SCENE_COPIES_PER_LINK_TEST 2
+
 namespace ori
 {
 namespace simcars
@@ -47,6 +55,9 @@ public:
 template <typename T_map_id>
 class NecessaryDrivingCausalDiscoverer : public virtual ICausalDiscoverer
 {
+    // Constructed first, so that an invalid configuration is rejected before anything else is allocated
+    utils::WorkStealingThreadPool *thread_pool;
+
     map::IMap<T_map_id> const *map;
 
     agent::IActionSampler<FP_DATA_TYPE> const *action_sampler;
@@ -56,33 +67,102 @@ class NecessaryDrivingCausalDiscoverer : public virtual ICausalDiscoverer
     agent::IRewardCalculator const *reward_calculator;
     agent::IAgencyCalculator const *agency_calculator;
 
+    SimulationRolloutCache *rollout_cache;
+
     ICausalLinkTester<agent::Goal<FP_DATA_TYPE>, agent::Goal<FP_DATA_TYPE>> const *causal_link_tester;
 
+    bool reuse_worker_scene_copies;
+
+    static size_t calc_worker_count(size_t thread_count, bool reuse_worker_scene_copies,
+                                    size_t max_live_scene_copies)
+    {
+        if (thread_count == 0)
+        {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        if (max_live_scene_copies != 0)
+        {
+            size_t scene_copies_per_worker = SCENE_COPIES_PER_LINK_TEST +
+                    (reuse_worker_scene_copies ? 1 : 0);
+            if (max_live_scene_copies < scene_copies_per_worker)
+            {
+                throw std::invalid_argument("Live scene copy limit is below the scene copies held by a "
+                                            "single worker");
+            }
+            thread_count = std::min(max_live_scene_copies / scene_copies_per_worker, thread_count);
+        }
+
+        return thread_count;
+    }
+
+    // The rollout cache is given whatever remains of the limit once every worker holds its own scene
+    // copies, which always leaves room for the rollouts borrowed by every worker
+    static size_t calc_max_cached_rollout_count(size_t worker_count, bool reuse_worker_scene_copies,
+                                                size_t max_live_scene_copies)
+    {
+        if (max_live_scene_copies == 0)
+        {
+            return 0;
+        }
+
+        size_t uncached_scene_copies_per_worker =
+                SCENE_COPIES_PER_LINK_TEST - CACHED_SCENE_COPIES_PER_LINK_TEST +
+                (reuse_worker_scene_copies ? 1 : 0);
+        return max_live_scene_copies - worker_count * uncached_scene_copies_per_worker;
+    }
+
 public:
+    // Link tests are run on a pool of thread_count workers (zero uses one per hardware thread), which
+    // is shrunk as required so that no more than max_live_scene_copies deep copies of the scene
+    // exist at once (zero for no limit), a limit too small for even a single worker is rejected. If
+    // reuse_worker_scene_copies is set, each worker copies the scene once and runs all of its link
+    // tests against that copy rather than the shared scene.
+    // Rollouts cached when cache_rollouts is set count towards max_live_scene_copies, and those not in
+    // use are evicted as required to keep within it.
     NecessaryDrivingCausalDiscoverer(map::IMap<T_map_id> const *map, temporal::Duration time_step,
                                      size_t controller_lookahead_steps,
                                      FP_DATA_TYPE reward_diff_threshold,
-                                     temporal::Duration simulation_horizon)
-        : map(map), action_sampler(new agent::BasicFPActionSampler),
+                                     temporal::Duration simulation_horizon,
+                                     bool cache_rollouts = true,
+                                     size_t thread_count = 0,
+                                     bool reuse_worker_scene_copies = false,
+                                     size_t max_live_scene_copies = 0)
+        : thread_pool(new utils::WorkStealingThreadPool(
+                          calc_worker_count(thread_count, reuse_worker_scene_copies,
+                                            max_live_scene_copies))),
+          map(map), action_sampler(new agent::BasicFPActionSampler),
           simulation_scene_factory(new agent::DrivingSimulationSceneFactory),
           controller(new agent::BasicDrivingAgentController<T_map_id>(map, time_step,
                                                                       controller_lookahead_steps)),
           simulator(new agent::BasicDrivingSimulator(controller)),
           reward_calculator(new agent::SafeSpeedyDrivingAgentRewardCalculator),
           agency_calculator(new agent::BasicDrivingAgentAgencyCalculator),
+          rollout_cache(cache_rollouts ?
+                            new SimulationRolloutCache(
+                                calc_max_cached_rollout_count(thread_pool->get_thread_count(),
+                                                              reuse_worker_scene_copies,
+                                                              max_live_scene_copies)) :
+                            nullptr),
           causal_link_tester(new NecessaryFPGoalCausalLinkTester(action_sampler,
                                                                  simulation_scene_factory, simulator,
                                                                  reward_calculator,
                                                                  agency_calculator,
                                                                  reward_diff_threshold,
-                                                                 simulation_horizon))
+                                                                 simulation_horizon,
+                                                                 rollout_cache)),
+          reuse_worker_scene_copies(reuse_worker_scene_copies)
     {
     }
 
     ~NecessaryDrivingCausalDiscoverer() override
     {
+        delete thread_pool;
+
         delete causal_link_tester;
 
+        delete rollout_cache;
+
         delete agency_calculator;
         delete reward_calculator;
         delete simulator;
@@ -175,6 +255,13 @@ public:
                             just_before_start,
                             agent::Goal(driving_agent_initial_aligned_linear_velocity,
                                         just_before_start));
+
+                // Link tests fork this scene on every worker, and the simulator propagates the goals of
+                // the agents it begins simulating up to the end of the simulation, which is never beyond
+                // the end of the scene. They are propagated that far here, before being shared, so that
+                // the simulator never extends them while other forks read them.
+                driving_agent_aligned_linear_velocity_goal_variable->propogate_events_forward(
+                            driving_scene_with_actions->get_max_temporal_limit());
             }
         }
 
@@ -182,8 +269,8 @@ public:
 
 
 #ifndef CD_DEBUG_PRINT
-        structures::stl::STLStackArray<std::thread*> threads(
-                    std::pow(aligned_linear_velocity_goal_events.count(), 2), nullptr);
+        structures::stl::STLStackArray<agent::IDrivingScene*> worker_scene_copies(
+                    thread_pool->get_thread_count(), nullptr);
         structures::stl::STLStackArray<std::pair<std::string, std::string>*> reward_discovered_entity_causal_link_array(
                     std::pow(aligned_linear_velocity_goal_events.count(), 2), nullptr);
         structures::stl::STLStackArray<std::pair<std::string, std::string>*> agency_discovered_entity_causal_link_array(
@@ -348,15 +435,27 @@ public:
                     std::cout << "───────────────────────────────────────────────────" <<
                                  std::endl;
 #else
-                    threads[i * aligned_linear_velocity_goal_events.count() + j] =
-                            new std::thread([&, i, j, potential_cause, potential_effect]()
+                    thread_pool->submit([&, i, j, potential_cause, potential_effect]()
                     {
+                        agent::IDrivingScene const *link_test_scene = driving_scene_with_actions;
+                        size_t worker_idx;
+                        if (reuse_worker_scene_copies &&
+                                thread_pool->get_current_worker_idx(worker_idx))
+                        {
+                            if (worker_scene_copies[worker_idx] == nullptr)
+                            {
+                                worker_scene_copies[worker_idx] =
+                                        driving_scene_with_actions->driving_scene_deep_copy();
+                            }
+                            link_test_scene = worker_scene_copies[worker_idx];
+                        }
+
                         bool reward_link_present;
                         bool agency_link_present;
                         bool hybrid_link_present;
 
                         causal_link_tester->test_causal_link(
-                                    driving_scene_with_actions, potential_cause, potential_effect,
+                                    link_test_scene, potential_cause, potential_effect,
                                     reward_link_present, agency_link_present, hybrid_link_present);
 
                         std::string cause_driving_agent = potential_cause->get_entity_name();
@@ -395,31 +494,72 @@ public:
 
 
 #ifndef CD_DEBUG_PRINT
-        assert(threads.count() == hybrid_discovered_entity_causal_link_array.count());
-        for (i = 0; i < threads.count(); ++i)
+        try
+        {
+            thread_pool->wait();
+        }
+        catch (...)
         {
-            std::thread *thread = threads[i];
-            if (thread != nullptr)
+            if (rollout_cache != nullptr)
             {
-                thread->join();
-                delete thread;
-                if (reward_discovered_entity_causal_link_array[i] != nullptr)
-                {
-                    reward_discovered->insert(*(reward_discovered_entity_causal_link_array[i]));
-                    delete reward_discovered_entity_causal_link_array[i];
-                }
-                if (agency_discovered_entity_causal_link_array[i] != nullptr)
-                {
-                    agency_discovered->insert(*(agency_discovered_entity_causal_link_array[i]));
-                    delete agency_discovered_entity_causal_link_array[i];
-                }
-                if (hybrid_discovered_entity_causal_link_array[i] != nullptr)
-                {
-                    hybrid_discovered->insert(*(hybrid_discovered_entity_causal_link_array[i]));
-                    delete hybrid_discovered_entity_causal_link_array[i];
-                }
+                rollout_cache->clear();
+            }
+
+            for (i = 0; i < worker_scene_copies.count(); ++i)
+            {
+                delete worker_scene_copies[i];
+            }
+
+            for (i = 0; i < hybrid_discovered_entity_causal_link_array.count(); ++i)
+            {
+                delete reward_discovered_entity_causal_link_array[i];
+                delete agency_discovered_entity_causal_link_array[i];
+                delete hybrid_discovered_entity_causal_link_array[i];
+            }
+
+            delete driving_scene_with_actions;
+
+            delete driving_scene_copy;
+
+            throw;
+        }
+
+        // Cached rollouts fork the scene each worker tested against, so must go before those copies
+        if (rollout_cache != nullptr)
+        {
+            rollout_cache->clear();
+        }
+
+        for (i = 0; i < worker_scene_copies.count(); ++i)
+        {
+            delete worker_scene_copies[i];
+        }
+
+        assert(reward_discovered_entity_causal_link_array.count() ==
+               hybrid_discovered_entity_causal_link_array.count());
+        for (i = 0; i < hybrid_discovered_entity_causal_link_array.count(); ++i)
+        {
+            if (reward_discovered_entity_causal_link_array[i] != nullptr)
+            {
+                reward_discovered->insert(*(reward_discovered_entity_causal_link_array[i]));
+                delete reward_discovered_entity_causal_link_array[i];
+            }
+            if (agency_discovered_entity_causal_link_array[i] != nullptr)
+            {
+                agency_discovered->insert(*(agency_discovered_entity_causal_link_array[i]));
+                delete agency_discovered_entity_causal_link_array[i];
+            }
+            if (hybrid_discovered_entity_causal_link_array[i] != nullptr)
+            {
+                hybrid_discovered->insert(*(hybrid_discovered_entity_causal_link_array[i]));
+                delete hybrid_discovered_entity_causal_link_array[i];
             }
         }
+#else
+        if (rollout_cache != nullptr)
+        {
+            rollout_cache->clear();
+        }
 #endif
 
 
@@ -7,6 +7,7 @@
 #include <ori/simcars/agent/agency_calculator_interface.hpp>
 #include <ori/simcars/agent/goal.hpp>
 #include <ori/simcars/causal/causal_link_tester_interface.hpp>
+#include <ori/simcars/causal/simulation_rollout_cache.hpp>
 
 //#define CD_DEBUG_PRINT
 
@@ -29,14 +30,22 @@ class NecessaryFPGoalCausalLinkTester
     FP_DATA_TYPE reward_diff_threshold;
     temporal::Duration simulation_horizon;
 
+    SimulationRolloutCache *rollout_cache;
+
+    // Driving scenes are forked copy-on-write, so each intervention only copies the variables it
+    // modifies, any other scene is deep copied
+    static agent::IScene* fork_scene(agent::IScene const *scene);
+
 public:
+    // Without a rollout cache, every rollout is simulated afresh for each link tested
     NecessaryFPGoalCausalLinkTester(agent::IActionSampler<FP_DATA_TYPE> const *action_sampler,
                                     agent::ISimulationSceneFactory const *simulation_scene_factory,
                                     agent::ISimulator const *simulator,
                                     agent::IRewardCalculator const *reward_calculator,
                                     agent::IAgencyCalculator const *agency_calculator,
                                     FP_DATA_TYPE reward_diff_threshold,
-                                    temporal::Duration simulation_horizon);
+                                    temporal::Duration simulation_horizon,
+                                    SimulationRolloutCache *rollout_cache = nullptr);
 
     void test_causal_link(agent::IScene const *scene,
                           agent::IEvent<agent::Goal<FP_DATA_TYPE>> const *cause,
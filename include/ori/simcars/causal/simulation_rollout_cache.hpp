@@ -0,0 +1,120 @@
+#pragma once
+
+#include <ori/simcars/agent/scene_interface.hpp>
+#include <ori/simcars/agent/simulation_scene_interface.hpp>
+
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <future>
+#include <mutex>
+
+namespace ori
+{
+namespace simcars
+{
+namespace causal
+{
+
+// Shares simulation rollouts of the same scene between causal link tests. Every rollout cached must
+// derive from the same original scene, so the cache should be cleared before moving on to another
+// scene. Rollouts are fully simulated before being shared, so they are only ever read once cached.
+//
+// Each rollout obtained is borrowed until released, and a rollout forked from another cached rollout
+// borrows that parent for as long as it is cached itself. Once more than max_count rollouts are
+// cached, those no longer borrowed are evicted least recently used first. Borrowed rollouts are never
+// evicted, so the limit is exceeded for as long as more than max_count are borrowed. Rollouts which
+// fail to be created are dropped from the cache, along with their borrow of any parent.
+class SimulationRolloutCache
+{
+    class Entry
+    {
+    public:
+        std::string key;
+        std::shared_future<void> ready;
+        agent::IScene *scene;
+        agent::ISimulationScene *simulation_scene;
+
+        Entry *parent;
+        size_t borrow_count;
+
+        // Position in the eviction queue, only valid while the entry is not borrowed
+        std::list<Entry*>::iterator evictable_it;
+
+        Entry(std::string const &key);
+        ~Entry();
+    };
+
+    size_t max_count;
+
+    mutable std::mutex entries_mutex;
+    std::unordered_map<std::string, Entry*> entries;
+
+    // Entries which are not borrowed, least recently used first
+    std::list<Entry*> evictable_entries;
+
+    size_t hit_count;
+    size_t miss_count;
+
+    // Must be called with the entries mutex held
+    void borrow(Entry *entry);
+    void release(Entry *entry);
+    void evict();
+    // Removes a rollout which failed to be created, its remaining borrowers delete it
+    void drop(Entry *entry);
+
+public:
+    // Creates the scene a rollout is simulated on and the simulation scene for the rollout, the
+    // cache takes ownership of both
+    typedef std::function<void(agent::IScene *&scene,
+                               agent::ISimulationScene *&simulation_scene)> RolloutCreator;
+
+    // Zero for no limit on the number of rollouts cached
+    SimulationRolloutCache(size_t max_count = 0);
+    SimulationRolloutCache(SimulationRolloutCache const&) = delete;
+
+    ~SimulationRolloutCache();
+
+    size_t count() const;
+    size_t get_hit_count() const;
+    size_t get_miss_count() const;
+
+    // If the rollout for the key is already cached or being created by another thread it is reused,
+    // otherwise it is created, simulated up to simulation_end_time and cached. Either way the rollout
+    // is borrowed until released with release_rollout. Rollouts which fork another cached rollout
+    // must give its key as parent_key.
+    void get_rollout(std::string const &key, RolloutCreator const &rollout_creator,
+                     temporal::Time simulation_end_time, agent::IScene const *&scene,
+                     agent::ISimulationScene const *&simulation_scene,
+                     std::string const &parent_key = std::string());
+    void release_rollout(std::string const &key);
+
+    void clear();
+
+    // Borrows a rollout for as long as it is in scope, releasing it even if an exception is thrown
+    // while it is being used
+    class ScopedRollout
+    {
+        SimulationRolloutCache *cache;
+        std::string key;
+
+        agent::IScene const *scene;
+        agent::ISimulationScene const *simulation_scene;
+
+    public:
+        ScopedRollout(SimulationRolloutCache *cache, std::string const &key,
+                      RolloutCreator const &rollout_creator, temporal::Time simulation_end_time,
+                      std::string const &parent_key = std::string());
+        ScopedRollout(ScopedRollout const&) = delete;
+
+        ~ScopedRollout();
+
+        agent::IScene const* get_scene() const;
+        agent::ISimulationScene const* get_simulation_scene() const;
+    };
+};
+
+}
+}
+}
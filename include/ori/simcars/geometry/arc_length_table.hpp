@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ori/simcars/geometry/typedefs.hpp>
+
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+// Cumulative arc lengths and unit directions of the segments of a polyline, so that positions along it can be
+// found by binary search instead of walking and normalising every segment
+class ArcLengthTable
+{
+    Vecs points;
+    Vecs directions;
+    std::vector<FP_DATA_TYPE> cumulative_lengths;
+
+public:
+    ArcLengthTable();
+    ArcLengthTable(Vecs const &points);
+
+    size_t get_segment_count() const;
+    FP_DATA_TYPE get_length() const;
+    // Arc length from the start of the polyline to the point with the given index
+    FP_DATA_TYPE get_cumulative_length(size_t point_idx) const;
+    Vec get_point(size_t point_idx) const;
+    Vec get_direction(size_t segment_idx) const;
+
+    // Index of the first segment ending beyond the given arc position, the last segment if none do, and 0 if there are
+    // no segments
+    size_t get_segment(FP_DATA_TYPE arc_position) const;
+
+    // Arc position of the projection of a point onto the polyline, clamped to its extent. The segment projected
+    // onto is the first whose end lies ahead of the point, which assumes the polyline does not double back on itself.
+    FP_DATA_TYPE project(Vec const &point) const;
+    FP_DATA_TYPE project(Vec const &point, size_t &segment_idx) const;
+    // As above, but the arc position is negative before the start of the polyline and beyond its length after the end
+    FP_DATA_TYPE project_unclamped(Vec const &point, size_t &segment_idx) const;
+};
+
+}
+}
+}
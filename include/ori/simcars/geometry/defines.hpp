@@ -1,3 +1,6 @@
 #pragma once
 
+// Scalar type of geometry, maps and simulation, selected at build time through the SIMCARS_FP_DATA_TYPE CMake option
+#ifndef FP_DATA_TYPE
 #define FP_DATA_TYPE float
+#endif
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <ori/simcars/structures/dictionary_interface.hpp>
 #include <ori/simcars/structures/stl/stl_stack_array.hpp>
-#include <ori/simcars/structures/stl/stl_dictionary.hpp>
 #include <ori/simcars/geometry/typedefs.hpp>
 #include <ori/simcars/geometry/grid_rect.hpp>
 
+#include <vector>
+#include <mutex>
+#include <stdexcept>
+#include <cstdint>
 #include <cmath>
 
 #define GOLDEN_RATIO_MAGIC_NUM 0x9e3779b9
@@ -29,47 +33,270 @@ public:
     }
 };
 
+// Grid rects are stored in an open addressing table keyed by integer cell coordinates, points are only converted
+// to cell coordinates once per lookup and range queries walk the cells in range without allocating
 template <typename V_grid_rect>
-class GridDictionary : public virtual structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>
+class GridDictionary : public virtual structures::IDictionary<Vec, V_grid_rect*>
 {
+    struct Slot
+    {
+        int32_t i, j;
+        V_grid_rect *grid_rect;
+    };
+
     Vec origin;
     FP_DATA_TYPE spacing;
 
-    Vec round(Vec const &point) const
+    // Linear probing over a power of two sized table, a slot is empty when it holds no grid rect
+    std::vector<Slot> slots;
+    size_t slot_count;
+
+    mutable std::recursive_mutex slots_mutex;
+
+    mutable structures::IStackArray<Vec> *keys_cache;
+    mutable structures::IStackArray<V_grid_rect*> *values_cache;
+
+    static size_t hash(int32_t i, int32_t j)
+    {
+        uint64_t key = (uint64_t(uint32_t(i)) << 32) | uint64_t(uint32_t(j));
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ull;
+        key ^= key >> 33;
+        return size_t(key);
+    }
+
+    size_t find_slot_idx(int32_t i, int32_t j) const
+    {
+        size_t const mask = slots.size() - 1;
+        size_t slot_idx = hash(i, j) & mask;
+        while (slots[slot_idx].grid_rect != nullptr && (slots[slot_idx].i != i || slots[slot_idx].j != j))
+        {
+            slot_idx = (slot_idx + 1) & mask;
+        }
+        return slot_idx;
+    }
+
+    void grow()
+    {
+        std::vector<Slot> old_slots(slots.size() * 2, Slot{0, 0, nullptr});
+        old_slots.swap(slots);
+
+        for (Slot const &old_slot : old_slots)
+        {
+            if (old_slot.grid_rect != nullptr)
+            {
+                slots[find_slot_idx(old_slot.i, old_slot.j)] = old_slot;
+            }
+        }
+    }
+
+    void invalidate_caches()
+    {
+        delete keys_cache;
+        keys_cache = nullptr;
+
+        delete values_cache;
+        values_cache = nullptr;
+    }
+
+    void get_cell(Vec const &point, int32_t &i, int32_t &j) const
+    {
+        i = int32_t(std::round((point.x() - origin.x()) / spacing));
+        j = int32_t(std::round((point.y() - origin.y()) / spacing));
+    }
+    Vec get_cell_origin(int32_t i, int32_t j) const
+    {
+        return origin + Vec(i * spacing, j * spacing);
+    }
+
+    V_grid_rect* find(int32_t i, int32_t j) const
+    {
+        return slots[find_slot_idx(i, j)].grid_rect;
+    }
+    void insert(int32_t i, int32_t j, V_grid_rect *grid_rect)
+    {
+        size_t slot_idx = find_slot_idx(i, j);
+        if (slots[slot_idx].grid_rect == nullptr)
+        {
+            if (2 * (slot_count + 1) > slots.size())
+            {
+                grow();
+                slot_idx = find_slot_idx(i, j);
+            }
+            ++slot_count;
+        }
+        slots[slot_idx] = Slot{i, j, grid_rect};
+    }
+    void remove(int32_t i, int32_t j)
+    {
+        size_t const mask = slots.size() - 1;
+        size_t slot_idx = find_slot_idx(i, j);
+        if (slots[slot_idx].grid_rect == nullptr)
+        {
+            return;
+        }
+        --slot_count;
+
+        // Backward shift deletion, moves later slots of the probe sequence into the gap so no tombstones are needed
+        size_t next_slot_idx = (slot_idx + 1) & mask;
+        while (slots[next_slot_idx].grid_rect != nullptr)
+        {
+            size_t const home_slot_idx = hash(slots[next_slot_idx].i, slots[next_slot_idx].j) & mask;
+            if (((next_slot_idx - home_slot_idx) & mask) >= ((next_slot_idx - slot_idx) & mask))
+            {
+                slots[slot_idx] = slots[next_slot_idx];
+                slot_idx = next_slot_idx;
+            }
+            next_slot_idx = (next_slot_idx + 1) & mask;
+        }
+        slots[slot_idx] = Slot{0, 0, nullptr};
+    }
+
+    void get_cell_range(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance,
+                        int32_t &i_min, int32_t &i_max, int32_t &j_min, int32_t &j_max) const
     {
-        Vec rounded_point = point;
-        rounded_point = (rounded_point - origin) / spacing;
-        rounded_point = rounded_point.array().round().matrix();
-        rounded_point = (rounded_point * spacing) + origin;
-        return rounded_point;
+        get_cell(key - Vec(x_distance, y_distance), i_min, j_min);
+        get_cell(key + Vec(x_distance, y_distance), i_max, j_max);
     }
 
 public:
     GridDictionary(Vec origin, FP_DATA_TYPE spacing, size_t bin_count = 10000)
-        : structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>(bin_count), origin(origin), spacing(spacing) {}
+        : origin(origin), spacing(spacing), slot_count(0), keys_cache(nullptr), values_cache(nullptr)
+    {
+        size_t capacity = 16;
+        while (capacity < 2 * bin_count)
+        {
+            capacity *= 2;
+        }
+        slots.resize(capacity, Slot{0, 0, nullptr});
+    }
     GridDictionary(GridDictionary const &grid_dictionary)
-        : structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>(grid_dictionary),
-          origin(grid_dictionary.origin), spacing(grid_dictionary.spacing) {}
+        : origin(grid_dictionary.origin), spacing(grid_dictionary.spacing), slots(grid_dictionary.slots),
+          slot_count(grid_dictionary.slot_count), keys_cache(nullptr), values_cache(nullptr) {}
     ~GridDictionary() override
     {
         static_assert(std::is_base_of<GridRect<V_grid_rect>, V_grid_rect>::value, "V_grid_rect is not derived from GridRect");
 
-        structures::IArray<V_grid_rect*> const* grid_rects = this->get_values();
-
-        for (size_t i = 0; i < grid_rects->count(); ++i)
+        for (Slot const &slot : slots)
         {
-            delete (*grid_rects)[i];
+            delete slot.grid_rect;
         }
+
+        invalidate_caches();
     }
 
+    Vec const& get_origin() const
+    {
+        return origin;
+    }
+    FP_DATA_TYPE get_spacing() const
+    {
+        return spacing;
+    }
+
+    size_t count() const override
+    {
+        return slot_count;
+    }
     bool contains(Vec const &key) const override
     {
-        return structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::contains(round(key));
+        int32_t i, j;
+        get_cell(key, i, j);
+        return find(i, j) != nullptr;
+    }
+
+    // Single probe alternative to contains followed by lookup, returns nullptr for points outside of the grid
+    V_grid_rect* get_grid_rect(Vec const &key) const
+    {
+        int32_t i, j;
+        get_cell(key, i, j);
+        return find(i, j);
     }
 
     V_grid_rect* const& operator [](Vec const &key) const override
     {
-        return structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::operator [](round(key));
+        int32_t i, j;
+        get_cell(key, i, j);
+        Slot const &slot = slots[find_slot_idx(i, j)];
+        if (slot.grid_rect == nullptr)
+        {
+            throw std::out_of_range("Grid dictionary does not contain a grid rect at the specified point");
+        }
+        return slot.grid_rect;
+    }
+    bool contains_value(V_grid_rect* const &val) const override
+    {
+        for (Slot const &slot : slots)
+        {
+            if (slot.grid_rect != nullptr && slot.grid_rect == val)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    structures::IArray<Vec> const* get_keys() const override
+    {
+        std::lock_guard<std::recursive_mutex> slots_guard(slots_mutex);
+
+        if (keys_cache == nullptr)
+        {
+            keys_cache = new structures::stl::STLStackArray<Vec>(count());
+            get_keys(keys_cache);
+        }
+        return keys_cache;
+    }
+    void get_keys(structures::IStackArray<Vec> *keys) const override
+    {
+        size_t i = 0;
+        for (Slot const &slot : slots)
+        {
+            if (slot.grid_rect != nullptr)
+            {
+                if (i >= keys->count())
+                {
+                    keys->push_back(get_cell_origin(slot.i, slot.j));
+                }
+                else
+                {
+                    (*keys)[i] = get_cell_origin(slot.i, slot.j);
+                }
+                ++i;
+            }
+        }
+    }
+    structures::IArray<V_grid_rect*> const* get_values() const override
+    {
+        std::lock_guard<std::recursive_mutex> slots_guard(slots_mutex);
+
+        if (values_cache == nullptr)
+        {
+            values_cache = new structures::stl::STLStackArray<V_grid_rect*>(count());
+            get_values(values_cache);
+        }
+        return values_cache;
+    }
+    void get_values(structures::IStackArray<V_grid_rect*> *values) const override
+    {
+        size_t i = 0;
+        for (Slot const &slot : slots)
+        {
+            if (slot.grid_rect != nullptr)
+            {
+                if (i >= values->count())
+                {
+                    values->push_back(slot.grid_rect);
+                }
+                else
+                {
+                    (*values)[i] = slot.grid_rect;
+                }
+                ++i;
+            }
+        }
     }
 
     structures::IArray<geometry::Vec>* chebyshev_grid_points_in_range(Vec const &key, FP_DATA_TYPE distance) const
@@ -78,25 +305,16 @@ public:
     }
     structures::IArray<geometry::Vec>* chebyshev_grid_points_in_range(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance) const
     {
-        Vec rounded_point = round(key);
-        Vec rounded_top_right_point = round(key + Vec(x_distance, y_distance));
-        Vec rounded_bottom_left_point = round(key - Vec(x_distance, y_distance));
-        int i, j;
-        int i_min = (int)((rounded_bottom_left_point.x() - rounded_point.x()) / spacing);
-        int i_max = (int)((rounded_top_right_point.x() - rounded_point.x()) / spacing);
-        int j_min = (int)((rounded_bottom_left_point.y() - rounded_point.y()) / spacing);
-        int j_max = (int)((rounded_top_right_point.y() - rounded_point.y()) / spacing);
+        int32_t i, j, i_min, i_max, j_min, j_max;
+        get_cell_range(key, x_distance, y_distance, i_min, i_max, j_min, j_max);
 
         structures::IArray<geometry::Vec> *grid_points = new structures::stl::STLStackArray<geometry::Vec>((1 + i_max - i_min) * (1 + j_max - j_min));
 
         for (i = i_min; i <= i_max; ++i)
         {
-            Vec i_adjustment(i * spacing, 0.0f);
             for (j = j_min; j <= j_max; ++j)
             {
-                Vec j_adjustment(0.0f, j * spacing);
-                Vec current_point = rounded_point + i_adjustment + j_adjustment;
-                (*grid_points)[(j - j_min) + (i - i_min) * (1 + j_max - j_min)] = current_point;
+                (*grid_points)[(j - j_min) + (i - i_min) * (1 + j_max - j_min)] = get_cell_origin(i, j);
             }
         }
 
@@ -108,33 +326,74 @@ public:
     }
     structures::IArray<V_grid_rect*>* chebyshev_grid_rects_in_range(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance) const
     {
-        structures::IArray<geometry::Vec> *grid_points = chebyshev_grid_points_in_range(key, x_distance, y_distance);
-
         structures::stl::STLStackArray<V_grid_rect*> *grid_rects = new structures::stl::STLStackArray<V_grid_rect*>();
 
-        size_t i;
-        for (i = 0; i < grid_points->count(); ++i)
+        chebyshev_grid_rects_in_range(key, x_distance, y_distance, grid_rects);
+
+        return grid_rects;
+    }
+    // Grid rects in range are appended to the given array, so a caller reusing one array does not allocate
+    void chebyshev_grid_rects_in_range(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance,
+                                       structures::IStackArray<V_grid_rect*> *grid_rects) const
+    {
+        visit_chebyshev_grid_rects_in_range(
+                    key, x_distance, y_distance,
+                    [grid_rects](V_grid_rect *grid_rect)
+                    {
+                        grid_rects->push_back(grid_rect);
+                    });
+    }
+    template <typename F_visitor>
+    void visit_chebyshev_grid_rects_in_range(Vec const &key, FP_DATA_TYPE distance, F_visitor &&visitor) const
+    {
+        visit_chebyshev_grid_rects_in_range(key, distance, distance, visitor);
+    }
+    template <typename F_visitor>
+    void visit_chebyshev_grid_rects_in_range(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance,
+                                             F_visitor &&visitor) const
+    {
+        int32_t i, j, i_min, i_max, j_min, j_max;
+        get_cell_range(key, x_distance, y_distance, i_min, i_max, j_min, j_max);
+
+        for (i = i_min; i <= i_max; ++i)
         {
-            if (structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::contains((*grid_points)[i]))
+            for (j = j_min; j <= j_max; ++j)
             {
-                grid_rects->push_back(
-                            structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::operator [](
-                                (*grid_points)[i]));
+                V_grid_rect *grid_rect = find(i, j);
+                if (grid_rect != nullptr)
+                {
+                    visitor(grid_rect);
+                }
             }
         }
-
-        delete grid_points;
-
-        return grid_rects;
     }
 
     void update(Vec const &key, V_grid_rect* const &val) override
     {
-        structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::update(round(key), val);
+        std::lock_guard<std::recursive_mutex> slots_guard(slots_mutex);
+
+        int32_t i, j;
+        get_cell(key, i, j);
+        if (val != nullptr)
+        {
+            insert(i, j, val);
+        }
+        else
+        {
+            remove(i, j);
+        }
+
+        invalidate_caches();
     }
     void erase(Vec const &key) override
     {
-        structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::erase(round(key));
+        std::lock_guard<std::recursive_mutex> slots_guard(slots_mutex);
+
+        int32_t i, j;
+        get_cell(key, i, j);
+        remove(i, j);
+
+        invalidate_caches();
     }
 
     void chebyshev_proliferate(Vec const &key, FP_DATA_TYPE distance)
@@ -143,20 +402,28 @@ public:
     }
     void chebyshev_proliferate(Vec const &key, FP_DATA_TYPE x_distance, FP_DATA_TYPE y_distance)
     {
-        structures::IArray<geometry::Vec> *grid_points = chebyshev_grid_points_in_range(key, x_distance, y_distance);
+        std::lock_guard<std::recursive_mutex> slots_guard(slots_mutex);
 
-        size_t i;
-        for (i = 0; i < grid_points->count(); ++i)
+        int32_t i, j, i_min, i_max, j_min, j_max;
+        get_cell_range(key, x_distance, y_distance, i_min, i_max, j_min, j_max);
+
+        bool proliferated = false;
+        for (i = i_min; i <= i_max; ++i)
         {
-            if (!structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::contains((*grid_points)[i]))
+            for (j = j_min; j <= j_max; ++j)
             {
-                structures::stl::STLDictionary<Vec, V_grid_rect*, VecHasher>::update(
-                            (*grid_points)[i],
-                            new V_grid_rect((*grid_points)[i], spacing));
+                if (find(i, j) == nullptr)
+                {
+                    insert(i, j, new V_grid_rect(get_cell_origin(i, j), spacing));
+                    proliferated = true;
+                }
             }
         }
 
-        delete grid_points;
+        if (proliferated)
+        {
+            invalidate_caches();
+        }
     }
 };
 
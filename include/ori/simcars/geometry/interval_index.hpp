@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ori/simcars/structures/stack_array_interface.hpp>
+#include <ori/simcars/geometry/typedefs.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+// Static index over indexed closed intervals, sorted by their lower bounds along with a running maximum of their
+// upper bounds, so that only intervals which could overlap a query are visited
+class IntervalIndex
+{
+    std::vector<FP_DATA_TYPE> mins;
+    std::vector<FP_DATA_TYPE> maxs;
+
+    std::vector<size_t> sorted_indices;
+    std::vector<FP_DATA_TYPE> sorted_mins;
+    std::vector<FP_DATA_TYPE> sorted_max_prefix_maxs;
+
+public:
+    IntervalIndex();
+
+    size_t count() const;
+
+    // Indices are appended in ascending order
+    void get_indices_containing(FP_DATA_TYPE value, structures::IStackArray<size_t> *indices) const;
+    void get_indices_overlapping(FP_DATA_TYPE min, FP_DATA_TYPE max, structures::IStackArray<size_t> *indices) const;
+
+    // Visits overlapping intervals in descending order of their lower bounds, without allocating
+    template <typename F_visitor>
+    void visit_indices_overlapping(FP_DATA_TYPE min, FP_DATA_TYPE max, F_visitor &&visitor) const
+    {
+        // Intervals starting after the query ends cannot overlap it, and walking back from there can stop as soon
+        // as no earlier interval reaches the start of the query
+        size_t rank = std::upper_bound(sorted_mins.begin(), sorted_mins.end(), max) - sorted_mins.begin();
+        while (rank > 0 && sorted_max_prefix_maxs[rank - 1] >= min)
+        {
+            --rank;
+            size_t const idx = sorted_indices[rank];
+            if (maxs[idx] >= min)
+            {
+                visitor(idx);
+            }
+        }
+    }
+
+    void reset(size_t count);
+    void set_interval(size_t idx, FP_DATA_TYPE min, FP_DATA_TYPE max);
+    void sort();
+};
+
+}
+}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ori/simcars/structures/stack_array_interface.hpp>
+#include <ori/simcars/geometry/typedefs.hpp>
+#include <ori/simcars/geometry/trig_buff.hpp>
+
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+// Oriented box reduced to the values a separating axis test needs, unlike ORect it has no cached bounds and
+// nothing is computed lazily, so it is cheap to build and copy
+struct OBox
+{
+    FP_DATA_TYPE centre_x, centre_y;
+    FP_DATA_TYPE half_width, half_height;
+    FP_DATA_TYPE cos_orientation, sin_orientation;
+
+    static OBox create(Vec const &centre, FP_DATA_TYPE width, FP_DATA_TYPE height, FP_DATA_TYPE orientation,
+                       TrigBuff const *trig_buff);
+
+    // Half the length of the projection of the box onto an axis, scaled by the length of the axis
+    FP_DATA_TYPE calc_projected_half_extent(Vec const &axis) const;
+
+    // Touching boxes count as colliding, as with Rect
+    bool check_collision(OBox const &o_box) const;
+    // Earliest non-negative time at which the boxes touch when the other box moves at the given velocity relative to
+    // this one and neither rotates, infinity if they never do
+    FP_DATA_TYPE calc_collision_time(OBox const &o_box, Vec const &relative_velocity) const;
+};
+
+// Indexed oriented boxes stored as a structure of arrays, so that one box is tested against all of them with
+// Eigen's vectorised array operations. Storage is retained between calls to clear.
+class OBoxBatch
+{
+    std::vector<FP_DATA_TYPE> centre_xs, centre_ys;
+    std::vector<FP_DATA_TYPE> half_widths, half_heights;
+    std::vector<FP_DATA_TYPE> cos_orientations, sin_orientations;
+    std::vector<FP_DATA_TYPE> velocity_xs, velocity_ys;
+
+public:
+    OBoxBatch();
+
+    size_t count() const;
+    OBox get_o_box(size_t idx) const;
+
+    // Indices of the boxes colliding with the given box are appended in ascending order
+    void get_colliding_indices(OBox const &o_box, structures::IStackArray<size_t> *indices) const;
+    // Collision times of each box with the given box moving at the given velocity are appended in index order, as
+    // given by OBox::calc_collision_time
+    void get_collision_times(OBox const &o_box, Vec const &velocity,
+                             structures::IStackArray<FP_DATA_TYPE> *collision_times) const;
+
+    void clear();
+    // Boxes pushed without a velocity are stationary
+    void push_back(OBox const &o_box);
+    void push_back(OBox const &o_box, Vec const &velocity);
+};
+
+}
+}
+}
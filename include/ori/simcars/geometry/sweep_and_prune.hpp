@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ori/simcars/structures/stack_array_interface.hpp>
+#include <ori/simcars/geometry/typedefs.hpp>
+
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+// Keeps a set of indexed points sorted along the x axis, retaining the ordering between calls to
+// reset so that points which move little between updates are cheap to re-sort
+class SweepAndPrune
+{
+    std::vector<Vec> positions;
+    std::vector<size_t> sorted_indices;
+    std::vector<size_t> ranks;
+    std::vector<FP_DATA_TYPE> sorted_xs;
+
+    void swap_ranks(size_t rank_1, size_t rank_2);
+
+public:
+    SweepAndPrune();
+
+    size_t count() const;
+    Vec const& get_position(size_t idx) const;
+    size_t get_index(size_t rank) const;
+    FP_DATA_TYPE get_x(size_t rank) const;
+    size_t get_lower_bound_rank(FP_DATA_TYPE x) const;
+    void get_indices_in_range(Vec const &point, FP_DATA_TYPE range,
+                              structures::IStackArray<size_t> *indices) const;
+
+    void reset(size_t count);
+    void set_position(size_t idx, Vec const &position);
+    void sort();
+    void update_position(size_t idx, Vec const &position);
+};
+
+}
+}
+}
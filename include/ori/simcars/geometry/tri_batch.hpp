@@ -0,0 +1,43 @@
+#pragma once
+
+#include <ori/simcars/structures/array_interface.hpp>
+#include <ori/simcars/structures/stack_array_interface.hpp>
+#include <ori/simcars/geometry/typedefs.hpp>
+#include <ori/simcars/geometry/tri.hpp>
+#include <ori/simcars/geometry/rect.hpp>
+
+#include <Eigen/Core>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+// Triangles stored as a structure of arrays, one array per vertex coordinate and edge normal component, so that a
+// point is tested against every triangle at once through Eigen's vectorised array operations
+class TriBatch
+{
+    typedef Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> Column;
+
+    Column vertex_xs[3], vertex_ys[3];
+    Column edge_normal_xs[3], edge_normal_ys[3];
+
+public:
+    TriBatch();
+    TriBatch(structures::IArray<Tri> const *tris);
+
+    size_t count() const;
+
+    // Same result as testing each triangle with Tri::check_encapsulation
+    bool check_encapsulation(Vec const &point) const;
+    // Indices of the points encapsulated by any triangle are appended in ascending order. Points outside of the
+    // bounding box, which must contain every triangle, are rejected for the whole batch before any triangle is tested.
+    void check_encapsulation(Vecs const &points, Rect const &bounding_box,
+                             structures::IStackArray<size_t> *encapsulated_point_indices) const;
+};
+
+}
+}
+}
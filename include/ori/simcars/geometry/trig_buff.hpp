@@ -5,6 +5,8 @@
 
 #include <Eigen/Core>
 
+#include <atomic>
+#include <stdexcept>
 #include <cstddef>
 
 namespace ori
@@ -14,30 +16,39 @@ namespace simcars
 namespace geometry
 {
 
+// Tables of trigonometric values over a full turn. Lookups are read only, so a buffer may be shared between
+// threads, and buffers may be constructed directly for a particular simulation context as well as through the
+// process wide instance. Interpolated buffers linearly interpolate between neighbouring bins, giving far smaller
+// errors than nearest bin lookups for the same number of bins, so that their tables can fit in cache.
 class TrigBuff
 {
-    static TrigBuff *instance;
+    static std::atomic<TrigBuff*> instance;
 
     size_t const num_bins;
     AngleType const default_angle_type;
+    bool const interpolated;
     FP_DATA_TYPE const radian_multi;
     FP_DATA_TYPE const degree_multi;
     FP_DATA_TYPE *sin_bins;
     FP_DATA_TYPE *cos_bins;
     FP_DATA_TYPE *tan_bins;
 
-    TrigBuff(size_t num_bins, AngleType default_angle_type);
+    FP_DATA_TYPE interpolate(FP_DATA_TYPE const *bins, FP_DATA_TYPE bin_position) const;
+
     TrigBuff(TrigBuff const&) = delete;
     TrigBuff(TrigBuff&&) = delete;
 
 public:
-    static TrigBuff const* init_instance(size_t num_bins, AngleType default_angle_type);
+    TrigBuff(size_t num_bins, AngleType default_angle_type, bool interpolated = false);
+
+    static TrigBuff const* init_instance(size_t num_bins, AngleType default_angle_type, bool interpolated = false);
     static void destroy_instance();
     static TrigBuff const* get_instance()
     {
-        if (TrigBuff::instance != nullptr)
+        TrigBuff const *current_instance = TrigBuff::instance.load(std::memory_order_acquire);
+        if (current_instance != nullptr)
         {
-            return TrigBuff::instance;
+            return current_instance;
         }
         else
         {
@@ -47,6 +58,10 @@ public:
 
     virtual ~TrigBuff();
 
+    size_t get_num_bins() const;
+    AngleType get_default_angle_type() const;
+    bool is_interpolated() const;
+
     FP_DATA_TYPE wrap(FP_DATA_TYPE angle) const;
     FP_DATA_TYPE wrap(FP_DATA_TYPE angle, AngleType angle_type) const;
     FP_DATA_TYPE get_sin(FP_DATA_TYPE angle) const;
@@ -57,6 +72,10 @@ public:
     FP_DATA_TYPE get_tan(FP_DATA_TYPE angle, AngleType angle_type) const;
     RotMat get_rot_mat(FP_DATA_TYPE angle) const;
     RotMat get_rot_mat(FP_DATA_TYPE angle, AngleType angle_type) const;
+
+    // Sines and cosines of an array of finite angles in the default angle type. Interpolated buffers evaluate these
+    // without branches, so that the loop can be vectorised.
+    void get_sin_cos(FP_DATA_TYPE const *angles, FP_DATA_TYPE *sins, FP_DATA_TYPE *coss, size_t count) const;
 };
 
 }
@@ -39,6 +39,10 @@ public:
     {
         throw typename GhostLane<T_id>::GhostObjectException();
     }
+    geometry::ArcLengthTable const& get_left_boundary_arc_lengths() const override
+    {
+        throw typename GhostLane<T_id>::GhostObjectException();
+    }
     structures::IArray<geometry::Tri> const* get_tris() const override
     {
         throw typename GhostLane<T_id>::GhostObjectException();
@@ -47,6 +51,11 @@ public:
     {
         throw typename GhostLane<T_id>::GhostObjectException();
     }
+    void check_encapsulation(geometry::Vecs const &points,
+                             structures::IStackArray<size_t> *encapsulated_point_indices) const override
+    {
+        throw typename GhostLane<T_id>::GhostObjectException();
+    }
     geometry::Vec const& get_centroid() const override
     {
         throw typename GhostLane<T_id>::GhostObjectException();
@@ -2,9 +2,12 @@
 
 #include <ori/simcars/structures/set_interface.hpp>
 #include <ori/simcars/structures/dictionary_interface.hpp>
+#include <ori/simcars/geometry/interval_index.hpp>
 #include <ori/simcars/map/file_based_map_abstract.hpp>
 #include <ori/simcars/map/highd/highd_declarations.hpp>
 
+#include <vector>
+
 namespace ori
 {
 namespace simcars
@@ -20,6 +23,12 @@ class HighDMap : public virtual AFileBasedMap<uint8_t, HighDMap>
 
     structures::ISet<IMapObject<uint8_t> const*> *stray_ghosts;
 
+    // HighD lanes are straight and run along the x axis, so they are indexed by the y extents of their bounding boxes
+    std::vector<HighDLane const*> indexed_lanes;
+    geometry::IntervalIndex lane_index;
+
+    void build_lane_index();
+
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
     void load_virt(std::ifstream &input_filestream) override;
@@ -29,6 +38,9 @@ public:
 
     ILane<uint8_t> const* get_lane(uint8_t id) const override;
     ILaneArray<uint8_t> const* get_encapsulating_lanes(geometry::Vec point) const override;
+    void get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<uint8_t> const*> *lanes) const override;
+    void get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                       structures::IStackArray<ILane<uint8_t> const*> *lanes) const override;
     ILaneArray<uint8_t> const* get_lanes(structures::IArray<uint8_t> const *ids) const override;
     ILaneArray<uint8_t> const* get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const override;
     ITrafficLight<uint8_t> const* get_traffic_light(uint8_t id) const override;
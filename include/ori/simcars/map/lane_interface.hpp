@@ -1,9 +1,11 @@
 #pragma once
 
 #include <ori/simcars/structures/array_interface.hpp>
+#include <ori/simcars/structures/stack_array_interface.hpp>
 #include <ori/simcars/geometry/typedefs.hpp>
 #include <ori/simcars/geometry/tri.hpp>
 #include <ori/simcars/geometry/rect.hpp>
+#include <ori/simcars/geometry/arc_length_table.hpp>
 #include <ori/simcars/map/soul_interface.hpp>
 #include <ori/simcars/map/declarations.hpp>
 #include <ori/simcars/map/map_object_interface.hpp>
@@ -31,8 +33,12 @@ public:
 
     virtual geometry::Vecs const& get_left_boundary() const = 0;
     virtual geometry::Vecs const& get_right_boundary() const = 0;
+    virtual geometry::ArcLengthTable const& get_left_boundary_arc_lengths() const = 0;
     virtual structures::IArray<geometry::Tri> const* get_tris() const = 0;
     virtual bool check_encapsulation(geometry::Vec const &point) const = 0;
+    // Indices of the encapsulated points are appended in ascending order
+    virtual void check_encapsulation(geometry::Vecs const &points,
+                                     structures::IStackArray<size_t> *encapsulated_point_indices) const = 0;
     virtual geometry::Vec const& get_centroid() const = 0;
     virtual size_t get_point_count() const = 0;
     virtual geometry::Rect const& get_bounding_box() const = 0;
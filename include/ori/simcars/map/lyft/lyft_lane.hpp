@@ -1,7 +1,9 @@
 #pragma once
 
 #include <ori/simcars/structures/stack_array_interface.hpp>
+#include <ori/simcars/geometry/tri_batch.hpp>
 #include <ori/simcars/map/living_lane_abstract.hpp>
+#include <ori/simcars/map/lyft/lyft_map_cache_file.hpp>
 
 #include <rapidjson/document.h>
 
@@ -17,8 +19,10 @@ namespace lyft
 class LyftLane : public ALivingLane<std::string>
 {
     geometry::Vecs left_boundary, right_boundary;
+    geometry::ArcLengthTable left_boundary_arc_lengths;
     geometry::Vec centroid;
     structures::IStackArray<geometry::Tri> *tris;
+    geometry::TriBatch tri_batch;
     size_t point_count;
     FP_DATA_TYPE mean_steer;
     geometry::Rect bounding_box;
@@ -26,12 +30,17 @@ class LyftLane : public ALivingLane<std::string>
 
 public:
     LyftLane(std::string const &id, IMap<std::string> const *map, rapidjson::Value::ConstObject const &json_lane_data);
+    LyftLane(std::string const &id, IMap<std::string> const *map, LyftMapCacheFile const &cache_file,
+             LyftMapCacheLaneEntry const &cache_lane_entry);
     ~LyftLane() override;
 
     geometry::Vecs const& get_left_boundary() const override;
     geometry::Vecs const& get_right_boundary() const override;
+    geometry::ArcLengthTable const& get_left_boundary_arc_lengths() const override;
     structures::IArray<geometry::Tri> const* get_tris() const override;
     bool check_encapsulation(geometry::Vec const &point) const override;
+    void check_encapsulation(geometry::Vecs const &points,
+                             structures::IStackArray<size_t> *encapsulated_point_indices) const override;
     geometry::Vec const& get_centroid() const override;
     size_t get_point_count() const override;
     geometry::Rect const& get_bounding_box() const override;
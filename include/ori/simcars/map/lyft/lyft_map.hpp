@@ -11,6 +11,7 @@
 #include <ori/simcars/map/lyft/lyft_declarations.hpp>
 #include <ori/simcars/map/lyft/lyft_lane.hpp>
 #include <ori/simcars/map/lyft/lyft_traffic_light.hpp>
+#include <ori/simcars/map/lyft/lyft_map_cache_file.hpp>
 
 #include <string>
 
@@ -32,6 +33,10 @@ class LyftMap : public virtual AFileBasedMap<std::string, LyftMap>
 
     geometry::GridDictionary<MapGridRect<std::string>> *map_grid_dict;
 
+    void load_cache(LyftMapCacheFile const &cache_file);
+    void save_cache(std::string const &output_file_path_str, uint64_t source_hash, uint64_t source_size,
+                    int64_t source_mtime) const;
+
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
     void load_virt(std::ifstream &input_filestream) override;
@@ -39,8 +44,17 @@ protected:
 public:
     ~LyftMap() override;
 
+    // Loads the map from a cache built on a previous load of the same source file, if the cache is missing, stale
+    // or unreadable the map is loaded from the source file and the cache is (re)built. An empty cache file path
+    // places the cache next to the source file.
+    static LyftMap const* load_cached(std::string const &input_file_path_str,
+                                      std::string const &cache_file_path_str = "");
+
     ILane<std::string> const* get_lane(std::string id) const override;
     ILaneArray<std::string> const* get_encapsulating_lanes(geometry::Vec point) const override;
+    void get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<std::string> const*> *lanes) const override;
+    void get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                       structures::IStackArray<ILane<std::string> const*> *lanes) const override;
     ILaneArray<std::string> const* get_lanes(structures::IArray<std::string> const *ids) const override;
     ILaneArray<std::string> const* get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const override;
     ITrafficLight<std::string> const* get_traffic_light(std::string id) const override;
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <ori/simcars/map/lyft/lyft_map_cache_format.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace ori
+{
+namespace simcars
+{
+namespace map
+{
+namespace lyft
+{
+
+// Read-only memory mapping of a Lyft map cache file. The header and section bounds are validated when the file
+// is opened, ranges and strings are bounds checked as they are looked up.
+class LyftMapCacheFile
+{
+    void *data;
+    size_t size;
+
+    void const* get_section(LyftMapCacheSection section) const;
+
+public:
+    LyftMapCacheFile(std::string const &input_file_path_str);
+    LyftMapCacheFile(LyftMapCacheFile const&) = delete;
+
+    ~LyftMapCacheFile();
+
+    // FNV-1a hash of the contents of a file, used to tie a cache to the source map it was built from
+    static uint64_t hash_source_file(std::string const &input_file_path_str, uint64_t &source_size);
+
+    LyftMapCacheHeader const& get_header() const;
+
+    size_t get_count(LyftMapCacheSection section) const;
+
+    template <typename T>
+    T const* get_elements(LyftMapCacheSection section) const
+    {
+        return static_cast<T const*>(get_section(section));
+    }
+    template <typename T>
+    T const* get_elements(LyftMapCacheSection section, LyftMapCacheRange const &range) const
+    {
+        if (range.first > get_count(section) || range.count > get_count(section) - range.first)
+        {
+            throw std::runtime_error("Lyft map cache file has an invalid range");
+        }
+        return get_elements<T>(section) + range.first;
+    }
+
+    std::string get_string(LyftMapCacheStringRef const &string_ref) const;
+};
+
+}
+}
+}
+}
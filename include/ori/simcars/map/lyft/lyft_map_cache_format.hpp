@@ -0,0 +1,165 @@
+#pragma once
+
+#include <ori/simcars/geometry/typedefs.hpp>
+
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#define LYFT_MAP_CACHE_MAGIC "SCLMAPC"
+#define LYFT_MAP_CACHE_MAGIC_LENGTH 8
+#define LYFT_MAP_CACHE_VERSION 3
+#define LYFT_MAP_CACHE_BYTE_ORDER_MARK 0x01020304
+#define LYFT_MAP_CACHE_SECTION_ALIGNMENT 8
+
+namespace ori
+{
+namespace simcars
+{
+namespace map
+{
+namespace lyft
+{
+
+// Layout of a Lyft map cache file (version 3), all values are stored in the byte order of the machine
+// that wrote the file (checked on load through the byte order mark), and scalars are stored as the
+// FP_DATA_TYPE of the build that wrote the file (checked on load through the scalar size):
+//
+//   LyftMapCacheHeader
+//   Sections listed in the header, each aligned to LYFT_MAP_CACHE_SECTION_ALIGNMENT bytes
+//
+// Everything derived from the source map on load (boundaries, triangulations, mean steers, bounding boxes and
+// the grid lanes and traffic lights are binned into) is stored, so a cached map is rebuilt without any
+// geometry being recomputed. Ids are stored in a string pool, lists of ids are stored as runs of string
+// references. A cache is only valid for the source file whose hash it records, and for builds with the same
+// scalar type as the one that wrote it. The size and modification time of the source file are recorded as well,
+// so that an unchanged source file need not be hashed to tell that its cache is up to date.
+
+enum class LyftMapCacheSection : uint32_t
+{
+    LANES = 0,
+    TRAFFIC_LIGHTS = 1,
+    GRID_CELLS = 2,
+    POINTS = 3,
+    TRIS = 4,
+    STRING_REFS = 5,
+    INDICES = 6,
+    FACES = 7,
+    STATES = 8,
+    STRINGS = 9,
+    COUNT = 10
+};
+
+#define LYFT_MAP_CACHE_SECTION_COUNT std::size_t(LyftMapCacheSection::COUNT)
+
+struct LyftMapCacheSectionEntry
+{
+    uint64_t offset;
+    uint64_t count;
+};
+
+struct LyftMapCacheHeader
+{
+    char magic[LYFT_MAP_CACHE_MAGIC_LENGTH];
+    uint32_t version;
+    uint32_t byte_order_mark;
+    uint32_t scalar_size;
+    uint32_t reserved;
+    uint64_t source_hash;
+    uint64_t source_size;
+    int64_t source_mtime;
+    FP_DATA_TYPE grid_origin[2];
+    FP_DATA_TYPE grid_spacing;
+    uint32_t padding;
+    LyftMapCacheSectionEntry sections[LYFT_MAP_CACHE_SECTION_COUNT];
+};
+
+// Range of a pool section
+struct LyftMapCacheRange
+{
+    uint64_t first;
+    uint64_t count;
+};
+
+struct LyftMapCacheStringRef
+{
+    uint64_t offset;
+    uint64_t length;
+};
+
+struct LyftMapCachePoint
+{
+    FP_DATA_TYPE x;
+    FP_DATA_TYPE y;
+};
+
+struct LyftMapCacheTri
+{
+    LyftMapCachePoint points[3];
+};
+
+struct LyftMapCacheLaneEntry
+{
+    LyftMapCacheStringRef id;
+    LyftMapCacheRange left_boundary;
+    LyftMapCacheRange right_boundary;
+    LyftMapCacheRange tris;
+    LyftMapCachePoint centroid;
+    FP_DATA_TYPE bounding_box[4];
+    FP_DATA_TYPE mean_steer;
+    int32_t access_restriction;
+    // Empty when there is no adjacent lane
+    LyftMapCacheStringRef left_adjacent_lane_id;
+    LyftMapCacheStringRef right_adjacent_lane_id;
+    // Ranges of the string reference pool
+    LyftMapCacheRange fore_lane_ids;
+    LyftMapCacheRange aft_lane_ids;
+    LyftMapCacheRange traffic_light_ids;
+};
+
+struct LyftMapCacheFace
+{
+    int32_t face_colour;
+    int32_t face_type;
+};
+
+struct LyftMapCacheState
+{
+    int64_t timestamp;
+    int32_t active_face;
+    uint32_t padding;
+};
+
+struct LyftMapCacheTrafficLightEntry
+{
+    LyftMapCacheStringRef id;
+    LyftMapCachePoint position;
+    FP_DATA_TYPE orientation;
+    // Traffic lights without face or state data in the source have neither dictionary
+    uint32_t has_faces;
+    uint32_t has_states;
+    uint32_t padding;
+    LyftMapCacheRange faces;
+    LyftMapCacheRange states;
+};
+
+struct LyftMapCacheGridCellEntry
+{
+    LyftMapCachePoint origin;
+    // Ranges of the index pool, holding indices into the lane and traffic light tables respectively
+    LyftMapCacheRange lanes;
+    LyftMapCacheRange traffic_lights;
+};
+
+static_assert(std::is_trivially_copyable<LyftMapCacheHeader>::value &&
+              std::is_trivially_copyable<LyftMapCacheLaneEntry>::value &&
+              std::is_trivially_copyable<LyftMapCacheTrafficLightEntry>::value &&
+              std::is_trivially_copyable<LyftMapCacheGridCellEntry>::value,
+              "Lyft map cache records must be trivially copyable");
+static_assert(sizeof(LyftMapCacheHeader) % LYFT_MAP_CACHE_SECTION_ALIGNMENT == 0,
+              "Lyft map cache sections would be misaligned");
+
+}
+}
+}
+}
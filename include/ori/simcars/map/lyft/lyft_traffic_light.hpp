@@ -29,6 +29,10 @@ public:
                      ITrafficLightStateHolder::IFaceDictionary *face_colour_to_face_type_dict,
                      ITrafficLightStateHolder::TemporalStateDictionary *timestamp_to_state_dict,
                      rapidjson::Value::ConstObject const &json_traffic_light_data);
+    LyftTrafficLight(std::string const &id, IMap<std::string> const *map,
+                     ITrafficLightStateHolder::IFaceDictionary *face_colour_to_face_type_dict,
+                     ITrafficLightStateHolder::TemporalStateDictionary *timestamp_to_state_dict,
+                     geometry::Vec const &position, FP_DATA_TYPE orientation);
     ~LyftTrafficLight();
 
     ITrafficLightStateHolder::State const* get_state(temporal::Time timestamp) const override;
@@ -37,6 +41,9 @@ public:
     FP_DATA_TYPE get_orientation() const override;
     structures::IArray<ITrafficLightStateHolder::FaceColour> const* get_face_colours() const override;
     ITrafficLightStateHolder::FaceType get_face_type(ITrafficLightStateHolder::FaceColour face_colour) const override;
+
+    ITrafficLightStateHolder::IFaceDictionary const* get_face_colour_to_face_type_dict() const;
+    ITrafficLightStateHolder::TemporalStateDictionary const* get_timestamp_to_state_dict() const;
 };
 
 }
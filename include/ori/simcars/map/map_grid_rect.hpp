@@ -2,11 +2,17 @@
 
 #include <ori/simcars/utils/exceptions.hpp>
 #include <ori/simcars/structures/stl/stl_set.hpp>
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/geometry/grid_rect.hpp>
+#include <ori/simcars/geometry/grid_dictionary.hpp>
 #include <ori/simcars/map/map_object.hpp>
 #include <ori/simcars/map/living_lane_stack_array.hpp>
 #include <ori/simcars/map/living_traffic_light_stack_array.hpp>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace ori
 {
 namespace simcars
@@ -32,10 +38,16 @@ public:
     }
 
     ILaneArray<T_id> const* get_encapsulating_lanes(geometry::Vec point) const
+    {
+        LivingLaneStackArray<T_id> *encapsulating_lanes =
+                new LivingLaneStackArray<T_id>;
+        get_encapsulating_lanes(point, encapsulating_lanes);
+        return encapsulating_lanes;
+    }
+    // Encapsulating lanes are appended to the given array
+    void get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<T_id> const*> *encapsulating_lanes) const
     {
         structures::IArray<ILane<T_id> const*> const *lane_array = lanes->get_array();
-        LivingLaneStackArray<std::string> *encapsulating_lanes =
-                new LivingLaneStackArray<std::string>;
         size_t i;
         for (i = 0; i < lane_array->count(); ++i)
         {
@@ -45,7 +57,27 @@ public:
                 encapsulating_lanes->push_back(lane);
             }
         }
-        return encapsulating_lanes;
+    }
+    // Calls the visitor with each lane and the index of each given point it encapsulates, lanes are visited in the
+    // order get_encapsulating_lanes gives them and each is tested against all of the points at once
+    template <typename F_visitor>
+    void visit_encapsulating_lanes(geometry::Vecs const &points, F_visitor visitor) const
+    {
+        // Grid rects are shared between threads, hence the indices being per thread
+        thread_local structures::stl::STLStackArray<size_t> point_idxs;
+
+        structures::IArray<ILane<T_id> const*> const *lane_array = lanes->get_array();
+        size_t i, j;
+        for (i = 0; i < lane_array->count(); ++i)
+        {
+            ILane<T_id> const *lane = (*lane_array)[i];
+            point_idxs.clear();
+            lane->check_encapsulation(points, &point_idxs);
+            for (j = 0; j < point_idxs.count(); ++j)
+            {
+                visitor(lane, point_idxs[j]);
+            }
+        }
     }
     structures::ISet<ILane<T_id> const*> const* get_lanes() const
     {
@@ -77,6 +109,52 @@ public:
     }
 };
 
+// Points are grouped by the grid rect they fall in, so each lane of a rect is tested against all of the points in it
+// at once, the visitor is called as MapGridRect::visit_encapsulating_lanes calls it with indices into the given points
+template <typename T_id, typename F_visitor>
+void visit_encapsulating_lanes(geometry::GridDictionary<MapGridRect<T_id>> const *map_grid_dict,
+                               geometry::Vecs const &points, F_visitor visitor)
+{
+    thread_local std::vector<std::pair<MapGridRect<T_id> const*, size_t>> grid_rect_point_idxs;
+    thread_local geometry::Vecs grid_rect_points;
+
+    grid_rect_point_idxs.clear();
+    size_t i, j;
+    for (i = 0; i < size_t(points.cols()); ++i)
+    {
+        MapGridRect<T_id> const *map_grid_rect = map_grid_dict->get_grid_rect(points.col(i));
+        if (map_grid_rect)
+        {
+            grid_rect_point_idxs.emplace_back(map_grid_rect, i);
+        }
+    }
+    std::sort(grid_rect_point_idxs.begin(), grid_rect_point_idxs.end());
+
+    for (i = 0; i < grid_rect_point_idxs.size(); i = j)
+    {
+        MapGridRect<T_id> const *map_grid_rect = grid_rect_point_idxs[i].first;
+        j = i + 1;
+        while (j < grid_rect_point_idxs.size() && grid_rect_point_idxs[j].first == map_grid_rect)
+        {
+            ++j;
+        }
+
+        grid_rect_points.resize(2, j - i);
+        size_t k;
+        for (k = i; k < j; ++k)
+        {
+            grid_rect_points.col(k - i) = points.col(grid_rect_point_idxs[k].second);
+        }
+
+        map_grid_rect->visit_encapsulating_lanes(
+                    grid_rect_points,
+                    [&visitor, i](ILane<T_id> const *lane, size_t point_idx)
+                    {
+                        visitor(lane, grid_rect_point_idxs[i + point_idx].second);
+                    });
+    }
+}
+
 }
 }
 }
@@ -2,6 +2,7 @@
 
 #include <ori/simcars/geometry/typedefs.hpp>
 #include <ori/simcars/structures/array_interface.hpp>
+#include <ori/simcars/structures/stack_array_interface.hpp>
 #include <ori/simcars/map/declarations.hpp>
 
 #include <exception>
@@ -21,6 +22,13 @@ public:
 
     virtual ILane<T_id> const* get_lane(T_id id) const = 0;
     virtual ILaneArray<T_id> const* get_encapsulating_lanes(geometry::Vec point) const = 0;
+    // Clears the given array and fills it with the encapsulating lanes, callers reusing an array across queries
+    // avoid allocating for each one
+    virtual void get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<T_id> const*> *lanes) const = 0;
+    // Resizes the given array to the number of points and sets each entry to the first of the lanes
+    // get_encapsulating_lanes would give for that point, or null, lanes are tested against batches of points at once
+    virtual void get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                               structures::IStackArray<ILane<T_id> const*> *lanes) const = 0;
     virtual ILaneArray<T_id> const* get_lanes(structures::IArray<T_id> const *ids) const = 0;
     virtual ILaneArray<T_id> const* get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const = 0;
     virtual ITrafficLight<T_id> const* get_traffic_light(T_id id) const = 0;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ori/simcars/geometry/tri_batch.hpp>
 #include <ori/simcars/map/living_lane_abstract.hpp>
 
 namespace ori
@@ -14,8 +15,10 @@ namespace plg
 class PLGLane : public ALivingLane<uint8_t>
 {
     geometry::Vecs left_boundary, right_boundary;
+    geometry::ArcLengthTable left_boundary_arc_lengths;
     geometry::Vec centroid;
     structures::IStackArray<geometry::Tri> *tris;
+    geometry::TriBatch tri_batch;
     size_t point_count;
     FP_DATA_TYPE mean_steer;
     geometry::Rect bounding_box;
@@ -27,8 +30,11 @@ public:
 
     geometry::Vecs const& get_left_boundary() const override;
     geometry::Vecs const& get_right_boundary() const override;
+    geometry::ArcLengthTable const& get_left_boundary_arc_lengths() const override;
     structures::IArray<geometry::Tri> const* get_tris() const override;
     bool check_encapsulation(geometry::Vec const &point) const override;
+    void check_encapsulation(geometry::Vecs const &points,
+                             structures::IStackArray<size_t> *encapsulated_point_indices) const override;
     geometry::Vec const& get_centroid() const override;
     size_t get_point_count() const override;
     geometry::Rect const& get_bounding_box() const override;
@@ -2,9 +2,13 @@
 
 #include <ori/simcars/structures/set_interface.hpp>
 #include <ori/simcars/structures/dictionary_interface.hpp>
+#include <ori/simcars/geometry/grid_dictionary.hpp>
 #include <ori/simcars/map/file_based_map_abstract.hpp>
+#include <ori/simcars/map/map_grid_rect.hpp>
 #include <ori/simcars/map/plg/plg_declarations.hpp>
 
+#define PLG_MAP_GRID_SPACING FP_DATA_TYPE(10.0)
+
 namespace ori
 {
 namespace simcars
@@ -20,6 +24,10 @@ class PLGMap : public virtual AFileBasedMap<uint8_t, PLGMap>
 
     structures::ISet<IMapObject<uint8_t> const*> *stray_ghosts;
 
+    geometry::GridDictionary<MapGridRect<uint8_t>> *map_grid_dict;
+
+    void build_map_grid_dict();
+
 protected:
     void save_virt(std::ofstream &output_filestream) const override;
     void load_virt(std::ifstream &input_filestream) override;
@@ -29,6 +37,9 @@ public:
 
     ILane<uint8_t> const* get_lane(uint8_t id) const override;
     ILaneArray<uint8_t> const* get_encapsulating_lanes(geometry::Vec point) const override;
+    void get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<uint8_t> const*> *lanes) const override;
+    void get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                       structures::IStackArray<ILane<uint8_t> const*> *lanes) const override;
     ILaneArray<uint8_t> const* get_lanes(structures::IArray<uint8_t> const *ids) const override;
     ILaneArray<uint8_t> const* get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const override;
     ITrafficLight<uint8_t> const* get_traffic_light(uint8_t id) const override;
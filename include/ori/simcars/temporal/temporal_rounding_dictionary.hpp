@@ -33,6 +33,17 @@ public:
     TemporalRoundingDictionary(Duration time_window_step, V const &default_value)
         : time_window_step(time_window_step), default_value(default_value),
           keys_cache(nullptr), values_cache(nullptr) {}
+    TemporalRoundingDictionary(TemporalRoundingDictionary<V> const &temporal_rounding_dictionary)
+        : time_window_step(temporal_rounding_dictionary.time_window_step),
+          default_value(temporal_rounding_dictionary.default_value),
+          keys_cache(nullptr), values_cache(nullptr)
+    {
+        std::lock_guard<std::recursive_mutex> value_deque_guard(
+                    temporal_rounding_dictionary.value_deque_mutex);
+
+        time_window_start = temporal_rounding_dictionary.time_window_start;
+        value_deque = temporal_rounding_dictionary.value_deque;
+    }
 
     ~TemporalRoundingDictionary() override
     {
@@ -0,0 +1,364 @@
+#pragma once
+
+#include <ori/simcars/temporal/typedefs.hpp>
+
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+
+#define UNPROPAGATED_IDX_NONE SIZE_MAX
+
+namespace ori
+{
+namespace simcars
+{
+namespace temporal
+{
+
+// Dense alternative to TemporalRoundingDictionary for data recorded or simulated at a fixed time step.
+// Values are stored inline with one slot per time step, and runs of equal (held) values are tracked
+// as they are written, so lookups by time are O(1), appending is amortised O(1) and the distinct
+// values can be enumerated run by run without any hashing. Values appended to the end of the series
+// are assumed not to repeat the value of an earlier run.
+//
+// Reads never lock or modify the series, so any number of threads may read concurrently, but writes
+// must not run concurrently with reads or other writes. Propagating values forward over a range that
+// has already been propagated writes nothing, so it may run alongside reads once that is the case.
+template <typename V>
+class TemporalSeries
+{
+    Time time_window_start;
+    Duration time_window_step;
+    V default_value;
+
+    std::vector<V> values;
+
+    // Index of the first slot of each run of equal values
+    std::vector<size_t> run_starts;
+
+    // Slots before this index have already been propagated forward
+    size_t unpropagated_idx;
+
+    bool get_idx(Time time, size_t &idx) const
+    {
+        if (values.size() == 0 || time < time_window_start)
+        {
+            return false;
+        }
+
+        idx = (time - time_window_start).count() / time_window_step.count();
+        return idx < values.size();
+    }
+
+    size_t get_run_idx(size_t idx) const
+    {
+        return size_t(std::upper_bound(run_starts.begin(), run_starts.end(), idx) -
+                      run_starts.begin()) - 1;
+    }
+    size_t get_run_end(size_t run_idx) const
+    {
+        return run_idx + 1 < run_starts.size() ? run_starts[run_idx + 1] : values.size();
+    }
+
+    void push_back_value(V const &value)
+    {
+        if (values.size() == 0 || values.back() != value)
+        {
+            run_starts.push_back(values.size());
+        }
+        values.push_back(value);
+    }
+
+    // Recalculates every run from the one containing the slot at idx onwards
+    void rebuild_runs(size_t idx)
+    {
+        run_starts.erase(std::lower_bound(run_starts.begin(), run_starts.end(), idx),
+                         run_starts.end());
+
+        for (size_t i = idx; i < values.size(); ++i)
+        {
+            if (i == 0 || values[i] != values[i - 1])
+            {
+                run_starts.push_back(i);
+            }
+        }
+    }
+
+    // Replaces the value in every slot from idx onwards, returning the first slot replaced (if any)
+    size_t clear_value(V const &value, size_t idx)
+    {
+        size_t cleared_idx = values.size();
+        for (size_t i = idx; i < values.size(); ++i)
+        {
+            if (values[i] == value)
+            {
+                values[i] = default_value;
+                cleared_idx = std::min(cleared_idx, i);
+            }
+        }
+        return cleared_idx;
+    }
+
+    void mark_unpropagated(size_t idx)
+    {
+        unpropagated_idx = std::min(unpropagated_idx, idx);
+    }
+
+    // Follows the same rules as TemporalRoundingDictionary, slots holding the default value or the
+    // value of an earlier run are replaced by the value of the run before them
+    void propogate_values_forward_to_idx(size_t end_idx)
+    {
+        if (values.size() == 0)
+        {
+            return;
+        }
+
+        size_t processed_end_idx = std::min(end_idx, values.size());
+
+        if (unpropagated_idx < processed_end_idx)
+        {
+            size_t run_idx = get_run_idx(unpropagated_idx);
+            size_t start_idx = run_starts[run_idx];
+
+            std::unordered_set<V> previous_values(run_starts.size() + 1);
+            previous_values.insert(default_value);
+
+            V current_value = default_value;
+            if (run_idx > 0)
+            {
+                for (size_t i = 0; i + 1 < run_idx; ++i)
+                {
+                    previous_values.insert(values[run_starts[i]]);
+                }
+                current_value = values[run_starts[run_idx - 1]];
+            }
+
+            for (size_t i = start_idx; i < processed_end_idx; ++i)
+            {
+                if (values[i] != current_value)
+                {
+                    if (previous_values.contains(values[i]))
+                    {
+                        values[i] = current_value;
+                    }
+                    else
+                    {
+                        previous_values.insert(current_value);
+                        current_value = values[i];
+                    }
+                }
+            }
+
+            rebuild_runs(start_idx);
+
+            unpropagated_idx = processed_end_idx < values.size() ? processed_end_idx :
+                                                                   UNPROPAGATED_IDX_NONE;
+        }
+
+        while (values.size() < end_idx)
+        {
+            push_back_value(values.back());
+        }
+    }
+
+public:
+    TemporalSeries(Duration time_window_step, V const &default_value)
+        : time_window_step(time_window_step), default_value(default_value),
+          unpropagated_idx(UNPROPAGATED_IDX_NONE) {}
+
+    // Number of time steps covered, including those holding the default value
+    size_t count() const
+    {
+        return values.size();
+    }
+    bool contains(Time time) const
+    {
+        size_t idx;
+        return get_idx(time, idx) && values[idx] != default_value;
+    }
+    bool contains(Time time, bool exact) const
+    {
+        size_t idx;
+        return get_idx(time, idx) &&
+                (!exact || time_window_start + time_window_step * DurationRep(idx) == time) &&
+                values[idx] != default_value;
+    }
+
+    V const& operator [](Time time) const
+    {
+        size_t idx;
+        if (get_idx(time, idx))
+        {
+            return values[idx];
+        }
+        else
+        {
+            return default_value;
+        }
+    }
+
+    size_t get_run_count() const
+    {
+        return run_starts.size();
+    }
+    Time get_run_start_time(size_t run_idx) const
+    {
+        return time_window_start + time_window_step * DurationRep(run_starts[run_idx]);
+    }
+    V const& get_run_value(size_t run_idx) const
+    {
+        return values[run_starts[run_idx]];
+    }
+
+    Time get_earliest_timestamp() const
+    {
+        if (values.size() == 0)
+        {
+            throw std::out_of_range("Temporal series is empty");
+        }
+
+        return time_window_start;
+    }
+    Time get_latest_timestamp() const
+    {
+        if (values.size() == 0)
+        {
+            throw std::out_of_range("Temporal series is empty");
+        }
+
+        return time_window_start + time_window_step * DurationRep(values.size() - 1);
+    }
+    Duration get_time_window_step() const
+    {
+        return time_window_step;
+    }
+    V get_default_value() const
+    {
+        return default_value;
+    }
+
+    void update(Time time, V const &value)
+    {
+        if (values.size() == 0)
+        {
+            time_window_start = time;
+            push_back_value(value);
+        }
+        else if (time < time_window_start)
+        {
+            size_t prepended_count =
+                    ((time_window_start - time).count() + time_window_step.count() - 1) /
+                    time_window_step.count();
+            values.insert(values.begin(), prepended_count, default_value);
+            time_window_start -= time_window_step * DurationRep(prepended_count);
+            values[(time - time_window_start).count() / time_window_step.count()] = value;
+
+            rebuild_runs(0);
+            unpropagated_idx = 0;
+        }
+        else
+        {
+            size_t idx = (time - time_window_start).count() / time_window_step.count();
+            if (idx >= values.size())
+            {
+                if (idx > values.size())
+                {
+                    mark_unpropagated(values.size());
+                }
+                while (values.size() < idx)
+                {
+                    push_back_value(default_value);
+                }
+                push_back_value(value);
+            }
+            else
+            {
+                values[idx] = value;
+
+                rebuild_runs(idx);
+                mark_unpropagated(idx);
+            }
+        }
+    }
+    void erase(Time time)
+    {
+        size_t idx;
+        if (!get_idx(time, idx))
+        {
+            return;
+        }
+
+        V value_to_erase = values[idx];
+
+        // As with TemporalRoundingDictionary, any other slots still holding the erased value are
+        // cleared too
+        if (idx == 0)
+        {
+            size_t run_end = get_run_end(0);
+            values.erase(values.begin(), values.begin() + run_end);
+            time_window_start += time_window_step * DurationRep(run_end);
+            if (unpropagated_idx != UNPROPAGATED_IDX_NONE)
+            {
+                unpropagated_idx = unpropagated_idx > run_end ? unpropagated_idx - run_end : 0;
+            }
+
+            size_t cleared_idx = clear_value(value_to_erase, 0);
+            mark_unpropagated(cleared_idx);
+            rebuild_runs(0);
+        }
+        else if (idx == values.size() - 1)
+        {
+            // Only the slots from the erased one onwards are cleared, as in the middle of the series, which for the
+            // last slot is just that slot
+            values.pop_back();
+            if (run_starts.back() == values.size())
+            {
+                run_starts.pop_back();
+            }
+            if (unpropagated_idx != UNPROPAGATED_IDX_NONE && unpropagated_idx >= values.size())
+            {
+                unpropagated_idx = UNPROPAGATED_IDX_NONE;
+            }
+        }
+        else
+        {
+            clear_value(value_to_erase, idx);
+            mark_unpropagated(idx);
+            rebuild_runs(idx);
+        }
+    }
+    // Replaces every value other than the default with the one the given function gives for it, which must give
+    // distinct values for distinct values and never the default, so that the runs are left as they are
+    template <typename F_remap>
+    void remap_values(F_remap remap)
+    {
+        for (V &value : values)
+        {
+            if (value != default_value)
+            {
+                value = remap(value);
+            }
+        }
+    }
+    void propogate_values_forward()
+    {
+        propogate_values_forward_to_idx(values.size());
+    }
+    void propogate_values_forward(Time time_window_end)
+    {
+        if (values.size() == 0 || time_window_end < time_window_start)
+        {
+            return;
+        }
+
+        propogate_values_forward_to_idx(
+                    size_t((time_window_end - time_window_start).count() /
+                           time_window_step.count()) + 1);
+    }
+};
+
+}
+}
+}
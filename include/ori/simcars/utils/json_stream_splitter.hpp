@@ -0,0 +1,249 @@
+#pragma once
+
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ori
+{
+namespace simcars
+{
+namespace utils
+{
+
+// SAX handler which splits a JSON stream into the values found at a given nesting depth, materialising each one
+// as its own small document and handing it over before moving onto the next, so a large file never has to be
+// held as a single DOM. An element path holds the member key leading into each enclosing container (empty for
+// array members).
+class JSONStreamSplitter
+{
+public:
+    // Called with the element's top level scalar members seen so far, returning false discards the element
+    typedef std::function<bool(rapidjson::Document const &element_scalars)> ElementFilter;
+    // The element may be swapped out of by the handler to keep it beyond the call
+    typedef std::function<void(std::vector<std::string> const &element_path,
+                               rapidjson::Document &element)> ElementHandler;
+
+private:
+    size_t const element_depth;
+    ElementFilter const element_filter;
+    ElementHandler const element_handler;
+
+    std::vector<std::string> key_stack;
+    size_t depth;
+
+    bool element_open;
+    bool element_kept;
+    rapidjson::StringBuffer element_buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> element_writer;
+    rapidjson::Document element_scalars;
+
+    void begin_element()
+    {
+        element_open = true;
+        element_kept = true;
+        element_buffer.Clear();
+        element_writer.Reset(element_buffer);
+        element_scalars.SetObject();
+    }
+
+    void end_element()
+    {
+        element_open = false;
+
+        if (element_kept)
+        {
+            // Full precision so doubles survive the round trip through the buffer unchanged
+            rapidjson::Document element;
+            element.Parse<rapidjson::kParseFullPrecisionFlag>(element_buffer.GetString(), element_buffer.GetSize());
+            element_handler(key_stack, element);
+        }
+
+        element_buffer.Clear();
+    }
+
+    template <typename WriteFunc, typename ValueFunc>
+    bool scalar(WriteFunc write, ValueFunc make_value)
+    {
+        if (depth == element_depth)
+        {
+            begin_element();
+            write();
+            end_element();
+        }
+        else if (element_open && element_kept)
+        {
+            write();
+
+            if (depth == element_depth + 1 && !key_stack.back().empty())
+            {
+                rapidjson::Document::AllocatorType &allocator = element_scalars.GetAllocator();
+                element_scalars.AddMember(rapidjson::Value(key_stack.back().c_str(), allocator).Move(),
+                                          make_value(allocator).Move(), allocator);
+                element_kept = element_filter(element_scalars);
+            }
+        }
+
+        return true;
+    }
+
+    bool start_container(bool is_object)
+    {
+        if (depth == element_depth)
+        {
+            begin_element();
+        }
+
+        if (element_open && element_kept)
+        {
+            if (is_object)
+            {
+                element_writer.StartObject();
+            }
+            else
+            {
+                element_writer.StartArray();
+            }
+        }
+
+        ++depth;
+        key_stack.push_back("");
+
+        return true;
+    }
+
+    bool end_container(bool is_object, rapidjson::SizeType count)
+    {
+        --depth;
+        key_stack.pop_back();
+
+        if (element_open && element_kept)
+        {
+            if (is_object)
+            {
+                element_writer.EndObject(count);
+            }
+            else
+            {
+                element_writer.EndArray(count);
+            }
+        }
+
+        if (depth == element_depth)
+        {
+            end_element();
+        }
+
+        return true;
+    }
+
+public:
+    JSONStreamSplitter(size_t element_depth, ElementFilter const &element_filter,
+                       ElementHandler const &element_handler) :
+        element_depth(element_depth), element_filter(element_filter), element_handler(element_handler),
+        depth(0), element_open(false), element_kept(false), element_writer(element_buffer) {}
+
+    JSONStreamSplitter(size_t element_depth, ElementHandler const &element_handler) :
+        JSONStreamSplitter(element_depth,
+                           [](rapidjson::Document const&) { return true; },
+                           element_handler) {}
+
+    template <typename InputStream>
+    void parse(InputStream &input_stream)
+    {
+        rapidjson::Reader reader;
+        rapidjson::ParseResult const parse_result = reader.Parse(input_stream, *this);
+
+        if (parse_result.IsError())
+        {
+            throw std::runtime_error("JSON parse error at offset " + std::to_string(parse_result.Offset()));
+        }
+    }
+
+    // Reader handler interface
+    bool Null()
+    {
+        return scalar([this]() { element_writer.Null(); },
+                      [](rapidjson::Document::AllocatorType&) { return rapidjson::Value(); });
+    }
+    bool Bool(bool b)
+    {
+        return scalar([this, b]() { element_writer.Bool(b); },
+                      [b](rapidjson::Document::AllocatorType&) { return rapidjson::Value(b); });
+    }
+    bool Int(int i)
+    {
+        return scalar([this, i]() { element_writer.Int(i); },
+                      [i](rapidjson::Document::AllocatorType&) { return rapidjson::Value(i); });
+    }
+    bool Uint(unsigned u)
+    {
+        return scalar([this, u]() { element_writer.Uint(u); },
+                      [u](rapidjson::Document::AllocatorType&) { return rapidjson::Value(u); });
+    }
+    bool Int64(int64_t i)
+    {
+        return scalar([this, i]() { element_writer.Int64(i); },
+                      [i](rapidjson::Document::AllocatorType&) { return rapidjson::Value(i); });
+    }
+    bool Uint64(uint64_t u)
+    {
+        return scalar([this, u]() { element_writer.Uint64(u); },
+                      [u](rapidjson::Document::AllocatorType&) { return rapidjson::Value(u); });
+    }
+    bool Double(double d)
+    {
+        return scalar([this, d]() { element_writer.Double(d); },
+                      [d](rapidjson::Document::AllocatorType&) { return rapidjson::Value(d); });
+    }
+    bool RawNumber(char const *str, rapidjson::SizeType length, bool copy)
+    {
+        return scalar([this, str, length, copy]() { element_writer.RawNumber(str, length, copy); },
+                      [str, length](rapidjson::Document::AllocatorType &allocator)
+                      { return rapidjson::Value(str, length, allocator); });
+    }
+    bool String(char const *str, rapidjson::SizeType length, bool copy)
+    {
+        return scalar([this, str, length, copy]() { element_writer.String(str, length, copy); },
+                      [str, length](rapidjson::Document::AllocatorType &allocator)
+                      { return rapidjson::Value(str, length, allocator); });
+    }
+    bool StartObject()
+    {
+        return start_container(true);
+    }
+    bool Key(char const *str, rapidjson::SizeType length, bool copy)
+    {
+        key_stack.back().assign(str, length);
+
+        if (element_open && element_kept)
+        {
+            element_writer.Key(str, length, copy);
+        }
+
+        return true;
+    }
+    bool EndObject(rapidjson::SizeType member_count)
+    {
+        return end_container(true, member_count);
+    }
+    bool StartArray()
+    {
+        return start_container(false);
+    }
+    bool EndArray(rapidjson::SizeType element_count)
+    {
+        return end_container(false, element_count);
+    }
+};
+
+}
+}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+
+namespace ori
+{
+namespace simcars
+{
+namespace utils
+{
+
+// Fixed size pool of worker threads, each with its own task queue. Workers take tasks from the back
+// of their own queue and, once it is empty, steal from the front of the other queues. Only the queue
+// a task is pushed to or taken from is locked, and workers that find no tasks sleep until one is
+// submitted rather than polling.
+class WorkStealingThreadPool
+{
+    class WorkerQueue
+    {
+    public:
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    size_t thread_count;
+    WorkerQueue *worker_queues;
+    std::vector<std::thread> worker_threads;
+
+    // Counts are changed while holding the lock of the queue concerned, so a queued count of zero means
+    // every queue is empty
+    std::atomic<size_t> queued_task_count;
+    std::atomic<size_t> unfinished_task_count;
+    std::atomic<size_t> next_worker_idx;
+
+    // Only held by workers going to sleep, and by submitters while any are asleep
+    std::mutex idle_mutex;
+    std::condition_variable task_available_condition;
+    std::atomic<size_t> idle_worker_count;
+    bool stopping;
+
+    // Only held once the last unfinished task finishes, or a task throws
+    std::mutex state_mutex;
+    std::condition_variable tasks_finished_condition;
+    std::exception_ptr task_exception;
+
+    bool try_pop_task(size_t worker_idx, std::function<void()> &task);
+    void run_worker(size_t worker_idx);
+
+public:
+    // A thread count of zero uses one thread per hardware thread
+    WorkStealingThreadPool(size_t thread_count = 0);
+    WorkStealingThreadPool(WorkStealingThreadPool const&) = delete;
+
+    ~WorkStealingThreadPool();
+
+    size_t get_thread_count() const;
+
+    // Only succeeds when called from within a task of this pool
+    bool get_current_worker_idx(size_t &worker_idx) const;
+
+    // Tasks submitted from within a task of this pool are queued on the submitting worker. A task that fails to
+    // be queued is not waited on.
+    void submit(std::function<void()> const &task);
+
+    // Blocks until every submitted task has finished, then rethrows the first exception thrown by a
+    // task (if any). Must not be called from within a task of this pool.
+    void wait();
+};
+
+}
+}
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/structures/stl/stl_dictionary.hpp>
 #include <ori/simcars/map/map_interface.hpp>
 #include <ori/simcars/map/lane_interface.hpp>
@@ -31,6 +32,12 @@ class QMapSceneWidget : public QSceneWidget
 
     FP_DATA_TYPE single_point_map_object_size;
 
+    bool occupied_lanes_only;
+
+    // Retained between frames, so culling lanes does not allocate once they have grown to fit
+    geometry::Vecs vehicle_positions;
+    structures::stl::STLStackArray<size_t> encapsulated_vehicle_idxs;
+
 protected:
     void populate_render_stack() override
     {
@@ -139,10 +146,26 @@ protected:
 
         map::ILaneArray<T_id> const *lanes_in_focus = map->get_lanes_in_range(point, distance);
 
+        // Lanes are culled by testing every vehicle against each of them at once
+        if (occupied_lanes_only)
+        {
+            this->get_vehicle_positions(vehicle_positions);
+        }
+
         size_t i;
         for (i = 0; i < lanes_in_focus->count(); ++i)
         {
-            add_lane_to_render_stack((*lanes_in_focus)[i]);
+            map::ILane<T_id> const *lane = (*lanes_in_focus)[i];
+            if (occupied_lanes_only)
+            {
+                encapsulated_vehicle_idxs.clear();
+                lane->check_encapsulation(vehicle_positions, &encapsulated_vehicle_idxs);
+                if (encapsulated_vehicle_idxs.count() == 0)
+                {
+                    continue;
+                }
+            }
+            add_lane_to_render_stack(lane);
         }
 
         delete lanes_in_focus;
@@ -164,7 +187,18 @@ public:
                     FP_DATA_TYPE realtime_factor = 1.0f, FP_DATA_TYPE pixels_per_metre = 10.0f, bool flip_y = true)
         : QSceneWidget(scene, parent, position, size, frame_rate, realtime_factor, pixels_per_metre, flip_y), map(map),
           randomness_generator(random_device()), hue_generator(0.0f, 360.0f),
-          single_point_map_object_size(single_point_map_object_size) {}
+          single_point_map_object_size(single_point_map_object_size), occupied_lanes_only(false) {}
+
+    bool get_occupied_lanes_only() const
+    {
+        return occupied_lanes_only;
+    }
+
+    // When set, only the lanes in focus that a vehicle is on are drawn
+    void set_occupied_lanes_only(bool occupied_lanes_only)
+    {
+        this->occupied_lanes_only = occupied_lanes_only;
+    }
 };
 
 }
@@ -58,6 +58,9 @@ protected:
     void on_init() override;
     void on_update() override;
 
+    // Positions of the vehicles present at the current time, one column each
+    void get_vehicle_positions(geometry::Vecs &positions) const;
+
     virtual void add_vehicle_to_render_stack(agent::IEntity const *vehicle);
     virtual void add_scene_to_render_stack();
     virtual void populate_render_stack();
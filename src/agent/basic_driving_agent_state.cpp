@@ -1,7 +1,11 @@
 
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/agent/basic_constant.hpp>
 #include <ori/simcars/agent/basic_driving_agent_state.hpp>
 
+#include <stdexcept>
+#include <cassert>
+
 namespace ori
 {
 namespace simcars
@@ -9,14 +13,18 @@ namespace simcars
 namespace agent
 {
 
-void BasicDrivingAgentState::set_parameter_value(IValuelessConstant *parameter_value)
+void BasicDrivingAgentState::set_parameter_value(ParameterHandle parameter_handle, IValuelessConstant *parameter_value)
 {
-    std::string const &parameter_name = parameter_value->get_full_name();
-    if (delete_dicts && parameter_dict.contains(parameter_name))
+    if (parameter_handle >= parameters_by_handle.size())
+    {
+        parameters_by_handle.resize(parameter_handle + 1, nullptr);
+    }
+    else if (delete_dicts && parameters_by_handle[parameter_handle] != nullptr &&
+             parameters_by_handle[parameter_handle] != parameter_value)
     {
-        delete parameter_dict[parameter_name];
+        delete parameters_by_handle[parameter_handle];
     }
-    parameter_dict.update(parameter_name, parameter_value);
+    parameters_by_handle[parameter_handle] = parameter_value;
 }
 
 BasicDrivingAgentState::BasicDrivingAgentState(std::string const &driving_agent_name, temporal::Time time, bool delete_dicts) :
@@ -25,12 +33,15 @@ BasicDrivingAgentState::BasicDrivingAgentState(std::string const &driving_agent_
 BasicDrivingAgentState::BasicDrivingAgentState(IReadOnlyDrivingAgentState const *driving_agent_state) :
     name(driving_agent_state->get_name()), time(driving_agent_state->get_time()), delete_dicts(true)
 {
+    ParameterRegistry *parameter_registry = ParameterRegistry::get_instance();
+
     structures::IArray<IValuelessConstant const*> *parameter_values =
             driving_agent_state->get_parameter_values();
 
     for (size_t i = 0; i < parameter_values->count(); ++i)
     {
-        parameter_dict.update((*parameter_values)[i]->get_full_name(), (*parameter_values)[i]->valueless_constant_shallow_copy());
+        this->set_parameter_value(parameter_registry->intern((*parameter_values)[i]->get_parameter_name()),
+                                  (*parameter_values)[i]->valueless_constant_shallow_copy());
     }
 
     delete parameter_values;
@@ -39,6 +50,8 @@ BasicDrivingAgentState::BasicDrivingAgentState(IReadOnlyDrivingAgentState const
 BasicDrivingAgentState::BasicDrivingAgentState(IDrivingAgentState *driving_agent_state, bool copy_parameters) :
     name(driving_agent_state->get_name()), time(driving_agent_state->get_time()), delete_dicts(copy_parameters)
 {
+    ParameterRegistry *parameter_registry = ParameterRegistry::get_instance();
+
     structures::IArray<IValuelessConstant*> *parameter_values =
             driving_agent_state->get_mutable_parameter_values();
 
@@ -46,14 +59,16 @@ BasicDrivingAgentState::BasicDrivingAgentState(IDrivingAgentState *driving_agent
     {
         for (size_t i = 0; i < parameter_values->count(); ++i)
         {
-            parameter_dict.update((*parameter_values)[i]->get_full_name(), (*parameter_values)[i]->valueless_constant_shallow_copy());
+            this->set_parameter_value(parameter_registry->intern((*parameter_values)[i]->get_parameter_name()),
+                                      (*parameter_values)[i]->valueless_constant_shallow_copy());
         }
     }
     else
     {
         for (size_t i = 0; i < parameter_values->count(); ++i)
         {
-            parameter_dict.update((*parameter_values)[i]->get_full_name(), (*parameter_values)[i]);
+            this->set_parameter_value(parameter_registry->intern((*parameter_values)[i]->get_parameter_name()),
+                                      (*parameter_values)[i]);
         }
     }
 
@@ -64,11 +79,9 @@ BasicDrivingAgentState::~BasicDrivingAgentState()
 {
     if (delete_dicts)
     {
-        structures::IArray<IValuelessConstant*> const *parameters = parameter_dict.get_values();
-
-        for (size_t i = 0; i < parameters->count(); ++i)
+        for (size_t i = 0; i < parameters_by_handle.size(); ++i)
         {
-            delete (*parameters)[i];
+            delete parameters_by_handle[i];
         }
     }
 }
@@ -87,159 +100,262 @@ temporal::Time BasicDrivingAgentState::get_time() const
 // that simulator updates position variable last
 bool BasicDrivingAgentState::is_populated() const
 {
-    return parameter_dict.contains(this->get_name() + ".position.base");
+    ParameterHandle position_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position;
+    return position_handle < parameters_by_handle.size() &&
+            parameters_by_handle[position_handle] != nullptr;
 }
 
 structures::IArray<IValuelessConstant const*>* BasicDrivingAgentState::get_parameter_values() const
 {
     structures::IStackArray<IValuelessConstant const*> *parameters =
-            new structures::stl::STLStackArray<IValuelessConstant const*>(parameter_dict.count());
-    cast_array(*parameter_dict.get_values(), *parameters);
+            new structures::stl::STLStackArray<IValuelessConstant const*>;
+    for (size_t i = 0; i < parameters_by_handle.size(); ++i)
+    {
+        if (parameters_by_handle[i] != nullptr)
+        {
+            parameters->push_back(parameters_by_handle[i]);
+        }
+    }
     return parameters;
 }
 
 IValuelessConstant const* BasicDrivingAgentState::get_parameter_value(std::string const &parameter_name) const
 {
-    return parameter_dict[parameter_name];
+    ParameterHandle parameter_handle;
+    if (ParameterRegistry::get_instance()->get_handle(this->get_name(), parameter_name, parameter_handle))
+    {
+        return this->get_parameter_value(parameter_handle);
+    }
+    else
+    {
+        throw std::out_of_range("Parameter '" + parameter_name + "' is not present in state");
+    }
 }
 
-void BasicDrivingAgentState::set_id_constant(IConstant<uint32_t> *id_constant)
+IValuelessConstant const* BasicDrivingAgentState::get_parameter_value(ParameterHandle parameter_handle) const
 {
-    if (id_constant->get_entity_name() == this->get_name() &&
-            id_constant->get_parameter_name() == "id")
+    if (parameter_handle < parameters_by_handle.size() &&
+            parameters_by_handle[parameter_handle] != nullptr)
+    {
+        return parameters_by_handle[parameter_handle];
+    }
+    else
     {
-        this->set_parameter_value(id_constant);
+        throw std::out_of_range("Parameter is not present in state");
     }
 }
 
+void BasicDrivingAgentState::set_id_constant(IConstant<uint32_t> *id_constant)
+{
+    assert(id_constant->get_entity_name() == this->get_name() &&
+           id_constant->get_parameter_name() == "id");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().id,
+                id_constant);
+}
+
 void BasicDrivingAgentState::set_ego_constant(IConstant<bool> *ego_constant)
 {
-    if (ego_constant->get_entity_name() == this->get_name() &&
-            ego_constant->get_parameter_name() == "ego")
-    {
-        this->set_parameter_value(ego_constant);
-    }
+    assert(ego_constant->get_entity_name() == this->get_name() &&
+           ego_constant->get_parameter_name() == "ego");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ego,
+                ego_constant);
 }
 
 void BasicDrivingAgentState::set_bb_length_constant(IConstant<FP_DATA_TYPE> *bb_length_constant)
 {
-    if (bb_length_constant->get_entity_name() == this->get_name() &&
-            bb_length_constant->get_parameter_name() == "bb_length")
-    {
-        this->set_parameter_value(bb_length_constant);
-    }
+    assert(bb_length_constant->get_entity_name() == this->get_name() &&
+           bb_length_constant->get_parameter_name() == "bb_length");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_length,
+                bb_length_constant);
 }
 
 void BasicDrivingAgentState::set_bb_width_constant(IConstant<FP_DATA_TYPE> *bb_width_constant)
 {
-    if (bb_width_constant->get_entity_name() == this->get_name() &&
-            bb_width_constant->get_parameter_name() == "bb_width")
-    {
-        this->set_parameter_value(bb_width_constant);
-    }
+    assert(bb_width_constant->get_entity_name() == this->get_name() &&
+           bb_width_constant->get_parameter_name() == "bb_width");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_width,
+                bb_width_constant);
 }
 
 void BasicDrivingAgentState::set_driving_agent_class_constant(IConstant<DrivingAgentClass> *driving_agent_class_constant)
 {
-    if (driving_agent_class_constant->get_entity_name() == this->get_name() &&
-            driving_agent_class_constant->get_parameter_name() == "driving_agent_class")
-    {
-        this->set_parameter_value(driving_agent_class_constant);
-    }
+    assert(driving_agent_class_constant->get_entity_name() == this->get_name() &&
+           driving_agent_class_constant->get_parameter_name() == "driving_agent_class");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().driving_agent_class,
+                driving_agent_class_constant);
 }
 
 void BasicDrivingAgentState::set_position_variable(IConstant<geometry::Vec> *position_variable)
 {
-    if (position_variable->get_entity_name() == this->get_name() &&
-            position_variable->get_parameter_name() == "position.base")
-    {
-        this->set_parameter_value(position_variable);
-    }
+    assert(position_variable->get_entity_name() == this->get_name() &&
+           position_variable->get_parameter_name() == "position.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position,
+                position_variable);
 }
 
 void BasicDrivingAgentState::set_linear_velocity_variable(IConstant<geometry::Vec> *linear_velocity_variable)
 {
-    if (linear_velocity_variable->get_entity_name() == this->get_name() &&
-            linear_velocity_variable->get_parameter_name() == "linear_velocity.base")
-    {
-        this->set_parameter_value(linear_velocity_variable);
-    }
+    assert(linear_velocity_variable->get_entity_name() == this->get_name() &&
+           linear_velocity_variable->get_parameter_name() == "linear_velocity.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_velocity,
+                linear_velocity_variable);
 }
 
 void BasicDrivingAgentState::set_aligned_linear_velocity_variable(IConstant<FP_DATA_TYPE> *aligned_linear_velocity_variable)
 {
-    if (aligned_linear_velocity_variable->get_entity_name() == this->get_name() &&
-            aligned_linear_velocity_variable->get_parameter_name() == "aligned_linear_velocity.base")
-    {
-        this->set_parameter_value(aligned_linear_velocity_variable);
-    }
+    assert(aligned_linear_velocity_variable->get_entity_name() == this->get_name() &&
+           aligned_linear_velocity_variable->get_parameter_name() == "aligned_linear_velocity.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity,
+                aligned_linear_velocity_variable);
 }
 
 void BasicDrivingAgentState::set_linear_acceleration_variable(IConstant<geometry::Vec> *linear_acceleration_variable)
 {
-    if (linear_acceleration_variable->get_entity_name() == this->get_name() &&
-            linear_acceleration_variable->get_parameter_name() == "linear_acceleration.base")
-    {
-        this->set_parameter_value(linear_acceleration_variable);
-    }
+    assert(linear_acceleration_variable->get_entity_name() == this->get_name() &&
+           linear_acceleration_variable->get_parameter_name() == "linear_acceleration.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_acceleration,
+                linear_acceleration_variable);
 }
 
 void BasicDrivingAgentState::set_aligned_linear_acceleration_variable(IConstant<FP_DATA_TYPE> *aligned_linear_acceleration_variable)
 {
-    if (aligned_linear_acceleration_variable->get_entity_name() == this->get_name() &&
-            aligned_linear_acceleration_variable->get_parameter_name() == "aligned_linear_acceleration.indirect_actuation")
-    {
-        this->set_parameter_value(aligned_linear_acceleration_variable);
-    }
+    assert(aligned_linear_acceleration_variable->get_entity_name() == this->get_name() &&
+           aligned_linear_acceleration_variable->get_parameter_name() == "aligned_linear_acceleration.indirect_actuation");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_acceleration,
+                aligned_linear_acceleration_variable);
 }
 
 void BasicDrivingAgentState::set_external_linear_acceleration_variable(IConstant<geometry::Vec> *external_linear_acceleration_variable)
 {
-    if (external_linear_acceleration_variable->get_entity_name() == this->get_name() &&
-            external_linear_acceleration_variable->get_parameter_name() == "linear_acceleration.external")
-    {
-        this->set_parameter_value(external_linear_acceleration_variable);
-    }
+    assert(external_linear_acceleration_variable->get_entity_name() == this->get_name() &&
+           external_linear_acceleration_variable->get_parameter_name() == "linear_acceleration.external");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().external_linear_acceleration,
+                external_linear_acceleration_variable);
 }
 
 void BasicDrivingAgentState::set_rotation_variable(IConstant<FP_DATA_TYPE> *rotation_variable)
 {
-    if (rotation_variable->get_entity_name() == this->get_name() &&
-            rotation_variable->get_parameter_name() == "rotation.base")
-    {
-        this->set_parameter_value(rotation_variable);
-    }
+    assert(rotation_variable->get_entity_name() == this->get_name() &&
+           rotation_variable->get_parameter_name() == "rotation.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().rotation,
+                rotation_variable);
 }
 
 void BasicDrivingAgentState::set_steer_variable(IConstant<FP_DATA_TYPE> *steer_variable)
 {
-    if (steer_variable->get_entity_name() == this->get_name() &&
-            steer_variable->get_parameter_name() == "steer.indirect_actuation")
-    {
-        this->set_parameter_value(steer_variable);
-    }
+    assert(steer_variable->get_entity_name() == this->get_name() &&
+           steer_variable->get_parameter_name() == "steer.indirect_actuation");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().steer,
+                steer_variable);
 }
 
 void BasicDrivingAgentState::set_angular_velocity_variable(IConstant<FP_DATA_TYPE> *angular_velocity_variable)
 {
-    if (angular_velocity_variable->get_entity_name() == this->get_name() &&
-            angular_velocity_variable->get_parameter_name() == "angular_velocity.base")
-    {
-        this->set_parameter_value(angular_velocity_variable);
-    }
+    assert(angular_velocity_variable->get_entity_name() == this->get_name() &&
+           angular_velocity_variable->get_parameter_name() == "angular_velocity.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().angular_velocity,
+                angular_velocity_variable);
+}
+
+void BasicDrivingAgentState::set_ttc_variable(IConstant<temporal::Duration> *ttc_variable)
+{
+    assert(ttc_variable->get_entity_name() == this->get_name() &&
+           ttc_variable->get_parameter_name() == "ttc.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ttc,
+                ttc_variable);
+}
+
+void BasicDrivingAgentState::set_cumilative_collision_time_variable(IConstant<temporal::Duration> *cumilative_collision_time_variable)
+{
+    assert(cumilative_collision_time_variable->get_entity_name() == this->get_name() &&
+           cumilative_collision_time_variable->get_parameter_name() == "cumilative_collision_time.base");
+
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().cumilative_collision_time,
+                cumilative_collision_time_variable);
 }
 
 structures::IArray<IValuelessConstant*>* BasicDrivingAgentState::get_mutable_parameter_values()
 {
     structures::IStackArray<IValuelessConstant*> *parameters =
-            new structures::stl::STLStackArray<IValuelessConstant*>(parameter_dict.count());
-    parameter_dict.get_values(parameters);
+            new structures::stl::STLStackArray<IValuelessConstant*>;
+    for (size_t i = 0; i < parameters_by_handle.size(); ++i)
+    {
+        if (parameters_by_handle[i] != nullptr)
+        {
+            parameters->push_back(parameters_by_handle[i]);
+        }
+    }
     return parameters;
 }
 
 IValuelessConstant* BasicDrivingAgentState::get_mutable_parameter_value(std::string const &parameter_name)
 {
-    return parameter_dict[parameter_name];
+    ParameterHandle parameter_handle;
+    if (ParameterRegistry::get_instance()->get_handle(this->get_name(), parameter_name, parameter_handle))
+    {
+        return this->get_mutable_parameter_value(parameter_handle);
+    }
+    else
+    {
+        throw std::out_of_range("Parameter '" + parameter_name + "' is not present in state");
+    }
+}
+
+IValuelessConstant* BasicDrivingAgentState::get_mutable_parameter_value(ParameterHandle parameter_handle)
+{
+    if (parameter_handle < parameters_by_handle.size() &&
+            parameters_by_handle[parameter_handle] != nullptr)
+    {
+        return parameters_by_handle[parameter_handle];
+    }
+    else
+    {
+        throw std::out_of_range("Parameter is not present in state");
+    }
+}
+
+IValuelessConstant* BasicDrivingAgentState::get_owned_mutable_parameter_value(ParameterHandle parameter_handle)
+{
+    if (delete_dicts && parameter_handle < parameters_by_handle.size())
+    {
+        return parameters_by_handle[parameter_handle];
+    }
+    else
+    {
+        return nullptr;
+    }
 }
 
 }
@@ -1,17 +1,21 @@
 
 #include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/geometry/trig_buff.hpp>
-#include <ori/simcars/geometry/o_rect.hpp>
+#include <ori/simcars/geometry/o_box.hpp>
+#include <ori/simcars/geometry/sweep_and_prune.hpp>
 #include <ori/simcars/agent/variable_interface.hpp>
 #include <ori/simcars/agent/basic_constant.hpp>
 #include <ori/simcars/agent/basic_driving_agent_state.hpp>
 #include <ori/simcars/agent/basic_driving_simulator.hpp>
 #include <ori/simcars/agent/view_driving_agent_state.hpp>
 #include <ori/simcars/agent/driving_simulation_agent.hpp>
+#include <ori/simcars/agent/swept_box_driving_agent_ttc_calculator.hpp>
 
 #include <iostream>
 #include <cassert>
 
+#define TTC_CANDIDATE_BLOCK_SIZE 16
+
 namespace ori
 {
 namespace simcars
@@ -19,7 +23,16 @@ namespace simcars
 namespace agent
 {
 
-BasicDrivingSimulator::BasicDrivingSimulator(IDrivingAgentController const *controller) : controller(controller) {}
+static SweptBoxDrivingAgentTTCCalculator const default_ttc_calculator;
+
+BasicDrivingSimulator::BasicDrivingSimulator(IDrivingAgentController const *controller,
+                                             bool broad_phase_enabled,
+                                             IDrivingAgentTTCCalculator const *ttc_calculator,
+                                             geometry::TrigBuff const *trig_buff)
+    : controller(controller),
+      ttc_calculator(ttc_calculator != nullptr ? ttc_calculator : &default_ttc_calculator),
+      trig_buff(trig_buff != nullptr ? trig_buff : geometry::TrigBuff::get_instance()),
+      broad_phase_enabled(broad_phase_enabled) {}
 
 void BasicDrivingSimulator::simulate(IReadOnlySceneState const *current_state, ISceneState *next_state, temporal::Duration time_step) const
 {
@@ -29,371 +42,465 @@ void BasicDrivingSimulator::simulate(IReadOnlySceneState const *current_state, I
                 time_step);
 }
 
-void BasicDrivingSimulator::simulate_driving_scene(
-        IReadOnlyDrivingSceneState const *current_state,
-        IDrivingSceneState *next_state,
+void BasicDrivingSimulator::simulate_buffered_driving_agents(
+        DrivingSceneStateBuffer *state_buffer, size_t begin, size_t end,
         temporal::Duration time_step) const
 {
-    structures::IArray<IReadOnlyDrivingAgentState const*> *current_driving_agent_states =
-            current_state->get_driving_agent_states();
+    DrivingAgentStateColumns const &current = state_buffer->current;
+    DrivingAgentStateColumns &next = state_buffer->next;
+    std::vector<uint8_t> const &commit_flags = state_buffer->commit_flags;
 
-    structures::IStackArray<IDrivingAgentState*> *next_driving_agent_states =
-            new structures::stl::STLStackArray<IDrivingAgentState*>;
-    bool simulation_flags[current_driving_agent_states->count()];
+    FP_DATA_TYPE const time_step_count = time_step.count();
 
-    size_t i, j;
+    size_t i;
 
-    for (i = 0; i < current_driving_agent_states->count(); ++i)
+    // Agents that are not being simulated are carried through the arithmetic passes and then have
+    // their results discarded, which keeps those passes free of branches
+    for (i = begin; i < end; ++i)
     {
-        IReadOnlyDrivingAgentState const *current_driving_agent_state = (*current_driving_agent_states)[i];
-        IDrivingAgentState *next_driving_agent_state = next_state->get_mutable_driving_agent_state(current_driving_agent_state->get_name());
+        FP_DATA_TYPE mean_aligned_linear_acceleration =
+                (current.aligned_linear_accelerations[i] + next.aligned_linear_accelerations[i]) / 2.0f;
 
-        if (next_driving_agent_state != nullptr)
-        {
-            bool simulation_flag = !next_driving_agent_state->is_populated();
+        FP_DATA_TYPE estimated_new_aligned_linear_velocity =
+                current.aligned_linear_velocities[i] + mean_aligned_linear_acceleration * time_step_count;
 
-            if (simulation_flag)
-            {
-                IConstant<geometry::Vec> *external_linear_acceleration_variable_value =
-                        new BasicConstant<geometry::Vec>(
-                            next_driving_agent_state->get_name(),
-                            "linear_acceleration.external",
-                            geometry::Vec::Zero());
-                next_driving_agent_state->set_external_linear_acceleration_variable(external_linear_acceleration_variable_value);
-
-                controller->modify_driving_agent_state(current_driving_agent_state, next_driving_agent_state);
-                simulate_driving_agent(current_driving_agent_state, next_driving_agent_state, time_step);
-            }
+        FP_DATA_TYPE estimated_mean_aligned_linear_velocity =
+                (current.aligned_linear_velocities[i] + estimated_new_aligned_linear_velocity) / 2.0f;
 
-            simulation_flags[next_driving_agent_states->count()] = simulation_flag;
-            next_driving_agent_states->push_back(next_driving_agent_state);
-        }
+        FP_DATA_TYPE new_angular_velocity = next.steers[i] * estimated_mean_aligned_linear_velocity;
 
-        delete current_driving_agent_state;
-    }
+        FP_DATA_TYPE mean_angular_velocity = (current.angular_velocities[i] + new_angular_velocity) / 2.0f;
 
-    delete current_driving_agent_states;
+        FP_DATA_TYPE new_rotation = current.rotations[i] + mean_angular_velocity * time_step_count;
 
-    structures::IArray<temporal::Duration> *next_cumilative_collision_times =
-            new structures::stl::STLStackArray<temporal::Duration>(next_driving_agent_states->count());
-    for (i = 0; i < next_driving_agent_states->count(); ++i)
-    {
-        (*next_cumilative_collision_times)[i] = temporal::Duration(0);
+        next.angular_velocities[i] = commit_flags[i] ? new_angular_velocity : next.angular_velocities[i];
+        next.rotations[i] = commit_flags[i] ? new_rotation : next.rotations[i];
     }
 
-    geometry::TrigBuff const *trig_buff = geometry::TrigBuff::get_instance();
-
-    for (i = 0; i < next_driving_agent_states->count(); ++i)
+    for (i = begin; i < end; ++i)
     {
-        IDrivingAgentState *next_driving_agent_state_1 = (*next_driving_agent_states)[i];
-        IReadOnlyDrivingAgentState const *current_driving_agent_state_1 =
-                current_state->get_driving_agent_state(next_driving_agent_state_1->get_name());
-
-        geometry::Vec position_1 = next_driving_agent_state_1->get_position_variable()->get_value();
-        geometry::Vec velocity_1 = next_driving_agent_state_1->get_linear_velocity_variable()->get_value();
-        FP_DATA_TYPE length_1 = next_driving_agent_state_1->get_bb_length_constant()->get_value();
-        FP_DATA_TYPE width_1 = next_driving_agent_state_1->get_bb_width_constant()->get_value();
-        FP_DATA_TYPE rotation_1 = next_driving_agent_state_1->get_rotation_variable()->get_value();
+        if (commit_flags[i])
+        {
+            next.rotations[i] = trig_buff->wrap(next.rotations[i]);
+        }
+    }
 
-        geometry::ORect bounding_box_1(position_1, length_1, width_1, rotation_1);
+    // Evaluated for every agent in one batch, as with the arithmetic passes the values for agents that are not
+    // being simulated only feed into results which are discarded
+    trig_buff->get_sin_cos(next.rotations.data() + begin, state_buffer->rotation_sins.data() + begin,
+                           state_buffer->rotation_coss.data() + begin, end - begin);
 
-        for (j = i + 1; j < next_driving_agent_states->count(); ++j)
+    if (trig_buff->is_interpolated())
+    {
+        // Interpolation between bins is symmetric about zero, so the inverse rotation follows directly
+        for (i = begin; i < end; ++i)
         {
-            if (!simulation_flags[i] && !simulation_flags[j])
-            {
-                continue;
-            }
-
-            IDrivingAgentState *next_driving_agent_state_2 = (*next_driving_agent_states)[j];
-            IReadOnlyDrivingAgentState const *current_driving_agent_state_2 =
-                    current_state->get_driving_agent_state(next_driving_agent_state_2->get_name());
+            state_buffer->inverse_rotation_coss[i] = state_buffer->rotation_coss[i];
+            state_buffer->inverse_rotation_sins[i] = -state_buffer->rotation_sins[i];
+        }
+    }
+    else
+    {
+        // Nearest bin lookups of a negated angle can land in a different bin, so these are looked up explicitly to
+        // match the values the inverse rotation has always had
+        for (i = begin; i < end; ++i)
+        {
+            state_buffer->inverse_rotation_coss[i] = trig_buff->get_cos(-next.rotations[i]);
+            state_buffer->inverse_rotation_sins[i] = trig_buff->get_sin(-next.rotations[i]);
+        }
+    }
 
-            geometry::Vec position_2 = next_driving_agent_state_2->get_position_variable()->get_value();
-            geometry::Vec velocity_2 = next_driving_agent_state_2->get_linear_velocity_variable()->get_value();
-            FP_DATA_TYPE length_2 = next_driving_agent_state_2->get_bb_length_constant()->get_value();
-            FP_DATA_TYPE width_2 = next_driving_agent_state_2->get_bb_width_constant()->get_value();
-            FP_DATA_TYPE rotation_2 = next_driving_agent_state_2->get_rotation_variable()->get_value();
+    for (i = begin; i < end; ++i)
+    {
+        FP_DATA_TYPE new_linear_acceleration_x =
+                next.aligned_linear_accelerations[i] * state_buffer->rotation_coss[i] +
+                next.external_linear_acceleration_xs[i];
+        FP_DATA_TYPE new_linear_acceleration_y =
+                next.aligned_linear_accelerations[i] * state_buffer->rotation_sins[i] +
+                next.external_linear_acceleration_ys[i];
+
+        FP_DATA_TYPE mean_linear_acceleration_x =
+                (current.linear_acceleration_xs[i] + new_linear_acceleration_x) / 2.0f;
+        FP_DATA_TYPE mean_linear_acceleration_y =
+                (current.linear_acceleration_ys[i] + new_linear_acceleration_y) / 2.0f;
+
+        FP_DATA_TYPE new_linear_velocity_x =
+                current.linear_velocity_xs[i] + mean_linear_acceleration_x * time_step_count;
+        FP_DATA_TYPE new_linear_velocity_y =
+                current.linear_velocity_ys[i] + mean_linear_acceleration_y * time_step_count;
+
+        FP_DATA_TYPE new_aligned_linear_velocity =
+                state_buffer->inverse_rotation_coss[i] * new_linear_velocity_x +
+                -state_buffer->inverse_rotation_sins[i] * new_linear_velocity_y;
+
+        FP_DATA_TYPE mean_linear_velocity_x =
+                (current.linear_velocity_xs[i] + new_linear_velocity_x) / 2.0f;
+        FP_DATA_TYPE mean_linear_velocity_y =
+                (current.linear_velocity_ys[i] + new_linear_velocity_y) / 2.0f;
+
+        FP_DATA_TYPE new_position_x = current.position_xs[i] + mean_linear_velocity_x * time_step_count;
+        FP_DATA_TYPE new_position_y = current.position_ys[i] + mean_linear_velocity_y * time_step_count;
+
+        next.linear_acceleration_xs[i] =
+                commit_flags[i] ? new_linear_acceleration_x : next.linear_acceleration_xs[i];
+        next.linear_acceleration_ys[i] =
+                commit_flags[i] ? new_linear_acceleration_y : next.linear_acceleration_ys[i];
+        next.linear_velocity_xs[i] =
+                commit_flags[i] ? new_linear_velocity_x : next.linear_velocity_xs[i];
+        next.linear_velocity_ys[i] =
+                commit_flags[i] ? new_linear_velocity_y : next.linear_velocity_ys[i];
+        next.aligned_linear_velocities[i] =
+                commit_flags[i] ? new_aligned_linear_velocity : next.aligned_linear_velocities[i];
+        next.position_xs[i] = commit_flags[i] ? new_position_x : next.position_xs[i];
+        next.position_ys[i] = commit_flags[i] ? new_position_y : next.position_ys[i];
+    }
 
-            geometry::ORect bounding_box_2(position_2, length_2, width_2, rotation_2);
+    for (i = begin; i < end; ++i)
+    {
+        assert(!std::isnan(next.position_xs[i]));
+        assert(!std::isnan(next.position_ys[i]));
+    }
 
-            bool collision_occured = false;
-            if (bounding_box_1.check_collision(bounding_box_2))
-            {
-                collision_occured = true;
+    // Collision responses simulate agents again, which in turn refreshes their bounding boxes
+    for (i = begin; i < end; ++i)
+    {
+        state_buffer->update_bounding_box(i);
+    }
+}
 
-                geometry::Vec direction = (position_2 - position_1).normalized();
+void BasicDrivingSimulator::simulate_driving_scene(
+        IReadOnlyDrivingSceneState const *current_state,
+        IDrivingSceneState *next_state,
+        temporal::Duration time_step) const
+{
+    // Simulators are shared between threads, hence the buffers being per thread
+    thread_local DrivingSceneStateBuffer state_buffer;
+    thread_local geometry::SweepAndPrune sweep_and_prune;
+    thread_local geometry::OBoxBatch candidate_o_boxes;
 
-                geometry::Vec acceleration_1 = next_driving_agent_state_1->get_linear_acceleration_variable()->get_value();
-                FP_DATA_TYPE mass_1 = length_1 * width_1;
-                FP_DATA_TYPE collision_velocity_1 = velocity_1.dot(direction);
+    state_buffer.clear();
 
-                geometry::Vec acceleration_2 = next_driving_agent_state_2->get_linear_acceleration_variable()->get_value();
-                FP_DATA_TYPE mass_2 = length_2 * width_2;
-                FP_DATA_TYPE collision_velocity_2 = velocity_2.dot(direction);
+    structures::IArray<IReadOnlyDrivingAgentState const*> *current_driving_agent_states =
+            current_state->get_driving_agent_states();
 
-                FP_DATA_TYPE resulting_velocity = ((mass_1 * collision_velocity_1) + (mass_2 * collision_velocity_2))
-                        / (mass_1 + mass_2);
+    size_t i, j, k;
 
-                geometry::Vec new_velocity_1 = velocity_1 + (resulting_velocity - collision_velocity_1) * direction;
-                geometry::Vec new_velocity_2 = velocity_2 + (resulting_velocity - collision_velocity_2) * direction;
+    for (i = 0; i < current_driving_agent_states->count(); ++i)
+    {
+        IReadOnlyDrivingAgentState const *current_driving_agent_state = (*current_driving_agent_states)[i];
+        IDrivingAgentState *next_driving_agent_state = next_state->get_mutable_driving_agent_state(current_driving_agent_state->get_name());
 
-                geometry::Vec previous_velocity_1 = current_driving_agent_state_1->get_linear_velocity_variable()->get_value();
-                geometry::Vec previous_velocity_2 = current_driving_agent_state_2->get_linear_velocity_variable()->get_value();
+        if (next_driving_agent_state != nullptr)
+        {
+            state_buffer.load_states(
+                        state_buffer.push_back(current_driving_agent_state, next_driving_agent_state));
+        }
+        else
+        {
+            delete current_driving_agent_state;
+        }
+    }
 
-                geometry::Vec mean_acceleration_1 = (new_velocity_1 - previous_velocity_1) / time_step.count();
-                geometry::Vec mean_acceleration_2 = (new_velocity_2 - previous_velocity_2) / time_step.count();
+    delete current_driving_agent_states;
 
-                geometry::Vec previous_acceleration_1 =
-                        current_driving_agent_state_1->get_linear_acceleration_variable()->get_value();
-                geometry::Vec previous_acceleration_2 =
-                        current_driving_agent_state_2->get_linear_acceleration_variable()->get_value();
+    // Simulated agents are actuated together, so the lanes they are on are looked up in one batch
+    structures::stl::STLStackArray<size_t> simulated_indices;
+    for (i = 0; i < state_buffer.count(); ++i)
+    {
+        if (state_buffer.simulation_flags[i])
+        {
+            simulated_indices.push_back(i);
+        }
+    }
+    controller->modify_buffered_driving_agent_states(&state_buffer, &simulated_indices);
 
-                FP_DATA_TYPE rotation_1 = next_driving_agent_state_1->get_rotation_variable()->get_value();
-                FP_DATA_TYPE rotation_2 = next_driving_agent_state_2->get_rotation_variable()->get_value();
+    simulate_buffered_driving_agents(&state_buffer, 0, state_buffer.count(), time_step);
 
-                // This is quite messy, would be better not to rely upon casts, this is a temporary solution to see if this
-                // approach is viable
-                ViewDrivingAgentState *view_driving_agent_state_1 =
-                        dynamic_cast<ViewDrivingAgentState*>(next_driving_agent_state_1);
-                DrivingSimulationAgent const* driving_agent_1 =
-                        dynamic_cast<DrivingSimulationAgent const*>(
-                            view_driving_agent_state_1->get_agent());
-                if (!simulation_flags[i])
-                {
-                    IValuelessVariable const *aligned_linear_velocity_goal_valueless_variable =
-                            driving_agent_1->get_variable_parameter(
-                                driving_agent_1->get_name() + ".aligned_linear_velocity.goal");
-                    aligned_linear_velocity_goal_valueless_variable->propogate_events_forward(driving_agent_1->get_max_temporal_limit());
-                }
-                driving_agent_1->begin_simulation(
-                            view_driving_agent_state_1->get_time() - time_step);
-                controller->modify_driving_agent_state(current_driving_agent_state_1, view_driving_agent_state_1);
-                ViewDrivingAgentState *view_driving_agent_state_2 =
-                        dynamic_cast<ViewDrivingAgentState*>(next_driving_agent_state_2);
-                DrivingSimulationAgent const* driving_agent_2 =
-                        dynamic_cast<DrivingSimulationAgent const*>(
-                            view_driving_agent_state_2->get_agent());
-                if (!simulation_flags[j])
-                {
-                    IValuelessVariable const *aligned_linear_velocity_goal_valueless_variable =
-                            driving_agent_2->get_variable_parameter(
-                                driving_agent_2->get_name() + ".aligned_linear_velocity.goal");
-                    aligned_linear_velocity_goal_valueless_variable->propogate_events_forward(driving_agent_2->get_max_temporal_limit());
-                }
-                driving_agent_2->begin_simulation(
-                            view_driving_agent_state_2->get_time() - time_step);
-                controller->modify_driving_agent_state(current_driving_agent_state_2, view_driving_agent_state_2);
-
-                FP_DATA_TYPE revised_aligned_acceleration_1 = view_driving_agent_state_1->get_aligned_linear_acceleration_variable()->get_value();
-                FP_DATA_TYPE revised_aligned_acceleration_2 = view_driving_agent_state_2->get_aligned_linear_acceleration_variable()->get_value();
-
-                geometry::Vec revised_acceleration_1;
-                revised_acceleration_1.x() = revised_aligned_acceleration_1 * trig_buff->get_cos(rotation_1);
-                revised_acceleration_1.y() = revised_aligned_acceleration_1 * trig_buff->get_sin(rotation_1);
-                geometry::Vec revised_acceleration_2;
-                revised_acceleration_2.x() = revised_aligned_acceleration_2 * trig_buff->get_cos(rotation_2);
-                revised_acceleration_2.y() = revised_aligned_acceleration_2 * trig_buff->get_sin(rotation_2);
-
-                geometry::Vec new_acceleration_1 = mean_acceleration_1 - 0.5 * (previous_acceleration_1 + revised_acceleration_1);
-                geometry::Vec new_acceleration_2 = mean_acceleration_2 - 0.5 * (previous_acceleration_2 + revised_acceleration_2);
-
-                geometry::Vec external_acceleration_1 = new_acceleration_1 - revised_acceleration_1;
-                geometry::Vec external_acceleration_2 = new_acceleration_2 - revised_acceleration_2;
-
-                IConstant<geometry::Vec> *external_linear_acceleration_variable_value_1(
-                            new BasicConstant<geometry::Vec>(
-                                view_driving_agent_state_1->get_name(),
-                                "linear_acceleration.external",
-                                external_acceleration_1));
-                view_driving_agent_state_1->set_external_linear_acceleration_variable(external_linear_acceleration_variable_value_1);
-                simulate_driving_agent(current_driving_agent_state_1, view_driving_agent_state_1, time_step);
-
-                IConstant<geometry::Vec> *external_linear_acceleration_variable_value_2(
-                            new BasicConstant<geometry::Vec>(
-                                next_driving_agent_state_2->get_name(),
-                                "linear_acceleration.external",
-                                external_acceleration_2));
-                next_driving_agent_state_2->set_external_linear_acceleration_variable(external_linear_acceleration_variable_value_2);
-                simulate_driving_agent(current_driving_agent_state_2, next_driving_agent_state_2, time_step);
-            }
+    DrivingAgentStateColumns const &current = state_buffer.current;
+    DrivingAgentStateColumns &next = state_buffer.next;
+    std::vector<uint8_t> const &simulation_flags = state_buffer.simulation_flags;
 
+    std::vector<geometry::OBox> const &bounding_boxes = state_buffer.bounding_boxes;
 
-            if (collision_occured)
-            {
-                (*next_cumilative_collision_times)[i] += time_step;
-                (*next_cumilative_collision_times)[j] += time_step;
-            }
+    structures::stl::STLStackArray<size_t> candidate_indices;
+    structures::stl::STLStackArray<size_t> narrow_phase_indices;
+    structures::stl::STLStackArray<size_t> colliding_indices;
+    structures::stl::STLStackArray<size_t> ttc_candidate_indices;
+    FP_DATA_TYPE max_half_span = 0.0f;
+    FP_DATA_TYPE max_speed = 0.0f;
 
-            delete current_driving_agent_state_2;
+    if (broad_phase_enabled)
+    {
+        sweep_and_prune.reset(state_buffer.count());
+        for (i = 0; i < state_buffer.count(); ++i)
+        {
+            sweep_and_prune.set_position(i, next.get_position(i));
+            max_speed = std::max(max_speed, next.get_linear_velocity(i).norm());
+            max_half_span = std::max(max_half_span, state_buffer.bb_half_spans[i]);
         }
+        sweep_and_prune.sort();
+    }
 
+    for (i = 0; i < state_buffer.count(); ++i)
+    {
+        geometry::Vec position_1 = next.get_position(i);
+        geometry::Vec velocity_1 = next.get_linear_velocity(i);
+        FP_DATA_TYPE length_1 = state_buffer.bb_lengths[i];
+        FP_DATA_TYPE width_1 = state_buffer.bb_widths[i];
 
-        IConstant<temporal::Duration> *cumilative_collision_time_variable_value =
-                new BasicConstant<temporal::Duration>(
-                    next_driving_agent_state_1->get_name(),
-                    "cumilative_collision_time.base",
-                    (*next_cumilative_collision_times)[i] +
-                    current_driving_agent_state_1->get_cumilative_collision_time_variable()->get_value());
-        next_driving_agent_state_1->set_cumilative_collision_time_variable(cumilative_collision_time_variable_value);
-
+        // Copied, as collision responses refresh the cached box of this agent
+        geometry::OBox const o_box_1 = bounding_boxes[i];
 
-        temporal::Duration smallest_ttc = temporal::Duration::max();
-        for (j = 0; j < next_driving_agent_states->count(); ++j)
+        candidate_indices.clear();
+        if (broad_phase_enabled)
+        {
+            // Colliding boxes must have overlapping bounding circles, the margin covers rounding
+            sweep_and_prune.get_indices_in_range(
+                        position_1, FP_DATA_TYPE(1.01) * (state_buffer.bb_half_spans[i] + max_half_span),
+                        &candidate_indices);
+        }
+        else
         {
-            IDrivingAgentState *next_driving_agent_state_2 = (*next_driving_agent_states)[j];
-
-            geometry::Vec position_2 = next_driving_agent_state_2->get_position_variable()->get_value();
-            geometry::Vec velocity_2 = next_driving_agent_state_2->get_linear_velocity_variable()->get_value();
-            FP_DATA_TYPE length_2 = next_driving_agent_state_2->get_bb_length_constant()->get_value();
-            FP_DATA_TYPE width_2 = next_driving_agent_state_2->get_bb_width_constant()->get_value();
-            FP_DATA_TYPE rotation_2 = next_driving_agent_state_2->get_rotation_variable()->get_value();
-
-            geometry::ORect bounding_box_2(position_2, length_2, width_2, rotation_2);
-
-            geometry::Vec position_diff = position_2 - position_1;
-            FP_DATA_TYPE position_diff_norm = position_diff.norm();
-            geometry::Vec velocity_diff = velocity_1 - velocity_2;
-            FP_DATA_TYPE velocity_diff_norm = velocity_diff.norm();
-
-            FP_DATA_TYPE rotation_diff = trig_buff->wrap(rotation_2 - rotation_1);
-            FP_DATA_TYPE span_1 = bounding_box_1.get_height();
-            FP_DATA_TYPE span_2 = bounding_box_1.get_height() * std::abs(trig_buff->get_cos(rotation_diff)) +
-                    bounding_box_2.get_width() * std::abs(trig_buff->get_sin(rotation_diff));
-            FP_DATA_TYPE combined_span = 0.5f * (span_1 + span_2);
-
-            FP_DATA_TYPE dot_product_limit =
-                    1.0f / std::sqrt(std::pow(combined_span / position_diff_norm, 2.0f) + 1.0f);
-            FP_DATA_TYPE dot_product =
-                    position_diff.dot(velocity_diff) /
-                    (position_diff_norm * velocity_diff_norm);
-
-            if (dot_product >= dot_product_limit)
+            for (j = i + 1; j < state_buffer.count(); ++j)
             {
-                temporal::Duration ttc(int64_t(position_diff_norm / (velocity_diff_norm * dot_product)));
-                smallest_ttc = std::min(ttc, smallest_ttc);
+                candidate_indices.push_back(j);
             }
         }
-        IConstant<temporal::Duration> *ttc_variable_value =
-                new BasicConstant<temporal::Duration>(
-                    next_driving_agent_state_1->get_name(),
-                    "ttc.base",
-                    smallest_ttc);
-        next_driving_agent_state_1->set_ttc_variable(ttc_variable_value);
 
+        // Candidates are tested against the agent all at once, collision responses only alter the pair of agents
+        // involved, so no later candidate of this agent is affected by the response to an earlier one
+        narrow_phase_indices.clear();
+        candidate_o_boxes.clear();
+        for (k = 0; k < candidate_indices.count(); ++k)
+        {
+            j = candidate_indices[k];
 
-        delete current_driving_agent_state_1;
-    }
-
-    delete next_cumilative_collision_times;
+            if (j <= i || (!simulation_flags[i] && !simulation_flags[j]) ||
+                    !state_buffer.check_aligned_bounding_box_overlap(i, j))
+            {
+                continue;
+            }
 
-    for (size_t i = 0; i < next_driving_agent_states->count(); ++i)
-    {
-        delete (*next_driving_agent_states)[i];
-    }
+            narrow_phase_indices.push_back(j);
+            candidate_o_boxes.push_back(bounding_boxes[j]);
+        }
 
-    delete next_driving_agent_states;
-}
+        colliding_indices.clear();
+        candidate_o_boxes.get_colliding_indices(o_box_1, &colliding_indices);
 
-void BasicDrivingSimulator::simulate_driving_agent(
-        IReadOnlyDrivingAgentState const *current_state,
-        IDrivingAgentState *next_state,
-        temporal::Duration time_step) const
-{
-    IConstant<FP_DATA_TYPE> const *aligned_linear_acceleration_variable_value =
-            current_state->get_aligned_linear_acceleration_variable();
-    IConstant<FP_DATA_TYPE> const *new_aligned_linear_acceleration_variable_value =
-            next_state->get_aligned_linear_acceleration_variable();
-    FP_DATA_TYPE aligned_linear_acceleration = aligned_linear_acceleration_variable_value->get_value();
-    FP_DATA_TYPE new_aligned_linear_acceleration = new_aligned_linear_acceleration_variable_value->get_value();
+        for (k = 0; k < colliding_indices.count(); ++k)
+        {
+            j = narrow_phase_indices[colliding_indices[k]];
 
-    //IConstant<FP_DATA_TYPE> const *steer_variable_value = current_state->get_steer_variable();
-    IConstant<FP_DATA_TYPE> const *new_steer_variable_value = next_state->get_steer_variable();
-    //FP_DATA_TYPE steer = steer_variable_value->get_value();
-    FP_DATA_TYPE new_steer = new_steer_variable_value->get_value();
+            geometry::Vec position_2 = next.get_position(j);
+            geometry::Vec velocity_2 = next.get_linear_velocity(j);
+            FP_DATA_TYPE length_2 = state_buffer.bb_lengths[j];
+            FP_DATA_TYPE width_2 = state_buffer.bb_widths[j];
 
-    IConstant<geometry::Vec> const *new_external_linear_acceleration_variable_value =
-            next_state->get_external_linear_acceleration_variable();
-    geometry::Vec new_external_linear_acceleration = new_external_linear_acceleration_variable_value->get_value();
+            geometry::Vec direction = (position_2 - position_1).normalized();
 
-    IConstant<geometry::Vec> const *linear_acceleration_variable_value =
-            current_state->get_linear_acceleration_variable();
-    geometry::Vec linear_acceleration = linear_acceleration_variable_value->get_value();
+            FP_DATA_TYPE mass_1 = length_1 * width_1;
+            FP_DATA_TYPE collision_velocity_1 = velocity_1.dot(direction);
 
-    IConstant<FP_DATA_TYPE> const *aligned_linear_velocity_variable_value =
-            current_state->get_aligned_linear_velocity_variable();
-    FP_DATA_TYPE aligned_linear_velocity = aligned_linear_velocity_variable_value->get_value();
+            FP_DATA_TYPE mass_2 = length_2 * width_2;
+            FP_DATA_TYPE collision_velocity_2 = velocity_2.dot(direction);
 
-    IConstant<geometry::Vec> const *linear_velocity_variable_value = current_state->get_linear_velocity_variable();
-    geometry::Vec linear_velocity = linear_velocity_variable_value->get_value();
+            FP_DATA_TYPE resulting_velocity = ((mass_1 * collision_velocity_1) + (mass_2 * collision_velocity_2))
+                    / (mass_1 + mass_2);
 
-    IConstant<FP_DATA_TYPE> const *angular_velocity_variable_value = current_state->get_angular_velocity_variable();
-    FP_DATA_TYPE angular_velocity = angular_velocity_variable_value->get_value();
+            geometry::Vec new_velocity_1 = velocity_1 + (resulting_velocity - collision_velocity_1) * direction;
+            geometry::Vec new_velocity_2 = velocity_2 + (resulting_velocity - collision_velocity_2) * direction;
 
-    IConstant<geometry::Vec> const *position_variable_value = current_state->get_position_variable();
-    geometry::Vec position = position_variable_value->get_value();
+            // Agents following recorded values will not have had their current state loaded
+            if (!state_buffer.commit_flags[i])
+            {
+                state_buffer.load_current_state(i);
+            }
+            if (!state_buffer.commit_flags[j])
+            {
+                state_buffer.load_current_state(j);
+            }
 
-    IConstant<FP_DATA_TYPE> const *rotation_variable_value = current_state->get_rotation_variable();
-    FP_DATA_TYPE rotation = rotation_variable_value->get_value();
+            geometry::Vec previous_velocity_1 = current.get_linear_velocity(i);
+            geometry::Vec previous_velocity_2 = current.get_linear_velocity(j);
+
+            geometry::Vec mean_acceleration_1 = (new_velocity_1 - previous_velocity_1) / time_step.count();
+            geometry::Vec mean_acceleration_2 = (new_velocity_2 - previous_velocity_2) / time_step.count();
+
+            geometry::Vec previous_acceleration_1 = current.get_linear_acceleration(i);
+            geometry::Vec previous_acceleration_2 = current.get_linear_acceleration(j);
+
+            // Read before either agent is simulated again, the cached box of the agent rather than the copy as an
+            // earlier response may already have simulated it again
+            geometry::OBox const &current_o_box_1 = bounding_boxes[i];
+            geometry::OBox const &o_box_2 = bounding_boxes[j];
+            FP_DATA_TYPE cos_rotation_1 = current_o_box_1.cos_orientation;
+            FP_DATA_TYPE sin_rotation_1 = current_o_box_1.sin_orientation;
+            FP_DATA_TYPE cos_rotation_2 = o_box_2.cos_orientation;
+            FP_DATA_TYPE sin_rotation_2 = o_box_2.sin_orientation;
+
+            // This is quite messy, would be better not to rely upon casts, this is a temporary solution to see if this
+            // approach is viable
+            ViewDrivingAgentState *view_driving_agent_state_1 =
+                    dynamic_cast<ViewDrivingAgentState*>(state_buffer.get_next_state(i));
+            DrivingSimulationAgent const* driving_agent_1 =
+                    dynamic_cast<DrivingSimulationAgent const*>(
+                        view_driving_agent_state_1->get_agent());
+            // The goal variables of agents not yet simulated may be shared with other forks, this only writes to them if
+            // they were not propagated to the end of the simulation before being shared
+            if (!simulation_flags[i])
+            {
+                IValuelessVariable const *aligned_linear_velocity_goal_valueless_variable =
+                        driving_agent_1->get_variable_parameter(
+                            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity_goal);
+                aligned_linear_velocity_goal_valueless_variable->propogate_events_forward(driving_agent_1->get_max_temporal_limit());
+            }
+            driving_agent_1->begin_simulation(
+                        view_driving_agent_state_1->get_time() - time_step);
+            state_buffer.commit_flags[i] = true;
+            controller->modify_buffered_driving_agent_state(&state_buffer, i);
+            ViewDrivingAgentState *view_driving_agent_state_2 =
+                    dynamic_cast<ViewDrivingAgentState*>(state_buffer.get_next_state(j));
+            DrivingSimulationAgent const* driving_agent_2 =
+                    dynamic_cast<DrivingSimulationAgent const*>(
+                        view_driving_agent_state_2->get_agent());
+            if (!simulation_flags[j])
+            {
+                IValuelessVariable const *aligned_linear_velocity_goal_valueless_variable =
+                        driving_agent_2->get_variable_parameter(
+                            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity_goal);
+                aligned_linear_velocity_goal_valueless_variable->propogate_events_forward(driving_agent_2->get_max_temporal_limit());
+            }
+            driving_agent_2->begin_simulation(
+                        view_driving_agent_state_2->get_time() - time_step);
+            state_buffer.commit_flags[j] = true;
+            controller->modify_buffered_driving_agent_state(&state_buffer, j);
 
+            FP_DATA_TYPE revised_aligned_acceleration_1 = next.aligned_linear_accelerations[i];
+            FP_DATA_TYPE revised_aligned_acceleration_2 = next.aligned_linear_accelerations[j];
 
-    FP_DATA_TYPE mean_aligned_linear_acceleration = (aligned_linear_acceleration + new_aligned_linear_acceleration) / 2.0f;
+            geometry::Vec revised_acceleration_1;
+            revised_acceleration_1.x() = revised_aligned_acceleration_1 * cos_rotation_1;
+            revised_acceleration_1.y() = revised_aligned_acceleration_1 * sin_rotation_1;
+            geometry::Vec revised_acceleration_2;
+            revised_acceleration_2.x() = revised_aligned_acceleration_2 * cos_rotation_2;
+            revised_acceleration_2.y() = revised_aligned_acceleration_2 * sin_rotation_2;
 
-    FP_DATA_TYPE estimated_new_aligned_linear_velocity = aligned_linear_velocity + mean_aligned_linear_acceleration * time_step.count();
+            geometry::Vec new_acceleration_1 =
+                    mean_acceleration_1 - FP_DATA_TYPE(0.5) * (previous_acceleration_1 + revised_acceleration_1);
+            geometry::Vec new_acceleration_2 =
+                    mean_acceleration_2 - FP_DATA_TYPE(0.5) * (previous_acceleration_2 + revised_acceleration_2);
 
-    FP_DATA_TYPE estimated_mean_aligned_linear_velocity = (aligned_linear_velocity + estimated_new_aligned_linear_velocity) / 2.0f;
+            next.set_external_linear_acceleration(i, new_acceleration_1 - revised_acceleration_1);
+            simulate_buffered_driving_agents(&state_buffer, i, i + 1, time_step);
 
-    FP_DATA_TYPE new_angular_velocity = new_steer * estimated_mean_aligned_linear_velocity;
+            next.set_external_linear_acceleration(j, new_acceleration_2 - revised_acceleration_2);
+            simulate_buffered_driving_agents(&state_buffer, j, j + 1, time_step);
 
-    IConstant<FP_DATA_TYPE> *new_angular_velocity_variable_value =
-                new BasicConstant<FP_DATA_TYPE>(next_state->get_name(), "angular_velocity.base", new_angular_velocity);
-    next_state->set_angular_velocity_variable(new_angular_velocity_variable_value);
+            next.cumilative_collision_times[i] += time_step;
+            next.cumilative_collision_times[j] += time_step;
 
-    FP_DATA_TYPE mean_angular_velocity = (angular_velocity + new_angular_velocity) / 2.0f;
+            if (broad_phase_enabled)
+            {
+                sweep_and_prune.update_position(i, next.get_position(i));
+                max_speed = std::max(max_speed, next.get_linear_velocity(i).norm());
 
-    geometry::TrigBuff const *trig_buff = geometry::TrigBuff::get_instance();
+                sweep_and_prune.update_position(j, next.get_position(j));
+                max_speed = std::max(max_speed, next.get_linear_velocity(j).norm());
+            }
+        }
 
-    FP_DATA_TYPE new_rotation = trig_buff->wrap(rotation + mean_angular_velocity * time_step.count());
 
-    IConstant<FP_DATA_TYPE> *new_rotation_variable_value =
-                new BasicConstant<FP_DATA_TYPE>(next_state->get_name(), "rotation.base", new_rotation);
-    next_state->set_rotation_variable(new_rotation_variable_value);
+        // Collision responses may have altered the agent's kinematics since the narrow phase began
+        position_1 = next.get_position(i);
+        velocity_1 = next.get_linear_velocity(i);
 
+        temporal::Duration smallest_ttc = temporal::Duration::max();
+        ttc_candidate_indices.clear();
+        if (broad_phase_enabled)
+        {
+            // Sweeps outwards along x from the agent, agents a distance d apart along x cannot touch sooner than
+            // (d - s) / (|v_1| + |v_2|), s being the largest sum of their half spans, so the sweep stops once no
+            // remaining agent could improve upon the smallest TTC found so far. Candidates are passed to the
+            // calculator in blocks, so the sweep may run on for up to a block past where it could have stopped.
+            double speed_bound = 1.001 * (double(velocity_1.norm()) + double(max_speed));
+            double contact_distance = 1.01 * (double(state_buffer.bb_half_spans[i]) + double(max_half_span));
+            size_t lower_rank = sweep_and_prune.get_lower_bound_rank(position_1.x());
+            size_t upper_rank = lower_rank;
+            while (lower_rank > 0 || upper_rank < sweep_and_prune.count())
+            {
+                bool lower_flag = upper_rank == sweep_and_prune.count() ||
+                        (lower_rank > 0 &&
+                         position_1.x() - sweep_and_prune.get_x(lower_rank - 1) <
+                         sweep_and_prune.get_x(upper_rank) - position_1.x());
+                size_t rank = lower_flag ? --lower_rank : upper_rank++;
+
+                if (smallest_ttc != temporal::Duration::max() &&
+                        std::abs(double(sweep_and_prune.get_x(rank)) - double(position_1.x())) - contact_distance >=
+                        double(smallest_ttc.count() + 1) * speed_bound)
+                {
+                    break;
+                }
 
+                ttc_candidate_indices.push_back(sweep_and_prune.get_index(rank));
 
-    geometry::Vec new_linear_acceleration;
-    new_linear_acceleration.x() = new_aligned_linear_acceleration * trig_buff->get_cos(new_rotation);
-    new_linear_acceleration.y() = new_aligned_linear_acceleration * trig_buff->get_sin(new_rotation);
-    new_linear_acceleration += new_external_linear_acceleration;
+                if (ttc_candidate_indices.count() == TTC_CANDIDATE_BLOCK_SIZE)
+                {
+                    smallest_ttc = ttc_calculator->calc_smallest_buffered_ttc(
+                                &state_buffer, i, &ttc_candidate_indices, smallest_ttc);
+                    ttc_candidate_indices.clear();
+                }
+            }
+        }
+        else
+        {
+            for (j = 0; j < state_buffer.count(); ++j)
+            {
+                ttc_candidate_indices.push_back(j);
+            }
+        }
+        if (ttc_candidate_indices.count() > 0)
+        {
+            smallest_ttc = ttc_calculator->calc_smallest_buffered_ttc(
+                        &state_buffer, i, &ttc_candidate_indices, smallest_ttc);
+        }
+        next.ttcs[i] = smallest_ttc;
+    }
 
-    IConstant<geometry::Vec> *new_linear_acceleration_variable_value =
-                new BasicConstant<geometry::Vec>(
-                    next_state->get_name(), "linear_acceleration.base", new_linear_acceleration);
-    next_state->set_linear_acceleration_variable(new_linear_acceleration_variable_value);
+    for (i = 0; i < state_buffer.count(); ++i)
+    {
+        if (state_buffer.commit_flags[i])
+        {
+            state_buffer.commit_next_kinematics(i);
+        }
+        state_buffer.commit_next_collision_state(i);
 
-    geometry::Vec mean_linear_acceleration = (linear_acceleration + new_linear_acceleration) / 2.0f;
+        delete state_buffer.get_current_state(i);
+        delete state_buffer.get_next_state(i);
+    }
 
-    geometry::Vec new_linear_velocity = linear_velocity + mean_linear_acceleration * time_step.count();
+    state_buffer.clear();
+}
 
-    IConstant<geometry::Vec> *new_linear_velocity_variable_value =
-                new BasicConstant<geometry::Vec>(next_state->get_name(), "linear_velocity.base", new_linear_velocity);
-    next_state->set_linear_velocity_variable(new_linear_velocity_variable_value);
+void BasicDrivingSimulator::simulate_driving_agent(
+        IReadOnlyDrivingAgentState const *current_state,
+        IDrivingAgentState *next_state,
+        temporal::Duration time_step) const
+{
+    thread_local DrivingSceneStateBuffer state_buffer;
 
-    FP_DATA_TYPE new_aligned_linear_velocity = (trig_buff->get_rot_mat(-new_rotation) * new_linear_velocity).x();
+    state_buffer.clear();
 
-    IConstant<FP_DATA_TYPE> *new_aligned_linear_velocity_variable_value =
-                new BasicConstant<FP_DATA_TYPE>(
-                    next_state->get_name(), "aligned_linear_velocity.base", new_aligned_linear_velocity);
-    next_state->set_aligned_linear_velocity_variable(new_aligned_linear_velocity_variable_value);
+    size_t idx = state_buffer.push_back(current_state, next_state);
+    state_buffer.commit_flags[idx] = true;
+    state_buffer.load_current_state(idx);
+    state_buffer.load_next_actuation(idx);
 
-    geometry::Vec mean_linear_velocity = (linear_velocity + new_linear_velocity) / 2.0f;
+    simulate_buffered_driving_agents(&state_buffer, idx, idx + 1, time_step);
 
-    geometry::Vec new_position = position + mean_linear_velocity * time_step.count();
-    assert(!std::isnan(new_position.x()));
-    assert(!std::isnan(new_position.y()));
+    state_buffer.commit_next_kinematics(idx);
 
-    IConstant<geometry::Vec> *new_position_variable_value =
-                new BasicConstant<geometry::Vec>(next_state->get_name(), "position.base", new_position);
-    next_state->set_position_variable(new_position_variable_value);
+    state_buffer.clear();
 }
 
 }
@@ -17,15 +17,17 @@ BasicGoalDrivingAgentState::BasicGoalDrivingAgentState(IDrivingAgentState *drivi
 IConstant<Goal<FP_DATA_TYPE>> const* BasicGoalDrivingAgentState::get_aligned_linear_velocity_goal_variable() const
 {
     IValuelessConstant const *aligned_linear_velocity_goal_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".aligned_linear_velocity.goal");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity_goal);
     return dynamic_cast<IConstant<Goal<FP_DATA_TYPE>> const*>(aligned_linear_velocity_goal_valueless_variable);
 }
 
 void BasicGoalDrivingAgentState::set_aligned_linear_velocity_goal_variable(
         IConstant<Goal<FP_DATA_TYPE>> *aligned_linear_velocity_goal_variable)
 {
-    parameter_dict.update(aligned_linear_velocity_goal_variable->get_full_name(),
-                          aligned_linear_velocity_goal_variable);
+    this->set_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity_goal,
+                aligned_linear_velocity_goal_variable);
 }
 
 }
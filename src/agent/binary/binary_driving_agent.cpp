@@ -0,0 +1,449 @@
+
+#include <ori/simcars/utils/exceptions.hpp>
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/structures/stl/stl_concat_array.hpp>
+#include <ori/simcars/agent/binary/binary_driving_agent.hpp>
+#include <ori/simcars/agent/binary/mapped_variable.hpp>
+#include <ori/simcars/agent/basic_constant.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+BinaryDrivingAgent::BinaryDrivingAgent(IDrivingScene const *driving_scene,
+                                       std::shared_ptr<BinarySceneFile const> const &scene_file,
+                                       size_t agent_idx)
+    : scene_file(scene_file), agent_idx(agent_idx), driving_scene(driving_scene)
+{
+    BinarySceneAgentEntry const &agent_entry = scene_file->get_agent_entry(agent_idx);
+
+    this->name = agent_entry.name;
+
+    this->min_spatial_limits = geometry::Vec(agent_entry.min_spatial_limits[0], agent_entry.min_spatial_limits[1]);
+    this->max_spatial_limits = geometry::Vec(agent_entry.max_spatial_limits[0], agent_entry.max_spatial_limits[1]);
+    this->min_temporal_limit = temporal::Time(temporal::Duration(agent_entry.min_temporal_limit));
+    this->max_temporal_limit = temporal::Time(temporal::Duration(agent_entry.max_temporal_limit));
+
+    temporal::Duration const time_step(scene_file->get_header().time_step);
+
+    id_constant = new BasicConstant<uint32_t>(this->name, "id", agent_entry.id);
+
+    ego_constant = new BasicConstant<bool>(this->name, "ego", agent_entry.ego != 0);
+
+    bb_length_constant = new BasicConstant<FP_DATA_TYPE>(this->name, "bb_length", agent_entry.bb_length);
+
+    bb_width_constant = new BasicConstant<FP_DATA_TYPE>(this->name, "bb_width", agent_entry.bb_width);
+
+    driving_agent_class_constant = new BasicConstant<DrivingAgentClass>(this->name, "driving_agent_class", DrivingAgentClass(agent_entry.driving_agent_class));
+
+
+    position_variable = new MappedVariable<geometry::Vec>(this->name, "position", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::POSITION), agent_entry.columns[size_t(BinarySceneColumn::POSITION)], this->min_temporal_limit, time_step);
+
+    linear_velocity_variable = new MappedVariable<geometry::Vec>(this->name, "linear_velocity", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::LINEAR_VELOCITY), agent_entry.columns[size_t(BinarySceneColumn::LINEAR_VELOCITY)], this->min_temporal_limit, time_step);
+
+    aligned_linear_velocity_variable = new MappedVariable<FP_DATA_TYPE>(this->name, "aligned_linear_velocity", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::ALIGNED_LINEAR_VELOCITY), agent_entry.columns[size_t(BinarySceneColumn::ALIGNED_LINEAR_VELOCITY)], this->min_temporal_limit, time_step);
+
+    linear_acceleration_variable = new MappedVariable<geometry::Vec>(this->name, "linear_acceleration", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::LINEAR_ACCELERATION), agent_entry.columns[size_t(BinarySceneColumn::LINEAR_ACCELERATION)], this->min_temporal_limit, time_step);
+
+    aligned_linear_acceleration_variable = new MappedVariable<FP_DATA_TYPE>(this->name, "aligned_linear_acceleration", IValuelessVariable::Type::INDIRECT_ACTUATION, scene_file->get_column(agent_entry, BinarySceneColumn::ALIGNED_LINEAR_ACCELERATION), agent_entry.columns[size_t(BinarySceneColumn::ALIGNED_LINEAR_ACCELERATION)], this->min_temporal_limit, time_step);
+
+    external_linear_acceleration_variable = new MappedVariable<geometry::Vec>(this->name, "linear_acceleration", IValuelessVariable::Type::EXTERNAL, scene_file->get_column(agent_entry, BinarySceneColumn::EXTERNAL_LINEAR_ACCELERATION), agent_entry.columns[size_t(BinarySceneColumn::EXTERNAL_LINEAR_ACCELERATION)], this->min_temporal_limit, time_step);
+
+    rotation_variable = new MappedVariable<FP_DATA_TYPE>(this->name, "rotation", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::ROTATION), agent_entry.columns[size_t(BinarySceneColumn::ROTATION)], this->min_temporal_limit, time_step);
+
+    steer_variable = new MappedVariable<FP_DATA_TYPE>(this->name, "steer", IValuelessVariable::Type::INDIRECT_ACTUATION, scene_file->get_column(agent_entry, BinarySceneColumn::STEER), agent_entry.columns[size_t(BinarySceneColumn::STEER)], this->min_temporal_limit, time_step);
+
+    angular_velocity_variable = new MappedVariable<FP_DATA_TYPE>(this->name, "angular_velocity", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::ANGULAR_VELOCITY), agent_entry.columns[size_t(BinarySceneColumn::ANGULAR_VELOCITY)], this->min_temporal_limit, time_step);
+
+    ttc_variable = new MappedVariable<temporal::Duration>(this->name, "ttc", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::TTC), agent_entry.columns[size_t(BinarySceneColumn::TTC)], this->min_temporal_limit, time_step);
+
+    cumilative_collision_time_variable = new MappedVariable<temporal::Duration>(this->name, "cumilative_collision_time", IValuelessVariable::Type::BASE, scene_file->get_column(agent_entry, BinarySceneColumn::CUMILATIVE_COLLISION_TIME), agent_entry.columns[size_t(BinarySceneColumn::CUMILATIVE_COLLISION_TIME)], this->min_temporal_limit, time_step);
+}
+
+BinaryDrivingAgent::~BinaryDrivingAgent()
+{
+    delete id_constant;
+    delete ego_constant;
+    delete bb_length_constant;
+    delete bb_width_constant;
+    delete driving_agent_class_constant;
+
+    delete position_variable;
+    delete linear_velocity_variable;
+    delete aligned_linear_velocity_variable;
+    delete linear_acceleration_variable;
+    delete aligned_linear_acceleration_variable;
+    delete external_linear_acceleration_variable;
+    delete rotation_variable;
+    delete steer_variable;
+    delete angular_velocity_variable;
+    delete ttc_variable;
+    delete cumilative_collision_time_variable;
+}
+
+std::string BinaryDrivingAgent::get_name() const
+{
+    return this->name;
+}
+
+geometry::Vec BinaryDrivingAgent::get_min_spatial_limits() const
+{
+    return this->min_spatial_limits;
+}
+
+geometry::Vec BinaryDrivingAgent::get_max_spatial_limits() const
+{
+    return this->max_spatial_limits;
+}
+
+temporal::Time BinaryDrivingAgent::get_min_temporal_limit() const
+{
+    return this->min_temporal_limit;
+}
+
+temporal::Time BinaryDrivingAgent::get_max_temporal_limit() const
+{
+    return this->max_temporal_limit;
+}
+
+structures::IArray<IValuelessConstant const*>* BinaryDrivingAgent::get_constant_parameters() const
+{
+    return new structures::stl::STLStackArray<IValuelessConstant const*>(
+    {
+                    id_constant,
+                    ego_constant,
+                    bb_length_constant,
+                    bb_width_constant,
+                    driving_agent_class_constant
+                });
+}
+
+IValuelessConstant const* BinaryDrivingAgent::get_constant_parameter(std::string const &constant_name) const
+{
+    if (constant_name == this->get_name() + ".id")
+    {
+        return id_constant;
+    }
+    else if (constant_name == this->get_name() + ".ego")
+    {
+        return ego_constant;
+    }
+    else if (constant_name == this->get_name() + ".bb_length")
+    {
+        return bb_length_constant;
+    }
+    else if (constant_name == this->get_name() + ".bb_width")
+    {
+        return bb_width_constant;
+    }
+    else if (constant_name == this->get_name() + ".driving_agent_class")
+    {
+        return driving_agent_class_constant;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+structures::IArray<IValuelessVariable const*>* BinaryDrivingAgent::get_variable_parameters() const
+{
+    return new structures::stl::STLStackArray<IValuelessVariable const*>(
+    {
+                    position_variable,
+                    linear_velocity_variable,
+                    aligned_linear_velocity_variable,
+                    linear_acceleration_variable,
+                    aligned_linear_acceleration_variable,
+                    external_linear_acceleration_variable,
+                    rotation_variable,
+                    steer_variable,
+                    angular_velocity_variable,
+                    ttc_variable,
+                    cumilative_collision_time_variable
+                });
+}
+
+IValuelessVariable const* BinaryDrivingAgent::get_variable_parameter(std::string const &variable_name) const
+{
+    if (variable_name == this->get_name() + ".position.base")
+    {
+        return position_variable;
+    }
+    else if (variable_name == this->get_name() + ".linear_velocity.base")
+    {
+        return linear_velocity_variable;
+    }
+    else if (variable_name == this->get_name() + ".aligned_linear_velocity.base")
+    {
+        return aligned_linear_velocity_variable;
+    }
+    else if (variable_name == this->get_name() + ".linear_acceleration.base")
+    {
+        return linear_acceleration_variable;
+    }
+    else if (variable_name == this->get_name() + ".aligned_linear_acceleration.indirect_actuation")
+    {
+        return aligned_linear_acceleration_variable;
+    }
+    else if (variable_name == this->get_name() + ".linear_acceleration.external")
+    {
+        return external_linear_acceleration_variable;
+    }
+    else if (variable_name == this->get_name() + ".rotation.base")
+    {
+        return rotation_variable;
+    }
+    else if (variable_name == this->get_name() + ".steer.indirect_actuation")
+    {
+        return steer_variable;
+    }
+    else if (variable_name == this->get_name() + ".angular_velocity.base")
+    {
+        return angular_velocity_variable;
+    }
+    else if (variable_name == this->get_name() + ".ttc.base")
+    {
+        return ttc_variable;
+    }
+    else if (variable_name == this->get_name() + ".cumilative_collision_time.base")
+    {
+        return cumilative_collision_time_variable;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+structures::IArray<IValuelessEvent const*>* BinaryDrivingAgent::get_events() const
+{
+    structures::stl::STLConcatArray<IValuelessEvent const*> *events =
+            new structures::stl::STLConcatArray<IValuelessEvent const*>(11);
+
+    events->get_array(0) = position_variable->get_valueless_events();
+    events->get_array(1) = linear_velocity_variable->get_valueless_events();
+    events->get_array(2) = aligned_linear_velocity_variable->get_valueless_events();
+    events->get_array(3) = linear_acceleration_variable->get_valueless_events();
+    events->get_array(4) = aligned_linear_acceleration_variable->get_valueless_events();
+    events->get_array(5) = external_linear_acceleration_variable->get_valueless_events();
+    events->get_array(6) = rotation_variable->get_valueless_events();
+    events->get_array(7) = steer_variable->get_valueless_events();
+    events->get_array(8) = angular_velocity_variable->get_valueless_events();
+    events->get_array(9) = ttc_variable->get_valueless_events();
+    events->get_array(10) = cumilative_collision_time_variable->get_valueless_events();
+
+    return events;
+}
+
+IDrivingAgent* BinaryDrivingAgent::driving_agent_deep_copy(IDrivingScene *driving_scene) const
+{
+    if (driving_scene == nullptr)
+    {
+        return new BinaryDrivingAgent(this->driving_scene, this->scene_file, this->agent_idx);
+    }
+    else
+    {
+        return new BinaryDrivingAgent(driving_scene, this->scene_file, this->agent_idx);
+    }
+}
+
+IDrivingScene const* BinaryDrivingAgent::get_driving_scene() const
+{
+    return this->driving_scene;
+}
+
+IConstant<uint32_t> const* BinaryDrivingAgent::get_id_constant() const
+{
+    return id_constant;
+}
+
+IConstant<bool> const* BinaryDrivingAgent::get_ego_constant() const
+{
+    return ego_constant;
+}
+
+IConstant<FP_DATA_TYPE> const* BinaryDrivingAgent::get_bb_length_constant() const
+{
+    return bb_length_constant;
+}
+
+IConstant<FP_DATA_TYPE> const* BinaryDrivingAgent::get_bb_width_constant() const
+{
+    return bb_width_constant;
+}
+
+IConstant<DrivingAgentClass> const* BinaryDrivingAgent::get_driving_agent_class_constant() const
+{
+    return driving_agent_class_constant;
+}
+
+IVariable<geometry::Vec> const* BinaryDrivingAgent::get_position_variable() const
+{
+    return position_variable;
+}
+
+IVariable<geometry::Vec> const* BinaryDrivingAgent::get_linear_velocity_variable() const
+{
+    return linear_velocity_variable;
+}
+
+IVariable<FP_DATA_TYPE> const* BinaryDrivingAgent::get_aligned_linear_velocity_variable() const
+{
+    return aligned_linear_velocity_variable;
+}
+
+IVariable<geometry::Vec> const* BinaryDrivingAgent::get_linear_acceleration_variable() const
+{
+    return linear_acceleration_variable;
+}
+
+IVariable<FP_DATA_TYPE> const* BinaryDrivingAgent::get_aligned_linear_acceleration_variable() const
+{
+    return aligned_linear_acceleration_variable;
+}
+
+IVariable<geometry::Vec> const* BinaryDrivingAgent::get_external_linear_acceleration_variable() const
+{
+    return external_linear_acceleration_variable;
+}
+
+IVariable<FP_DATA_TYPE> const* BinaryDrivingAgent::get_rotation_variable() const
+{
+    return rotation_variable;
+}
+
+IVariable<FP_DATA_TYPE> const* BinaryDrivingAgent::get_steer_variable() const
+{
+    return steer_variable;
+}
+
+IVariable<FP_DATA_TYPE> const* BinaryDrivingAgent::get_angular_velocity_variable() const
+{
+    return angular_velocity_variable;
+}
+
+IVariable<temporal::Duration> const* BinaryDrivingAgent::get_ttc_variable() const
+{
+    return ttc_variable;
+}
+
+IVariable<temporal::Duration> const* BinaryDrivingAgent::get_cumilative_collision_time_variable() const
+{
+    return cumilative_collision_time_variable;
+}
+
+structures::IArray<IValuelessConstant*>* BinaryDrivingAgent::get_mutable_constant_parameters()
+{
+    throw utils::NotImplementedException();
+}
+
+IValuelessConstant* BinaryDrivingAgent::get_mutable_constant_parameter(std::string const &constant_name)
+{
+    throw utils::NotImplementedException();
+}
+
+structures::IArray<IValuelessVariable*>* BinaryDrivingAgent::get_mutable_variable_parameters()
+{
+    throw utils::NotImplementedException();
+}
+
+IValuelessVariable* BinaryDrivingAgent::get_mutable_variable_parameter(std::string const &variable_name)
+{
+    throw utils::NotImplementedException();
+}
+
+structures::IArray<IValuelessEvent*>* BinaryDrivingAgent::get_mutable_events()
+{
+    throw utils::NotImplementedException();
+}
+
+IConstant<uint32_t>* BinaryDrivingAgent::get_mutable_id_constant()
+{
+    throw utils::NotImplementedException();
+}
+
+IConstant<bool>* BinaryDrivingAgent::get_mutable_ego_constant()
+{
+    throw utils::NotImplementedException();
+}
+
+IConstant<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_bb_length_constant()
+{
+    throw utils::NotImplementedException();
+}
+
+IConstant<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_bb_width_constant()
+{
+    throw utils::NotImplementedException();
+}
+
+IConstant<DrivingAgentClass>* BinaryDrivingAgent::get_mutable_driving_agent_class_constant()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<geometry::Vec>* BinaryDrivingAgent::get_mutable_position_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<geometry::Vec>* BinaryDrivingAgent::get_mutable_linear_velocity_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_aligned_linear_velocity_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<geometry::Vec>* BinaryDrivingAgent::get_mutable_linear_acceleration_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_aligned_linear_acceleration_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<geometry::Vec>* BinaryDrivingAgent::get_mutable_external_linear_acceleration_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_rotation_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_steer_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<FP_DATA_TYPE>* BinaryDrivingAgent::get_mutable_angular_velocity_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<temporal::Duration>* BinaryDrivingAgent::get_mutable_ttc_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+IVariable<temporal::Duration>* BinaryDrivingAgent::get_mutable_cumilative_collision_time_variable()
+{
+    throw utils::NotImplementedException();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,323 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/agent/binary/binary_scene.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <cstring>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+template <typename T>
+static void write_column(std::ofstream &output_filestream, IVariable<T> const *variable,
+                         temporal::Time time_window_start, temporal::Duration time_step, size_t slot_count,
+                         BinarySceneColumnEntry &column_entry)
+{
+    typedef typename BinarySceneColumnTraits<T>::Element Element;
+
+    size_t const padding = (BINARY_SCENE_COLUMN_ALIGNMENT - size_t(output_filestream.tellp()) % BINARY_SCENE_COLUMN_ALIGNMENT) %
+            BINARY_SCENE_COLUMN_ALIGNMENT;
+    char const zeros[BINARY_SCENE_COLUMN_ALIGNMENT] = {};
+    output_filestream.write(zeros, padding);
+
+    column_entry.offset = output_filestream.tellp();
+    column_entry.first_slot = slot_count;
+    column_entry.end_slot = 0;
+
+    std::vector<Element> column(slot_count, BinarySceneColumnTraits<T>::encode_missing());
+
+    T value;
+    for (size_t slot = 0; variable != nullptr && slot < slot_count; ++slot)
+    {
+        if (variable->get_value(time_window_start + time_step * temporal::DurationRep(slot), value))
+        {
+            column[slot] = BinarySceneColumnTraits<T>::encode(value);
+            column_entry.first_slot = std::min(column_entry.first_slot, uint64_t(slot));
+            column_entry.end_slot = slot + 1;
+        }
+    }
+
+    if (column_entry.first_slot > column_entry.end_slot)
+    {
+        column_entry.first_slot = column_entry.end_slot = 0;
+    }
+
+    output_filestream.write(reinterpret_cast<char const*>(column.data()), slot_count * sizeof(Element));
+}
+
+BinaryScene::BinaryScene(std::shared_ptr<BinarySceneFile const> const &scene_file)
+    : scene_file(scene_file), driving_agent_dict(scene_file->get_agent_count())
+{
+    BinarySceneHeader const &header = scene_file->get_header();
+
+    this->min_spatial_limits = geometry::Vec(header.min_spatial_limits[0], header.min_spatial_limits[1]);
+    this->max_spatial_limits = geometry::Vec(header.max_spatial_limits[0], header.max_spatial_limits[1]);
+    this->time_step = temporal::Duration(header.time_step);
+    this->min_temporal_limit = temporal::Time(temporal::Duration(header.min_temporal_limit));
+    this->max_temporal_limit = temporal::Time(temporal::Duration(header.max_temporal_limit));
+}
+
+BinaryScene::~BinaryScene()
+{
+    structures::IArray<IDrivingAgent*> const *driving_agents = driving_agent_dict.get_values();
+
+    for (size_t i = 0; i < driving_agents->count(); ++i)
+    {
+        delete (*driving_agents)[i];
+    }
+}
+
+BinaryScene* BinaryScene::load(std::string const &input_file_path_str, structures::ISet<std::string>* agent_names)
+{
+    std::shared_ptr<BinarySceneFile const> scene_file = std::make_shared<BinarySceneFile const>(input_file_path_str);
+
+    BinaryScene *new_driving_scene = new BinaryScene(scene_file);
+
+    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+
+    for (size_t i = 0; i < scene_file->get_agent_count(); ++i)
+    {
+        std::string agent_name = scene_file->get_agent_entry(i).name;
+
+        if (agent_names != nullptr && !agent_names->contains(agent_name))
+        {
+            continue;
+        }
+
+        BinaryDrivingAgent *driving_agent = new BinaryDrivingAgent(new_driving_scene, scene_file, i);
+
+        new_driving_scene->driving_agent_dict.update(agent_name, driving_agent);
+
+        if (agent_names != nullptr)
+        {
+            geometry::Vec driving_agent_min_spatial_limits = driving_agent->get_min_spatial_limits();
+            min_position_x = std::min(driving_agent_min_spatial_limits.x(), min_position_x);
+            min_position_y = std::min(driving_agent_min_spatial_limits.y(), min_position_y);
+
+            geometry::Vec driving_agent_max_spatial_limits = driving_agent->get_max_spatial_limits();
+            max_position_x = std::max(driving_agent_max_spatial_limits.x(), max_position_x);
+            max_position_y = std::max(driving_agent_max_spatial_limits.y(), max_position_y);
+        }
+    }
+
+    // As with the other scene loaders, limits only cover the agents actually loaded
+    if (agent_names != nullptr)
+    {
+        new_driving_scene->min_temporal_limit = temporal::Time::max();
+        new_driving_scene->max_temporal_limit = temporal::Time::min();
+
+        structures::IArray<IDrivingAgent*> const *driving_agents = new_driving_scene->driving_agent_dict.get_values();
+        for (size_t i = 0; i < driving_agents->count(); ++i)
+        {
+            new_driving_scene->min_temporal_limit = std::min((*driving_agents)[i]->get_min_temporal_limit(),
+                                                             new_driving_scene->min_temporal_limit);
+            new_driving_scene->max_temporal_limit = std::max((*driving_agents)[i]->get_max_temporal_limit(),
+                                                             new_driving_scene->max_temporal_limit);
+        }
+
+        new_driving_scene->min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
+        new_driving_scene->max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+    }
+
+    return new_driving_scene;
+}
+
+void BinaryScene::write(IDrivingScene const *driving_scene, std::string const &output_file_path_str)
+{
+    std::filesystem::path output_file_path(output_file_path_str);
+    if (!std::filesystem::is_directory(output_file_path.parent_path()))
+    {
+        throw std::invalid_argument("Output file path directory '" + output_file_path.parent_path().string() + "' does not indicate a valid directory");
+    }
+
+    structures::IArray<IDrivingAgent const*> *driving_agents = driving_scene->get_driving_agents();
+
+    temporal::Duration const time_step = driving_scene->get_time_step();
+
+    BinarySceneHeader header;
+    std::memset(&header, 0, sizeof(BinarySceneHeader));
+    std::memcpy(header.magic, BINARY_SCENE_MAGIC, BINARY_SCENE_MAGIC_LENGTH);
+    header.version = BINARY_SCENE_VERSION;
+    header.byte_order_mark = BINARY_SCENE_BYTE_ORDER_MARK;
+    header.scalar_size = sizeof(FP_DATA_TYPE);
+    header.agent_count = driving_agents->count();
+    header.time_step = time_step.count();
+    header.min_temporal_limit = driving_scene->get_min_temporal_limit().time_since_epoch().count();
+    header.max_temporal_limit = driving_scene->get_max_temporal_limit().time_since_epoch().count();
+    header.min_spatial_limits[0] = driving_scene->get_min_spatial_limits().x();
+    header.min_spatial_limits[1] = driving_scene->get_min_spatial_limits().y();
+    header.max_spatial_limits[0] = driving_scene->get_max_spatial_limits().x();
+    header.max_spatial_limits[1] = driving_scene->get_max_spatial_limits().y();
+
+    std::vector<BinarySceneAgentEntry> agent_entries(driving_agents->count());
+    std::memset(agent_entries.data(), 0, agent_entries.size() * sizeof(BinarySceneAgentEntry));
+
+    std::ofstream output_filestream(output_file_path, std::ios_base::binary);
+
+    // Header and agent table are written again once the column offsets are known
+    output_filestream.write(reinterpret_cast<char const*>(&header), sizeof(BinarySceneHeader));
+    output_filestream.write(reinterpret_cast<char const*>(agent_entries.data()),
+                            agent_entries.size() * sizeof(BinarySceneAgentEntry));
+
+    for (size_t i = 0; i < driving_agents->count(); ++i)
+    {
+        IDrivingAgent const *driving_agent = (*driving_agents)[i];
+        BinarySceneAgentEntry &agent_entry = agent_entries[i];
+
+        std::string const agent_name = driving_agent->get_name();
+        if (agent_name.size() >= BINARY_SCENE_AGENT_NAME_LENGTH)
+        {
+            delete driving_agents;
+            throw std::invalid_argument("Agent name '" + agent_name + "' is too long for a binary scene");
+        }
+        std::memcpy(agent_entry.name, agent_name.c_str(), agent_name.size() + 1);
+
+        agent_entry.id = driving_agent->get_id_constant()->get_value();
+        agent_entry.ego = driving_agent->get_ego_constant()->get_value();
+        agent_entry.driving_agent_class = int32_t(driving_agent->get_driving_agent_class_constant()->get_value());
+        agent_entry.bb_length = driving_agent->get_bb_length_constant()->get_value();
+        agent_entry.bb_width = driving_agent->get_bb_width_constant()->get_value();
+        agent_entry.min_spatial_limits[0] = driving_agent->get_min_spatial_limits().x();
+        agent_entry.min_spatial_limits[1] = driving_agent->get_min_spatial_limits().y();
+        agent_entry.max_spatial_limits[0] = driving_agent->get_max_spatial_limits().x();
+        agent_entry.max_spatial_limits[1] = driving_agent->get_max_spatial_limits().y();
+
+        temporal::Time const agent_min_temporal_limit = driving_agent->get_min_temporal_limit();
+        temporal::Time const agent_max_temporal_limit = driving_agent->get_max_temporal_limit();
+        agent_entry.min_temporal_limit = agent_min_temporal_limit.time_since_epoch().count();
+        agent_entry.max_temporal_limit = agent_max_temporal_limit.time_since_epoch().count();
+        agent_entry.slot_count = (agent_max_temporal_limit - agent_min_temporal_limit) / time_step + 1;
+
+        size_t const slot_count = agent_entry.slot_count;
+        BinarySceneColumnEntry *column_entries = agent_entry.columns;
+
+        write_column(output_filestream, driving_agent->get_position_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::POSITION)]);
+        write_column(output_filestream, driving_agent->get_linear_velocity_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::LINEAR_VELOCITY)]);
+        write_column(output_filestream, driving_agent->get_aligned_linear_velocity_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::ALIGNED_LINEAR_VELOCITY)]);
+        write_column(output_filestream, driving_agent->get_linear_acceleration_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::LINEAR_ACCELERATION)]);
+        write_column(output_filestream, driving_agent->get_aligned_linear_acceleration_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::ALIGNED_LINEAR_ACCELERATION)]);
+        write_column(output_filestream, driving_agent->get_external_linear_acceleration_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::EXTERNAL_LINEAR_ACCELERATION)]);
+        write_column(output_filestream, driving_agent->get_rotation_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::ROTATION)]);
+        write_column(output_filestream, driving_agent->get_steer_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::STEER)]);
+        write_column(output_filestream, driving_agent->get_angular_velocity_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::ANGULAR_VELOCITY)]);
+        write_column(output_filestream, driving_agent->get_ttc_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::TTC)]);
+        write_column(output_filestream, driving_agent->get_cumilative_collision_time_variable(), agent_min_temporal_limit, time_step, slot_count,
+                     column_entries[size_t(BinarySceneColumn::CUMILATIVE_COLLISION_TIME)]);
+    }
+
+    delete driving_agents;
+
+    output_filestream.seekp(0);
+    output_filestream.write(reinterpret_cast<char const*>(&header), sizeof(BinarySceneHeader));
+    output_filestream.write(reinterpret_cast<char const*>(agent_entries.data()),
+                            agent_entries.size() * sizeof(BinarySceneAgentEntry));
+
+    if (!output_filestream)
+    {
+        throw std::runtime_error("Could not write binary scene file '" + output_file_path_str + "'");
+    }
+}
+
+void BinaryScene::save(std::string const &output_file_path_str) const
+{
+    BinaryScene::write(this, output_file_path_str);
+}
+
+IDrivingScene* BinaryScene::driving_scene_deep_copy() const
+{
+    BinaryScene *new_driving_scene = new BinaryScene(this->scene_file);
+
+    new_driving_scene->min_spatial_limits = this->min_spatial_limits;
+    new_driving_scene->max_spatial_limits = this->max_spatial_limits;
+    new_driving_scene->time_step = this->time_step;
+    new_driving_scene->min_temporal_limit = this->min_temporal_limit;
+    new_driving_scene->max_temporal_limit = this->max_temporal_limit;
+
+    structures::IArray<IDrivingAgent*> const *driving_agents = this->driving_agent_dict.get_values();
+
+    size_t i;
+    for(i = 0; i < driving_agents->count(); ++i)
+    {
+        new_driving_scene->driving_agent_dict.update((*driving_agents)[i]->get_name(),
+                                                     (*driving_agents)[i]->driving_agent_deep_copy(new_driving_scene));
+    }
+
+    return new_driving_scene;
+}
+
+geometry::Vec BinaryScene::get_min_spatial_limits() const
+{
+    return this->min_spatial_limits;
+}
+
+geometry::Vec BinaryScene::get_max_spatial_limits() const
+{
+    return this->max_spatial_limits;
+}
+
+temporal::Duration BinaryScene::get_time_step() const
+{
+    return this->time_step;
+}
+
+temporal::Time BinaryScene::get_min_temporal_limit() const
+{
+    return this->min_temporal_limit;
+}
+
+temporal::Time BinaryScene::get_max_temporal_limit() const
+{
+    return this->max_temporal_limit;
+}
+
+structures::IArray<IDrivingAgent const*>* BinaryScene::get_driving_agents() const
+{
+    structures::stl::STLStackArray<IDrivingAgent const*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent const*>(driving_agent_dict.count());
+    cast_array(*driving_agent_dict.get_values(), *driving_agents);
+    return driving_agents;
+}
+
+IDrivingAgent const* BinaryScene::get_driving_agent(std::string const &driving_agent_name) const
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+structures::IArray<IDrivingAgent*>* BinaryScene::get_mutable_driving_agents()
+{
+    structures::stl::STLStackArray<IDrivingAgent*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent*>(driving_agent_dict.count());
+    driving_agent_dict.get_values(driving_agents);
+    return driving_agents;
+}
+
+IDrivingAgent* BinaryScene::get_mutable_driving_agent(std::string const &driving_agent_name)
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+}
+}
+}
+}
@@ -0,0 +1,215 @@
+
+#include <ori/simcars/agent/binary/binary_scene_file.hpp>
+
+#include <filesystem>
+#include <stdexcept>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace binary
+{
+
+static size_t get_column_element_size(BinarySceneColumn column)
+{
+    switch (column)
+    {
+    case BinarySceneColumn::POSITION:
+    case BinarySceneColumn::LINEAR_VELOCITY:
+    case BinarySceneColumn::LINEAR_ACCELERATION:
+    case BinarySceneColumn::EXTERNAL_LINEAR_ACCELERATION:
+        return sizeof(BinarySceneColumnTraits<geometry::Vec>::Element);
+
+    case BinarySceneColumn::TTC:
+    case BinarySceneColumn::CUMILATIVE_COLLISION_TIME:
+        return sizeof(BinarySceneColumnTraits<temporal::Duration>::Element);
+
+    default:
+        return sizeof(BinarySceneColumnTraits<FP_DATA_TYPE>::Element);
+    }
+}
+
+static void unmap_file(void *data, size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+BinarySceneFile::BinarySceneFile(std::string const &input_file_path_str) : data(nullptr), size(0)
+{
+    if (!std::filesystem::is_regular_file(std::filesystem::path(input_file_path_str)))
+    {
+        throw std::invalid_argument("Input file path '" + input_file_path_str + "' does not indicate a valid file");
+    }
+
+#ifdef _WIN32
+    HANDLE const file_handle = CreateFileA(input_file_path_str.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Could not open binary scene file '" + input_file_path_str + "'");
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size) || size_t(file_size.QuadPart) < sizeof(BinarySceneHeader))
+    {
+        CloseHandle(file_handle);
+        throw std::runtime_error("Binary scene file '" + input_file_path_str + "' is truncated");
+    }
+
+    size = file_size.QuadPart;
+    HANDLE const mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+
+    // The view keeps the mapping alive once its handle is closed
+    if (mapping_handle != nullptr)
+    {
+        data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping_handle);
+    }
+
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Could not map binary scene file '" + input_file_path_str + "'");
+    }
+#else
+    int const file_descriptor = open(input_file_path_str.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        throw std::runtime_error("Could not open binary scene file '" + input_file_path_str + "'");
+    }
+
+    struct stat file_stat;
+    if (fstat(file_descriptor, &file_stat) != 0 || size_t(file_stat.st_size) < sizeof(BinarySceneHeader))
+    {
+        close(file_descriptor);
+        throw std::runtime_error("Binary scene file '" + input_file_path_str + "' is truncated");
+    }
+
+    size = file_stat.st_size;
+    void *const mapped_data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+
+    if (mapped_data == MAP_FAILED)
+    {
+        throw std::runtime_error("Could not map binary scene file '" + input_file_path_str + "'");
+    }
+
+    data = mapped_data;
+#endif
+
+    try
+    {
+        BinarySceneHeader const &header = get_header();
+
+        if (std::memcmp(header.magic, BINARY_SCENE_MAGIC, BINARY_SCENE_MAGIC_LENGTH) != 0)
+        {
+            throw std::runtime_error("File '" + input_file_path_str + "' is not a binary scene file");
+        }
+        if (header.byte_order_mark != BINARY_SCENE_BYTE_ORDER_MARK)
+        {
+            throw std::runtime_error("Binary scene file '" + input_file_path_str +
+                                     "' was written on a machine with a different byte order");
+        }
+        if (header.version != BINARY_SCENE_VERSION)
+        {
+            throw std::runtime_error("Binary scene file '" + input_file_path_str + "' has unsupported version " +
+                                     std::to_string(header.version));
+        }
+        if (header.scalar_size != sizeof(FP_DATA_TYPE))
+        {
+            throw std::runtime_error("Binary scene file '" + input_file_path_str + "' was written with " +
+                                     std::to_string(header.scalar_size * 8) + " bit scalars, but this build uses " +
+                                     std::to_string(sizeof(FP_DATA_TYPE) * 8) + " bit scalars");
+        }
+        if (header.time_step <= 0)
+        {
+            throw std::runtime_error("Binary scene file '" + input_file_path_str + "' has an invalid time step");
+        }
+        if (header.agent_count > (size - sizeof(BinarySceneHeader)) / sizeof(BinarySceneAgentEntry))
+        {
+            throw std::runtime_error("Binary scene file '" + input_file_path_str + "' is truncated");
+        }
+
+        for (size_t i = 0; i < get_agent_count(); ++i)
+        {
+            BinarySceneAgentEntry const &agent_entry = get_agent_entry(i);
+
+            if (std::memchr(agent_entry.name, '\0', BINARY_SCENE_AGENT_NAME_LENGTH) == nullptr)
+            {
+                throw std::runtime_error("Binary scene file '" + input_file_path_str + "' has an invalid agent name");
+            }
+
+            for (size_t j = 0; j < BINARY_SCENE_COLUMN_COUNT; ++j)
+            {
+                BinarySceneColumnEntry const &column_entry = agent_entry.columns[j];
+                size_t const element_size = get_column_element_size(BinarySceneColumn(j));
+
+                if (column_entry.offset % BINARY_SCENE_COLUMN_ALIGNMENT != 0 ||
+                        column_entry.offset > size ||
+                        agent_entry.slot_count > (size - column_entry.offset) / element_size ||
+                        column_entry.first_slot > column_entry.end_slot ||
+                        column_entry.end_slot > agent_entry.slot_count)
+                {
+                    throw std::runtime_error("Binary scene file '" + input_file_path_str + "' has an invalid column for agent '" +
+                                             std::string(agent_entry.name) + "'");
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        unmap_file(data, size);
+        throw;
+    }
+}
+
+BinarySceneFile::~BinarySceneFile()
+{
+    unmap_file(data, size);
+}
+
+BinarySceneHeader const& BinarySceneFile::get_header() const
+{
+    return *static_cast<BinarySceneHeader const*>(data);
+}
+
+size_t BinarySceneFile::get_agent_count() const
+{
+    return get_header().agent_count;
+}
+
+BinarySceneAgentEntry const& BinarySceneFile::get_agent_entry(size_t agent_idx) const
+{
+    BinarySceneAgentEntry const *agent_table = reinterpret_cast<BinarySceneAgentEntry const*>(
+                static_cast<char const*>(data) + sizeof(BinarySceneHeader));
+    return agent_table[agent_idx];
+}
+
+void const* BinarySceneFile::get_column(BinarySceneAgentEntry const &agent_entry, BinarySceneColumn column) const
+{
+    return static_cast<char const*>(data) + agent_entry.columns[size_t(column)].offset;
+}
+
+}
+}
+}
+}
@@ -116,7 +116,8 @@ void CSVScene::save_virt(std::ofstream &output_filestream) const
     delete entities;
 }
 
-void CSVScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names)
+void CSVScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names,
+                         utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings)
 {
     throw utils::NotImplementedException();
 }
@@ -58,116 +58,92 @@ IReadOnlyEntityState const* ADrivingAgent::get_state(temporal::Time time) const
     return this->get_driving_agent_state(time);
 }
 
-IConstant<uint32_t> const* ADrivingAgent::get_id_constant() const
+// Parameters are resolved through the typed accessors, as agents hold direct references to these,
+// agents holding any other parameters need to override the handle based lookups to expose them
+IValuelessConstant const* ADrivingAgent::get_constant_parameter(ParameterHandle constant_handle) const
 {
-    IValuelessConstant const *id_valueless_constant =
-            this->get_constant_parameter(this->get_name() + ".id");
-    return dynamic_cast<IConstant<uint32_t> const*>(id_valueless_constant);
-}
-
-IConstant<bool> const* ADrivingAgent::get_ego_constant() const
-{
-    IValuelessConstant const *ego_valueless_constant =
-            this->get_constant_parameter(this->get_name() + ".ego");
-    return dynamic_cast<IConstant<bool> const*>(ego_valueless_constant);
-}
-
-IConstant<FP_DATA_TYPE> const* ADrivingAgent::get_bb_length_constant() const
-{
-    IValuelessConstant const *bb_length_valueless_constant =
-            this->get_constant_parameter(this->get_name() + ".bb_length");
-    return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(bb_length_valueless_constant);
-}
-
-IConstant<FP_DATA_TYPE> const* ADrivingAgent::get_bb_width_constant() const
-{
-    IValuelessConstant const *bb_width_valueless_constant =
-            this->get_constant_parameter(this->get_name() + ".bb_width");
-    return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(bb_width_valueless_constant);
-}
-
-IConstant<DrivingAgentClass> const* ADrivingAgent::get_driving_agent_class_constant() const
-{
-    IValuelessConstant const *driving_agent_class_valueless_constant =
-            this->get_constant_parameter(this->get_name() + ".driving_agent_class");
-    return dynamic_cast<IConstant<DrivingAgentClass> const*>(driving_agent_class_valueless_constant);
-}
-
-IVariable<geometry::Vec> const* ADrivingAgent::get_position_variable() const
-{
-    IValuelessVariable const *position_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".position.base");
-    return dynamic_cast<IVariable<geometry::Vec> const*>(position_valueless_variable);
-}
-
-IVariable<geometry::Vec> const* ADrivingAgent::get_linear_velocity_variable() const
-{
-    IValuelessVariable const *linear_velocity_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".linear_velocity.base");
-    return dynamic_cast<IVariable<geometry::Vec> const*>(linear_velocity_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE> const* ADrivingAgent::get_aligned_linear_velocity_variable() const
-{
-    IValuelessVariable const *aligned_linear_velocity_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".aligned_linear_velocity.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(aligned_linear_velocity_valueless_variable);
-}
-
-IVariable<geometry::Vec> const* ADrivingAgent::get_linear_acceleration_variable() const
-{
-    IValuelessVariable const *linear_acceleration_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".linear_acceleration.base");
-    return dynamic_cast<IVariable<geometry::Vec> const*>(linear_acceleration_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE> const* ADrivingAgent::get_aligned_linear_acceleration_variable() const
-{
-    IValuelessVariable const *aligned_linear_acceleration_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".aligned_linear_acceleration.indirect_actuation");
-    return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(aligned_linear_acceleration_valueless_variable);
-}
-
-IVariable<geometry::Vec> const* ADrivingAgent::get_external_linear_acceleration_variable() const
-{
-    IValuelessVariable const *linear_acceleration_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".linear_acceleration.external");
-    return dynamic_cast<IVariable<geometry::Vec> const*>(linear_acceleration_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE> const* ADrivingAgent::get_rotation_variable() const
-{
-    IValuelessVariable const *rotation_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".rotation.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(rotation_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE> const* ADrivingAgent::get_steer_variable() const
-{
-    IValuelessVariable const *steer_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".steer.indirect_actuation");
-    return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(steer_valueless_variable);
-}
+    DrivingAgentParameterHandles const &handles =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
 
-IVariable<FP_DATA_TYPE> const* ADrivingAgent::get_angular_velocity_variable() const
-{
-    IValuelessVariable const *angular_velocity_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".angular_velocity.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(angular_velocity_valueless_variable);
+    if (constant_handle == handles.id)
+    {
+        return this->get_id_constant();
+    }
+    else if (constant_handle == handles.ego)
+    {
+        return this->get_ego_constant();
+    }
+    else if (constant_handle == handles.bb_length)
+    {
+        return this->get_bb_length_constant();
+    }
+    else if (constant_handle == handles.bb_width)
+    {
+        return this->get_bb_width_constant();
+    }
+    else if (constant_handle == handles.driving_agent_class)
+    {
+        return this->get_driving_agent_class_constant();
+    }
+    else
+    {
+        return nullptr;
+    }
 }
 
-IVariable<temporal::Duration> const* ADrivingAgent::get_ttc_variable() const
+IValuelessVariable const* ADrivingAgent::get_variable_parameter(ParameterHandle variable_handle) const
 {
-    IValuelessVariable const *ttc_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".ttc.base");
-    return dynamic_cast<IVariable<temporal::Duration> const*>(ttc_valueless_variable);
-}
+    DrivingAgentParameterHandles const &handles =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
 
-IVariable<temporal::Duration> const* ADrivingAgent::get_cumilative_collision_time_variable() const
-{
-    IValuelessVariable const *cumilative_collision_time_valueless_variable =
-            this->get_variable_parameter(this->get_name() + ".cumilative_collision_time.base");
-    return dynamic_cast<IVariable<temporal::Duration> const*>(cumilative_collision_time_valueless_variable);
+    if (variable_handle == handles.position)
+    {
+        return this->get_position_variable();
+    }
+    else if (variable_handle == handles.linear_velocity)
+    {
+        return this->get_linear_velocity_variable();
+    }
+    else if (variable_handle == handles.aligned_linear_velocity)
+    {
+        return this->get_aligned_linear_velocity_variable();
+    }
+    else if (variable_handle == handles.linear_acceleration)
+    {
+        return this->get_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.aligned_linear_acceleration)
+    {
+        return this->get_aligned_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.external_linear_acceleration)
+    {
+        return this->get_external_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.rotation)
+    {
+        return this->get_rotation_variable();
+    }
+    else if (variable_handle == handles.steer)
+    {
+        return this->get_steer_variable();
+    }
+    else if (variable_handle == handles.angular_velocity)
+    {
+        return this->get_angular_velocity_variable();
+    }
+    else if (variable_handle == handles.ttc)
+    {
+        return this->get_ttc_variable();
+    }
+    else if (variable_handle == handles.cumilative_collision_time)
+    {
+        return this->get_cumilative_collision_time_variable();
+    }
+    else
+    {
+        return nullptr;
+    }
 }
 
 IReadOnlyDrivingAgentState const* ADrivingAgent::get_driving_agent_state(temporal::Time time) const
@@ -187,116 +163,90 @@ IEntityState* ADrivingAgent::get_mutable_state(temporal::Time time)
     return this->get_mutable_driving_agent_state(time);
 }
 
-IConstant<uint32_t>* ADrivingAgent::get_mutable_id_constant()
+IValuelessConstant* ADrivingAgent::get_mutable_constant_parameter(ParameterHandle constant_handle)
 {
-    IValuelessConstant *id_valueless_constant =
-            this->get_mutable_constant_parameter(this->get_name() + ".id");
-    return dynamic_cast<IConstant<uint32_t>*>(id_valueless_constant);
-}
-
-IConstant<bool>* ADrivingAgent::get_mutable_ego_constant()
-{
-    IValuelessConstant *ego_valueless_constant =
-            this->get_mutable_constant_parameter(this->get_name() + ".ego");
-    return dynamic_cast<IConstant<bool>*>(ego_valueless_constant);
-}
-
-IConstant<FP_DATA_TYPE>* ADrivingAgent::get_mutable_bb_length_constant()
-{
-    IValuelessConstant *bb_length_valueless_constant =
-            this->get_mutable_constant_parameter(this->get_name() + ".bb_length");
-    return dynamic_cast<IConstant<FP_DATA_TYPE>*>(bb_length_valueless_constant);
-}
-
-IConstant<FP_DATA_TYPE>* ADrivingAgent::get_mutable_bb_width_constant()
-{
-    IValuelessConstant *bb_width_valueless_constant =
-            this->get_mutable_constant_parameter(this->get_name() + ".bb_width");
-    return dynamic_cast<IConstant<FP_DATA_TYPE>*>(bb_width_valueless_constant);
-}
-
-IConstant<DrivingAgentClass>* ADrivingAgent::get_mutable_driving_agent_class_constant()
-{
-    IValuelessConstant *driving_agent_class_valueless_constant =
-            this->get_mutable_constant_parameter(this->get_name() + ".driving_agent_class");
-    return dynamic_cast<IConstant<DrivingAgentClass>*>(driving_agent_class_valueless_constant);
-}
-
-IVariable<geometry::Vec>* ADrivingAgent::get_mutable_position_variable()
-{
-    IValuelessVariable *position_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".position.base");
-    return dynamic_cast<IVariable<geometry::Vec>*>(position_valueless_variable);
-}
-
-IVariable<geometry::Vec>* ADrivingAgent::get_mutable_linear_velocity_variable()
-{
-    IValuelessVariable *linear_velocity_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".linear_velocity.base");
-    return dynamic_cast<IVariable<geometry::Vec>*>(linear_velocity_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE>* ADrivingAgent::get_mutable_aligned_linear_velocity_variable()
-{
-    IValuelessVariable *aligned_linear_velocity_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".aligned_linear_velocity.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(aligned_linear_velocity_valueless_variable);
-}
-
-IVariable<geometry::Vec>* ADrivingAgent::get_mutable_linear_acceleration_variable()
-{
-    IValuelessVariable *linear_acceleration_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".linear_acceleration.base");
-    return dynamic_cast<IVariable<geometry::Vec>*>(linear_acceleration_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE>* ADrivingAgent::get_mutable_aligned_linear_acceleration_variable()
-{
-    IValuelessVariable *aligned_linear_acceleration_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".aligned_linear_acceleration.indirect_actuation");
-    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(aligned_linear_acceleration_valueless_variable);
-}
-
-IVariable<geometry::Vec>* ADrivingAgent::get_mutable_external_linear_acceleration_variable()
-{
-    IValuelessVariable *linear_acceleration_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".linear_acceleration.external");
-    return dynamic_cast<IVariable<geometry::Vec>*>(linear_acceleration_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE>* ADrivingAgent::get_mutable_rotation_variable()
-{
-    IValuelessVariable *rotation_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".rotation.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(rotation_valueless_variable);
-}
-
-IVariable<FP_DATA_TYPE>* ADrivingAgent::get_mutable_steer_variable()
-{
-    IValuelessVariable *steer_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".steer.indirect_actuation");
-    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(steer_valueless_variable);
-}
+    DrivingAgentParameterHandles const &handles =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
 
-IVariable<FP_DATA_TYPE>* ADrivingAgent::get_mutable_angular_velocity_variable()
-{
-    IValuelessVariable *angular_velocity_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".angular_velocity.base");
-    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(angular_velocity_valueless_variable);
+    if (constant_handle == handles.id)
+    {
+        return this->get_mutable_id_constant();
+    }
+    else if (constant_handle == handles.ego)
+    {
+        return this->get_mutable_ego_constant();
+    }
+    else if (constant_handle == handles.bb_length)
+    {
+        return this->get_mutable_bb_length_constant();
+    }
+    else if (constant_handle == handles.bb_width)
+    {
+        return this->get_mutable_bb_width_constant();
+    }
+    else if (constant_handle == handles.driving_agent_class)
+    {
+        return this->get_mutable_driving_agent_class_constant();
+    }
+    else
+    {
+        return nullptr;
+    }
 }
 
-IVariable<temporal::Duration>* ADrivingAgent::get_mutable_ttc_variable()
+IValuelessVariable* ADrivingAgent::get_mutable_variable_parameter(ParameterHandle variable_handle)
 {
-    IValuelessVariable *ttc_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".ttc.base");
-    return dynamic_cast<IVariable<temporal::Duration>*>(ttc_valueless_variable);
-}
+    DrivingAgentParameterHandles const &handles =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
 
-IVariable<temporal::Duration>* ADrivingAgent::get_mutable_cumilative_collision_time_variable()
-{
-    IValuelessVariable *cumilative_collision_time_valueless_variable =
-            this->get_mutable_variable_parameter(this->get_name() + ".cumilative_collision_time.base");
-    return dynamic_cast<IVariable<temporal::Duration>*>(cumilative_collision_time_valueless_variable);
+    if (variable_handle == handles.position)
+    {
+        return this->get_mutable_position_variable();
+    }
+    else if (variable_handle == handles.linear_velocity)
+    {
+        return this->get_mutable_linear_velocity_variable();
+    }
+    else if (variable_handle == handles.aligned_linear_velocity)
+    {
+        return this->get_mutable_aligned_linear_velocity_variable();
+    }
+    else if (variable_handle == handles.linear_acceleration)
+    {
+        return this->get_mutable_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.aligned_linear_acceleration)
+    {
+        return this->get_mutable_aligned_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.external_linear_acceleration)
+    {
+        return this->get_mutable_external_linear_acceleration_variable();
+    }
+    else if (variable_handle == handles.rotation)
+    {
+        return this->get_mutable_rotation_variable();
+    }
+    else if (variable_handle == handles.steer)
+    {
+        return this->get_mutable_steer_variable();
+    }
+    else if (variable_handle == handles.angular_velocity)
+    {
+        return this->get_mutable_angular_velocity_variable();
+    }
+    else if (variable_handle == handles.ttc)
+    {
+        return this->get_mutable_ttc_variable();
+    }
+    else if (variable_handle == handles.cumilative_collision_time)
+    {
+        return this->get_mutable_cumilative_collision_time_variable();
+    }
+    else
+    {
+        return nullptr;
+    }
 }
 
 IDrivingAgentState* ADrivingAgent::get_mutable_driving_agent_state(temporal::Time time)
@@ -0,0 +1,793 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/structures/stl/stl_concat_array.hpp>
+#include <ori/simcars/agent/driving_agent_fork.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+DrivingAgentFork::DrivingAgentFork(IDrivingAgent const *parent_driving_agent,
+                                   IDrivingScene const *driving_scene)
+    : parent_driving_agent(parent_driving_agent), name(parent_driving_agent->get_name()),
+      driving_scene(driving_scene == nullptr ? parent_driving_agent->get_driving_scene() : driving_scene),
+      forked_constant_dict(FORKED_PARAMETER_BIN_COUNT),
+      forked_variable_dict(FORKED_PARAMETER_BIN_COUNT) {}
+
+DrivingAgentFork::~DrivingAgentFork()
+{
+    size_t i;
+
+    structures::IArray<IValuelessConstant*> const *forked_constants =
+            forked_constant_dict.get_values();
+    for (i = 0; i < forked_constants->count(); ++i)
+    {
+        delete (*forked_constants)[i];
+    }
+
+    structures::IArray<IValuelessVariable*> const *forked_variables =
+            forked_variable_dict.get_values();
+    for (i = 0; i < forked_variables->count(); ++i)
+    {
+        delete (*forked_variables)[i];
+    }
+}
+
+IValuelessConstant* DrivingAgentFork::fork_constant_parameter(ParameterHandle constant_handle,
+                                                              IValuelessConstant const *parent_constant)
+{
+    if (parent_constant == nullptr)
+    {
+        return nullptr;
+    }
+
+    IValuelessConstant *constant = parent_constant->valueless_constant_shallow_copy();
+    forked_constant_dict.update(constant_handle, constant);
+    return constant;
+}
+
+IValuelessVariable* DrivingAgentFork::fork_variable_parameter(ParameterHandle variable_handle,
+                                                              IValuelessVariable const *parent_variable)
+{
+    if (parent_variable == nullptr)
+    {
+        return nullptr;
+    }
+
+    IValuelessVariable *variable = parent_variable->valueless_deep_copy();
+    forked_variable_dict.update(variable_handle, variable);
+    return variable;
+}
+
+IDrivingAgent const* DrivingAgentFork::get_parent_driving_agent() const
+{
+    return parent_driving_agent;
+}
+
+size_t DrivingAgentFork::get_forked_parameter_count() const
+{
+    return forked_constant_dict.count() + forked_variable_dict.count();
+}
+
+std::string DrivingAgentFork::get_name() const
+{
+    return name;
+}
+
+geometry::Vec DrivingAgentFork::get_min_spatial_limits() const
+{
+    return parent_driving_agent->get_min_spatial_limits();
+}
+
+geometry::Vec DrivingAgentFork::get_max_spatial_limits() const
+{
+    return parent_driving_agent->get_max_spatial_limits();
+}
+
+temporal::Time DrivingAgentFork::get_min_temporal_limit() const
+{
+    return parent_driving_agent->get_min_temporal_limit();
+}
+
+temporal::Time DrivingAgentFork::get_max_temporal_limit() const
+{
+    return parent_driving_agent->get_max_temporal_limit();
+}
+
+structures::IArray<IValuelessConstant const*>* DrivingAgentFork::get_constant_parameters() const
+{
+    structures::IArray<IValuelessConstant const*> *parent_constants =
+            parent_driving_agent->get_constant_parameters();
+
+    if (forked_constant_dict.count() == 0)
+    {
+        return parent_constants;
+    }
+
+    ParameterRegistry const *registry = ParameterRegistry::get_instance();
+
+    structures::IArray<IValuelessConstant const*> *constants =
+            new structures::stl::STLStackArray<IValuelessConstant const*>(parent_constants->count());
+
+    ParameterHandle constant_handle;
+    size_t i;
+    for (i = 0; i < parent_constants->count(); ++i)
+    {
+        IValuelessConstant const *constant = (*parent_constants)[i];
+        if (registry->get_handle(constant->get_parameter_name(), constant_handle) &&
+                forked_constant_dict.contains(constant_handle))
+        {
+            constant = forked_constant_dict[constant_handle];
+        }
+        (*constants)[i] = constant;
+    }
+
+    delete parent_constants;
+
+    return constants;
+}
+
+IValuelessConstant const* DrivingAgentFork::get_constant_parameter(std::string const &constant_name) const
+{
+    ParameterHandle constant_handle;
+    if (forked_constant_dict.count() != 0 &&
+            ParameterRegistry::get_instance()->get_handle(name, constant_name, constant_handle) &&
+            forked_constant_dict.contains(constant_handle))
+    {
+        return forked_constant_dict[constant_handle];
+    }
+    else
+    {
+        return parent_driving_agent->get_constant_parameter(constant_name);
+    }
+}
+
+IValuelessConstant const* DrivingAgentFork::get_constant_parameter(ParameterHandle constant_handle) const
+{
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return forked_constant_dict[constant_handle];
+    }
+    else
+    {
+        return parent_driving_agent->get_constant_parameter(constant_handle);
+    }
+}
+
+structures::IArray<IValuelessVariable const*>* DrivingAgentFork::get_variable_parameters() const
+{
+    structures::IArray<IValuelessVariable const*> *parent_variables =
+            parent_driving_agent->get_variable_parameters();
+
+    if (forked_variable_dict.count() == 0)
+    {
+        return parent_variables;
+    }
+
+    ParameterRegistry const *registry = ParameterRegistry::get_instance();
+
+    structures::IArray<IValuelessVariable const*> *variables =
+            new structures::stl::STLStackArray<IValuelessVariable const*>(parent_variables->count());
+
+    ParameterHandle variable_handle;
+    size_t i;
+    for (i = 0; i < parent_variables->count(); ++i)
+    {
+        IValuelessVariable const *variable = (*parent_variables)[i];
+        if (registry->get_handle(variable->get_parameter_name(), variable_handle) &&
+                forked_variable_dict.contains(variable_handle))
+        {
+            variable = forked_variable_dict[variable_handle];
+        }
+        (*variables)[i] = variable;
+    }
+
+    delete parent_variables;
+
+    return variables;
+}
+
+IValuelessVariable const* DrivingAgentFork::get_variable_parameter(std::string const &variable_name) const
+{
+    ParameterHandle variable_handle;
+    if (forked_variable_dict.count() != 0 &&
+            ParameterRegistry::get_instance()->get_handle(name, variable_name, variable_handle) &&
+            forked_variable_dict.contains(variable_handle))
+    {
+        return forked_variable_dict[variable_handle];
+    }
+    else
+    {
+        return parent_driving_agent->get_variable_parameter(variable_name);
+    }
+}
+
+IValuelessVariable const* DrivingAgentFork::get_variable_parameter(ParameterHandle variable_handle) const
+{
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return forked_variable_dict[variable_handle];
+    }
+    else
+    {
+        return parent_driving_agent->get_variable_parameter(variable_handle);
+    }
+}
+
+structures::IArray<IValuelessEvent const*>* DrivingAgentFork::get_events() const
+{
+    structures::IArray<IValuelessVariable const*> *variables = this->get_variable_parameters();
+
+    structures::stl::STLConcatArray<IValuelessEvent const*> *events =
+                new structures::stl::STLConcatArray<IValuelessEvent const*>(
+                    variables->count());
+
+    size_t i;
+
+    for(i = 0; i < variables->count(); ++i)
+    {
+        events->get_array(i) = (*variables)[i]->get_valueless_events();
+    }
+
+    delete variables;
+
+    return events;
+}
+
+IDrivingAgent* DrivingAgentFork::driving_agent_deep_copy(IDrivingScene *driving_scene) const
+{
+    DrivingAgentFork *driving_agent;
+    if (driving_scene == nullptr)
+    {
+        driving_agent = new DrivingAgentFork(parent_driving_agent, this->driving_scene);
+    }
+    else
+    {
+        driving_agent = new DrivingAgentFork(parent_driving_agent, driving_scene);
+    }
+
+    size_t i;
+
+    structures::IArray<ParameterHandle> const *forked_constant_handles =
+            forked_constant_dict.get_keys();
+    for (i = 0; i < forked_constant_handles->count(); ++i)
+    {
+        ParameterHandle constant_handle = (*forked_constant_handles)[i];
+        driving_agent->forked_constant_dict.update(
+                    constant_handle,
+                    forked_constant_dict[constant_handle]->valueless_constant_shallow_copy());
+    }
+
+    structures::IArray<ParameterHandle> const *forked_variable_handles =
+            forked_variable_dict.get_keys();
+    for (i = 0; i < forked_variable_handles->count(); ++i)
+    {
+        ParameterHandle variable_handle = (*forked_variable_handles)[i];
+        driving_agent->forked_variable_dict.update(
+                    variable_handle,
+                    forked_variable_dict[variable_handle]->valueless_deep_copy());
+    }
+
+    return driving_agent;
+}
+
+IDrivingScene const* DrivingAgentFork::get_driving_scene() const
+{
+    return driving_scene;
+}
+
+IConstant<uint32_t> const* DrivingAgentFork::get_id_constant() const
+{
+    ParameterHandle constant_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().id;
+
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return dynamic_cast<IConstant<uint32_t> const*>(forked_constant_dict[constant_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_id_constant();
+    }
+}
+
+IConstant<bool> const* DrivingAgentFork::get_ego_constant() const
+{
+    ParameterHandle constant_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ego;
+
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return dynamic_cast<IConstant<bool> const*>(forked_constant_dict[constant_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_ego_constant();
+    }
+}
+
+IConstant<FP_DATA_TYPE> const* DrivingAgentFork::get_bb_length_constant() const
+{
+    ParameterHandle constant_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_length;
+
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(forked_constant_dict[constant_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_bb_length_constant();
+    }
+}
+
+IConstant<FP_DATA_TYPE> const* DrivingAgentFork::get_bb_width_constant() const
+{
+    ParameterHandle constant_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_width;
+
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(forked_constant_dict[constant_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_bb_width_constant();
+    }
+}
+
+IConstant<DrivingAgentClass> const* DrivingAgentFork::get_driving_agent_class_constant() const
+{
+    ParameterHandle constant_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().driving_agent_class;
+
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return dynamic_cast<IConstant<DrivingAgentClass> const*>(forked_constant_dict[constant_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_driving_agent_class_constant();
+    }
+}
+
+IVariable<geometry::Vec> const* DrivingAgentFork::get_position_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<geometry::Vec> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_position_variable();
+    }
+}
+
+IVariable<geometry::Vec> const* DrivingAgentFork::get_linear_velocity_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_velocity;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<geometry::Vec> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_linear_velocity_variable();
+    }
+}
+
+IVariable<FP_DATA_TYPE> const* DrivingAgentFork::get_aligned_linear_velocity_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_aligned_linear_velocity_variable();
+    }
+}
+
+IVariable<geometry::Vec> const* DrivingAgentFork::get_linear_acceleration_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_acceleration;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<geometry::Vec> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_linear_acceleration_variable();
+    }
+}
+
+IVariable<FP_DATA_TYPE> const* DrivingAgentFork::get_aligned_linear_acceleration_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_acceleration;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_aligned_linear_acceleration_variable();
+    }
+}
+
+IVariable<geometry::Vec> const* DrivingAgentFork::get_external_linear_acceleration_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().external_linear_acceleration;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<geometry::Vec> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_external_linear_acceleration_variable();
+    }
+}
+
+IVariable<FP_DATA_TYPE> const* DrivingAgentFork::get_rotation_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().rotation;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_rotation_variable();
+    }
+}
+
+IVariable<FP_DATA_TYPE> const* DrivingAgentFork::get_steer_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().steer;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_steer_variable();
+    }
+}
+
+IVariable<FP_DATA_TYPE> const* DrivingAgentFork::get_angular_velocity_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().angular_velocity;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<FP_DATA_TYPE> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_angular_velocity_variable();
+    }
+}
+
+IVariable<temporal::Duration> const* DrivingAgentFork::get_ttc_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ttc;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<temporal::Duration> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_ttc_variable();
+    }
+}
+
+IVariable<temporal::Duration> const* DrivingAgentFork::get_cumilative_collision_time_variable() const
+{
+    ParameterHandle variable_handle =
+            ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().cumilative_collision_time;
+
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return dynamic_cast<IVariable<temporal::Duration> const*>(forked_variable_dict[variable_handle]);
+    }
+    else
+    {
+        return parent_driving_agent->get_cumilative_collision_time_variable();
+    }
+}
+
+
+structures::IArray<IValuelessConstant*>* DrivingAgentFork::get_mutable_constant_parameters()
+{
+    structures::IArray<IValuelessConstant const*> *parent_constants =
+            parent_driving_agent->get_constant_parameters();
+
+    ParameterRegistry *registry = ParameterRegistry::get_instance();
+
+    structures::IArray<IValuelessConstant*> *constants =
+            new structures::stl::STLStackArray<IValuelessConstant*>(parent_constants->count());
+
+    size_t i;
+    for (i = 0; i < parent_constants->count(); ++i)
+    {
+        IValuelessConstant const *parent_constant = (*parent_constants)[i];
+        ParameterHandle constant_handle = registry->intern(parent_constant->get_parameter_name());
+        if (forked_constant_dict.contains(constant_handle))
+        {
+            (*constants)[i] = forked_constant_dict[constant_handle];
+        }
+        else
+        {
+            (*constants)[i] = fork_constant_parameter(constant_handle, parent_constant);
+        }
+    }
+
+    delete parent_constants;
+
+    return constants;
+}
+
+IValuelessConstant* DrivingAgentFork::get_mutable_constant_parameter(std::string const &constant_name)
+{
+    ParameterRegistry *registry = ParameterRegistry::get_instance();
+
+    ParameterHandle constant_handle;
+    bool constant_handle_found = registry->get_handle(name, constant_name, constant_handle);
+    if (constant_handle_found && forked_constant_dict.contains(constant_handle))
+    {
+        return forked_constant_dict[constant_handle];
+    }
+
+    IValuelessConstant const *parent_constant =
+            parent_driving_agent->get_constant_parameter(constant_name);
+    if (parent_constant == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!constant_handle_found)
+    {
+        constant_handle = registry->intern(parent_constant->get_parameter_name());
+    }
+    return fork_constant_parameter(constant_handle, parent_constant);
+}
+
+IValuelessConstant* DrivingAgentFork::get_mutable_constant_parameter(ParameterHandle constant_handle)
+{
+    if (forked_constant_dict.contains(constant_handle))
+    {
+        return forked_constant_dict[constant_handle];
+    }
+    else
+    {
+        return fork_constant_parameter(constant_handle,
+                                       parent_driving_agent->get_constant_parameter(constant_handle));
+    }
+}
+
+structures::IArray<IValuelessVariable*>* DrivingAgentFork::get_mutable_variable_parameters()
+{
+    structures::IArray<IValuelessVariable const*> *parent_variables =
+            parent_driving_agent->get_variable_parameters();
+
+    ParameterRegistry *registry = ParameterRegistry::get_instance();
+
+    structures::IArray<IValuelessVariable*> *variables =
+            new structures::stl::STLStackArray<IValuelessVariable*>(parent_variables->count());
+
+    size_t i;
+    for (i = 0; i < parent_variables->count(); ++i)
+    {
+        IValuelessVariable const *parent_variable = (*parent_variables)[i];
+        ParameterHandle variable_handle = registry->intern(parent_variable->get_parameter_name());
+        if (forked_variable_dict.contains(variable_handle))
+        {
+            (*variables)[i] = forked_variable_dict[variable_handle];
+        }
+        else
+        {
+            (*variables)[i] = fork_variable_parameter(variable_handle, parent_variable);
+        }
+    }
+
+    delete parent_variables;
+
+    return variables;
+}
+
+IValuelessVariable* DrivingAgentFork::get_mutable_variable_parameter(std::string const &variable_name)
+{
+    ParameterRegistry *registry = ParameterRegistry::get_instance();
+
+    ParameterHandle variable_handle;
+    bool variable_handle_found = registry->get_handle(name, variable_name, variable_handle);
+    if (variable_handle_found && forked_variable_dict.contains(variable_handle))
+    {
+        return forked_variable_dict[variable_handle];
+    }
+
+    IValuelessVariable const *parent_variable =
+            parent_driving_agent->get_variable_parameter(variable_name);
+    if (parent_variable == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!variable_handle_found)
+    {
+        variable_handle = registry->intern(parent_variable->get_parameter_name());
+    }
+    return fork_variable_parameter(variable_handle, parent_variable);
+}
+
+IValuelessVariable* DrivingAgentFork::get_mutable_variable_parameter(ParameterHandle variable_handle)
+{
+    if (forked_variable_dict.contains(variable_handle))
+    {
+        return forked_variable_dict[variable_handle];
+    }
+    else
+    {
+        return fork_variable_parameter(variable_handle,
+                                       parent_driving_agent->get_variable_parameter(variable_handle));
+    }
+}
+
+structures::IArray<IValuelessEvent*>* DrivingAgentFork::get_mutable_events()
+{
+    structures::IArray<IValuelessVariable*> *variables = this->get_mutable_variable_parameters();
+
+    structures::stl::STLConcatArray<IValuelessEvent*> *events =
+                new structures::stl::STLConcatArray<IValuelessEvent*>(
+                    variables->count());
+
+    size_t i;
+
+    for(i = 0; i < variables->count(); ++i)
+    {
+        events->get_array(i) = (*variables)[i]->get_mutable_valueless_events();
+    }
+
+    delete variables;
+
+    return events;
+}
+
+IConstant<uint32_t>* DrivingAgentFork::get_mutable_id_constant()
+{
+    return dynamic_cast<IConstant<uint32_t>*>(
+                this->get_mutable_constant_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().id));
+}
+
+IConstant<bool>* DrivingAgentFork::get_mutable_ego_constant()
+{
+    return dynamic_cast<IConstant<bool>*>(
+                this->get_mutable_constant_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ego));
+}
+
+IConstant<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_bb_length_constant()
+{
+    return dynamic_cast<IConstant<FP_DATA_TYPE>*>(
+                this->get_mutable_constant_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_length));
+}
+
+IConstant<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_bb_width_constant()
+{
+    return dynamic_cast<IConstant<FP_DATA_TYPE>*>(
+                this->get_mutable_constant_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_width));
+}
+
+IConstant<DrivingAgentClass>* DrivingAgentFork::get_mutable_driving_agent_class_constant()
+{
+    return dynamic_cast<IConstant<DrivingAgentClass>*>(
+                this->get_mutable_constant_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().driving_agent_class));
+}
+
+IVariable<geometry::Vec>* DrivingAgentFork::get_mutable_position_variable()
+{
+    return dynamic_cast<IVariable<geometry::Vec>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position));
+}
+
+IVariable<geometry::Vec>* DrivingAgentFork::get_mutable_linear_velocity_variable()
+{
+    return dynamic_cast<IVariable<geometry::Vec>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_velocity));
+}
+
+IVariable<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_aligned_linear_velocity_variable()
+{
+    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity));
+}
+
+IVariable<geometry::Vec>* DrivingAgentFork::get_mutable_linear_acceleration_variable()
+{
+    return dynamic_cast<IVariable<geometry::Vec>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_acceleration));
+}
+
+IVariable<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_aligned_linear_acceleration_variable()
+{
+    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_acceleration));
+}
+
+IVariable<geometry::Vec>* DrivingAgentFork::get_mutable_external_linear_acceleration_variable()
+{
+    return dynamic_cast<IVariable<geometry::Vec>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().external_linear_acceleration));
+}
+
+IVariable<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_rotation_variable()
+{
+    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().rotation));
+}
+
+IVariable<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_steer_variable()
+{
+    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().steer));
+}
+
+IVariable<FP_DATA_TYPE>* DrivingAgentFork::get_mutable_angular_velocity_variable()
+{
+    return dynamic_cast<IVariable<FP_DATA_TYPE>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().angular_velocity));
+}
+
+IVariable<temporal::Duration>* DrivingAgentFork::get_mutable_ttc_variable()
+{
+    return dynamic_cast<IVariable<temporal::Duration>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ttc));
+}
+
+IVariable<temporal::Duration>* DrivingAgentFork::get_mutable_cumilative_collision_time_variable()
+{
+    return dynamic_cast<IVariable<temporal::Duration>*>(
+                this->get_mutable_variable_parameter(
+                    ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().cumilative_collision_time));
+}
+
+}
+}
+}
@@ -0,0 +1,123 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/agent/driving_scene_fork.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+DrivingSceneFork::DrivingSceneFork(IDrivingScene const *parent_driving_scene,
+                                   size_t driving_agent_count)
+    : parent_driving_scene(parent_driving_scene), driving_agent_dict(driving_agent_count) {}
+
+DrivingSceneFork::~DrivingSceneFork()
+{
+    structures::IArray<IDrivingAgent*> const *driving_agents = driving_agent_dict.get_values();
+
+    for (size_t i = 0; i < driving_agents->count(); ++i)
+    {
+        delete (*driving_agents)[i];
+    }
+}
+
+DrivingSceneFork* DrivingSceneFork::construct_from(IDrivingScene const *parent_driving_scene)
+{
+    structures::IArray<IDrivingAgent const*> *parent_driving_agents =
+            parent_driving_scene->get_driving_agents();
+
+    DrivingSceneFork *new_driving_scene =
+            new DrivingSceneFork(parent_driving_scene, parent_driving_agents->count());
+
+    for (size_t i = 0; i < parent_driving_agents->count(); ++i)
+    {
+        IDrivingAgent const *parent_driving_agent = (*parent_driving_agents)[i];
+        new_driving_scene->driving_agent_dict.update(
+                    parent_driving_agent->get_name(),
+                    new DrivingAgentFork(parent_driving_agent, new_driving_scene));
+    }
+
+    delete parent_driving_agents;
+
+    return new_driving_scene;
+}
+
+IDrivingScene const* DrivingSceneFork::get_parent_driving_scene() const
+{
+    return parent_driving_scene;
+}
+
+IDrivingScene* DrivingSceneFork::driving_scene_deep_copy() const
+{
+    DrivingSceneFork *new_driving_scene =
+            new DrivingSceneFork(parent_driving_scene, driving_agent_dict.count());
+
+    structures::IArray<IDrivingAgent*> const *driving_agents = driving_agent_dict.get_values();
+
+    for (size_t i = 0; i < driving_agents->count(); ++i)
+    {
+        IDrivingAgent *driving_agent = (*driving_agents)[i];
+        new_driving_scene->driving_agent_dict.update(
+                    driving_agent->get_name(),
+                    driving_agent->driving_agent_deep_copy(new_driving_scene));
+    }
+
+    return new_driving_scene;
+}
+
+geometry::Vec DrivingSceneFork::get_min_spatial_limits() const
+{
+    return parent_driving_scene->get_min_spatial_limits();
+}
+
+geometry::Vec DrivingSceneFork::get_max_spatial_limits() const
+{
+    return parent_driving_scene->get_max_spatial_limits();
+}
+
+temporal::Duration DrivingSceneFork::get_time_step() const
+{
+    return parent_driving_scene->get_time_step();
+}
+
+temporal::Time DrivingSceneFork::get_min_temporal_limit() const
+{
+    return parent_driving_scene->get_min_temporal_limit();
+}
+
+temporal::Time DrivingSceneFork::get_max_temporal_limit() const
+{
+    return parent_driving_scene->get_max_temporal_limit();
+}
+
+structures::IArray<IDrivingAgent const*>* DrivingSceneFork::get_driving_agents() const
+{
+    structures::stl::STLStackArray<IDrivingAgent const*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent const*>(driving_agent_dict.count());
+    cast_array(*driving_agent_dict.get_values(), *driving_agents);
+    return driving_agents;
+}
+
+IDrivingAgent const* DrivingSceneFork::get_driving_agent(std::string const &driving_agent_name) const
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+structures::IArray<IDrivingAgent*>* DrivingSceneFork::get_mutable_driving_agents()
+{
+    structures::stl::STLStackArray<IDrivingAgent*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent*>(driving_agent_dict.count());
+    driving_agent_dict.get_values(driving_agents);
+    return driving_agents;
+}
+
+IDrivingAgent* DrivingSceneFork::get_mutable_driving_agent(std::string const &driving_agent_name)
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+}
+}
+}
@@ -0,0 +1,341 @@
+
+#include <ori/simcars/agent/basic_constant.hpp>
+#include <ori/simcars/agent/parameter_registry.hpp>
+#include <ori/simcars/agent/basic_driving_agent_state.hpp>
+#include <ori/simcars/agent/view_driving_agent_state.hpp>
+#include <ori/simcars/agent/driving_scene_state_buffer.hpp>
+
+#include <cmath>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+// Constants a basic state already owns, such as those from an earlier commit to it, are written to rather than
+// replaced, constants are only allocated for parameters the state does not own
+template <typename T>
+static void commit_constant_value(IDrivingAgentState *state, BasicDrivingAgentState *basic_state,
+                                  ParameterHandle parameter_handle, std::string const &parameter_name, T const &value,
+                                  void (IDrivingAgentState::*set_constant)(IConstant<T>*))
+{
+    IConstant<T> *constant = basic_state != nullptr ?
+                dynamic_cast<IConstant<T>*>(basic_state->get_owned_mutable_parameter_value(parameter_handle)) :
+                nullptr;
+    if (constant != nullptr)
+    {
+        constant->set_value(value);
+    }
+    else
+    {
+        (state->*set_constant)(new BasicConstant<T>(state->get_name(), parameter_name, value));
+    }
+}
+
+void DrivingAgentStateColumns::resize(size_t count)
+{
+    position_xs.resize(count);
+    position_ys.resize(count);
+    linear_velocity_xs.resize(count);
+    linear_velocity_ys.resize(count);
+    aligned_linear_velocities.resize(count);
+    linear_acceleration_xs.resize(count);
+    linear_acceleration_ys.resize(count);
+    aligned_linear_accelerations.resize(count);
+    external_linear_acceleration_xs.resize(count);
+    external_linear_acceleration_ys.resize(count);
+    rotations.resize(count);
+    steers.resize(count);
+    angular_velocities.resize(count);
+    ttcs.resize(count);
+    cumilative_collision_times.resize(count);
+}
+
+geometry::Vec DrivingAgentStateColumns::get_position(size_t idx) const
+{
+    return geometry::Vec(position_xs[idx], position_ys[idx]);
+}
+
+geometry::Vec DrivingAgentStateColumns::get_linear_velocity(size_t idx) const
+{
+    return geometry::Vec(linear_velocity_xs[idx], linear_velocity_ys[idx]);
+}
+
+geometry::Vec DrivingAgentStateColumns::get_linear_acceleration(size_t idx) const
+{
+    return geometry::Vec(linear_acceleration_xs[idx], linear_acceleration_ys[idx]);
+}
+
+geometry::Vec DrivingAgentStateColumns::get_external_linear_acceleration(size_t idx) const
+{
+    return geometry::Vec(external_linear_acceleration_xs[idx], external_linear_acceleration_ys[idx]);
+}
+
+void DrivingAgentStateColumns::set_position(size_t idx, geometry::Vec const &position)
+{
+    position_xs[idx] = position.x();
+    position_ys[idx] = position.y();
+}
+
+void DrivingAgentStateColumns::set_linear_velocity(size_t idx, geometry::Vec const &linear_velocity)
+{
+    linear_velocity_xs[idx] = linear_velocity.x();
+    linear_velocity_ys[idx] = linear_velocity.y();
+}
+
+void DrivingAgentStateColumns::set_linear_acceleration(size_t idx,
+                                                       geometry::Vec const &linear_acceleration)
+{
+    linear_acceleration_xs[idx] = linear_acceleration.x();
+    linear_acceleration_ys[idx] = linear_acceleration.y();
+}
+
+void DrivingAgentStateColumns::set_external_linear_acceleration(
+        size_t idx, geometry::Vec const &external_linear_acceleration)
+{
+    external_linear_acceleration_xs[idx] = external_linear_acceleration.x();
+    external_linear_acceleration_ys[idx] = external_linear_acceleration.y();
+}
+
+
+size_t DrivingSceneStateBuffer::count() const
+{
+    return next_states.size();
+}
+
+IReadOnlyDrivingAgentState const* DrivingSceneStateBuffer::get_current_state(size_t idx) const
+{
+    return current_states[idx];
+}
+
+IDrivingAgentState* DrivingSceneStateBuffer::get_next_state(size_t idx) const
+{
+    return next_states[idx];
+}
+
+// Storage is retained, so a buffer reused across time steps does not reallocate
+void DrivingSceneStateBuffer::clear()
+{
+    current_states.clear();
+    next_states.clear();
+}
+
+size_t DrivingSceneStateBuffer::push_back(IReadOnlyDrivingAgentState const *current_state,
+                                          IDrivingAgentState *next_state)
+{
+    size_t idx = next_states.size();
+
+    current_states.push_back(current_state);
+    next_states.push_back(next_state);
+
+    current.resize(idx + 1);
+    next.resize(idx + 1);
+    bb_lengths.resize(idx + 1);
+    bb_widths.resize(idx + 1);
+    bb_half_spans.resize(idx + 1);
+    bounding_boxes.resize(idx + 1);
+    aligned_bb_half_widths.resize(idx + 1);
+    aligned_bb_half_heights.resize(idx + 1);
+    simulation_flags.resize(idx + 1);
+    commit_flags.resize(idx + 1);
+    rotation_coss.resize(idx + 1);
+    rotation_sins.resize(idx + 1);
+    inverse_rotation_coss.resize(idx + 1);
+    inverse_rotation_sins.resize(idx + 1);
+
+    simulation_flags[idx] = false;
+    commit_flags[idx] = false;
+
+    return idx;
+}
+
+void DrivingSceneStateBuffer::load_states(size_t idx)
+{
+    IReadOnlyDrivingAgentState const *current_state = current_states[idx];
+    IDrivingAgentState const *next_state = next_states[idx];
+
+    bb_lengths[idx] = next_state->get_bb_length_constant()->get_value();
+    bb_widths[idx] = next_state->get_bb_width_constant()->get_value();
+    bb_half_spans[idx] = 0.5f * std::sqrt(bb_lengths[idx] * bb_lengths[idx] + bb_widths[idx] * bb_widths[idx]);
+
+    bool simulation_flag = !next_state->is_populated();
+    simulation_flags[idx] = simulation_flag;
+    commit_flags[idx] = simulation_flag;
+
+    current.cumilative_collision_times[idx] =
+            current_state->get_cumilative_collision_time_variable()->get_value();
+
+    if (simulation_flag)
+    {
+        load_current_state(idx);
+
+        next.set_position(idx, geometry::Vec::Zero());
+        next.set_linear_velocity(idx, geometry::Vec::Zero());
+        next.aligned_linear_velocities[idx] = 0.0f;
+        next.set_linear_acceleration(idx, geometry::Vec::Zero());
+        next.aligned_linear_accelerations[idx] = 0.0f;
+        next.set_external_linear_acceleration(idx, geometry::Vec::Zero());
+        next.rotations[idx] = 0.0f;
+        next.steers[idx] = 0.0f;
+        next.angular_velocities[idx] = 0.0f;
+    }
+    else
+    {
+        next.set_position(idx, next_state->get_position_variable()->get_value());
+        next.set_linear_velocity(idx, next_state->get_linear_velocity_variable()->get_value());
+        next.rotations[idx] = next_state->get_rotation_variable()->get_value();
+    }
+
+    next.ttcs[idx] = temporal::Duration::max();
+    next.cumilative_collision_times[idx] = current.cumilative_collision_times[idx];
+}
+
+void DrivingSceneStateBuffer::load_current_state(size_t idx)
+{
+    IReadOnlyDrivingAgentState const *current_state = current_states[idx];
+
+    current.set_position(idx, current_state->get_position_variable()->get_value());
+    current.set_linear_velocity(idx, current_state->get_linear_velocity_variable()->get_value());
+    current.aligned_linear_velocities[idx] =
+            current_state->get_aligned_linear_velocity_variable()->get_value();
+    current.set_linear_acceleration(
+                idx, current_state->get_linear_acceleration_variable()->get_value());
+    current.aligned_linear_accelerations[idx] =
+            current_state->get_aligned_linear_acceleration_variable()->get_value();
+    current.rotations[idx] = current_state->get_rotation_variable()->get_value();
+    current.angular_velocities[idx] = current_state->get_angular_velocity_variable()->get_value();
+}
+
+void DrivingSceneStateBuffer::load_next_actuation(size_t idx)
+{
+    IDrivingAgentState const *next_state = next_states[idx];
+
+    next.aligned_linear_accelerations[idx] =
+            next_state->get_aligned_linear_acceleration_variable()->get_value();
+    next.steers[idx] = next_state->get_steer_variable()->get_value();
+    next.set_external_linear_acceleration(
+                idx, next_state->get_external_linear_acceleration_variable()->get_value());
+}
+
+void DrivingSceneStateBuffer::update_bounding_box(size_t idx)
+{
+    geometry::OBox &bounding_box = bounding_boxes[idx];
+
+    bounding_box.centre_x = next.position_xs[idx];
+    bounding_box.centre_y = next.position_ys[idx];
+    bounding_box.half_width = 0.5f * bb_lengths[idx];
+    bounding_box.half_height = 0.5f * bb_widths[idx];
+    bounding_box.cos_orientation = rotation_coss[idx];
+    bounding_box.sin_orientation = rotation_sins[idx];
+
+    aligned_bb_half_widths[idx] = std::abs(bounding_box.half_width * bounding_box.cos_orientation) +
+            std::abs(bounding_box.half_height * bounding_box.sin_orientation);
+    aligned_bb_half_heights[idx] = std::abs(bounding_box.half_width * bounding_box.sin_orientation) +
+            std::abs(bounding_box.half_height * bounding_box.cos_orientation);
+}
+
+bool DrivingSceneStateBuffer::check_aligned_bounding_box_overlap(size_t idx_1, size_t idx_2) const
+{
+    return std::abs(bounding_boxes[idx_1].centre_x - bounding_boxes[idx_2].centre_x) <=
+            aligned_bb_half_widths[idx_1] + aligned_bb_half_widths[idx_2] &&
+            std::abs(bounding_boxes[idx_1].centre_y - bounding_boxes[idx_2].centre_y) <=
+            aligned_bb_half_heights[idx_1] + aligned_bb_half_heights[idx_2];
+}
+
+void DrivingSceneStateBuffer::commit_next_kinematics(size_t idx) const
+{
+    IDrivingAgentState *next_state = next_states[idx];
+    ViewDrivingAgentState *view_next_state = dynamic_cast<ViewDrivingAgentState*>(next_state);
+
+    // Position is written last, as it is used to determine whether a state is populated
+    if (view_next_state != nullptr)
+    {
+        IDrivingAgent *driving_agent = view_next_state->get_mutable_agent();
+        temporal::Time time = view_next_state->get_time();
+
+        driving_agent->get_mutable_external_linear_acceleration_variable()->set_value(
+                    time, next.get_external_linear_acceleration(idx));
+        driving_agent->get_mutable_aligned_linear_acceleration_variable()->set_value(
+                    time, next.aligned_linear_accelerations[idx]);
+        driving_agent->get_mutable_steer_variable()->set_value(time, next.steers[idx]);
+        driving_agent->get_mutable_angular_velocity_variable()->set_value(
+                    time, next.angular_velocities[idx]);
+        driving_agent->get_mutable_rotation_variable()->set_value(time, next.rotations[idx]);
+        driving_agent->get_mutable_linear_acceleration_variable()->set_value(
+                    time, next.get_linear_acceleration(idx));
+        driving_agent->get_mutable_linear_velocity_variable()->set_value(
+                    time, next.get_linear_velocity(idx));
+        driving_agent->get_mutable_aligned_linear_velocity_variable()->set_value(
+                    time, next.aligned_linear_velocities[idx]);
+        driving_agent->get_mutable_position_variable()->set_value(time, next.get_position(idx));
+    }
+    else
+    {
+        DrivingAgentParameterHandles const &handles =
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
+        BasicDrivingAgentState *basic_next_state = dynamic_cast<BasicDrivingAgentState*>(next_state);
+
+        commit_constant_value(next_state, basic_next_state, handles.external_linear_acceleration,
+                              "linear_acceleration.external", next.get_external_linear_acceleration(idx),
+                              &IDrivingAgentState::set_external_linear_acceleration_variable);
+        commit_constant_value(next_state, basic_next_state, handles.aligned_linear_acceleration,
+                              "aligned_linear_acceleration.indirect_actuation", next.aligned_linear_accelerations[idx],
+                              &IDrivingAgentState::set_aligned_linear_acceleration_variable);
+        commit_constant_value(next_state, basic_next_state, handles.steer,
+                              "steer.indirect_actuation", next.steers[idx],
+                              &IDrivingAgentState::set_steer_variable);
+        commit_constant_value(next_state, basic_next_state, handles.angular_velocity,
+                              "angular_velocity.base", next.angular_velocities[idx],
+                              &IDrivingAgentState::set_angular_velocity_variable);
+        commit_constant_value(next_state, basic_next_state, handles.rotation,
+                              "rotation.base", next.rotations[idx],
+                              &IDrivingAgentState::set_rotation_variable);
+        commit_constant_value(next_state, basic_next_state, handles.linear_acceleration,
+                              "linear_acceleration.base", next.get_linear_acceleration(idx),
+                              &IDrivingAgentState::set_linear_acceleration_variable);
+        commit_constant_value(next_state, basic_next_state, handles.linear_velocity,
+                              "linear_velocity.base", next.get_linear_velocity(idx),
+                              &IDrivingAgentState::set_linear_velocity_variable);
+        commit_constant_value(next_state, basic_next_state, handles.aligned_linear_velocity,
+                              "aligned_linear_velocity.base", next.aligned_linear_velocities[idx],
+                              &IDrivingAgentState::set_aligned_linear_velocity_variable);
+        commit_constant_value(next_state, basic_next_state, handles.position,
+                              "position.base", next.get_position(idx),
+                              &IDrivingAgentState::set_position_variable);
+    }
+}
+
+void DrivingSceneStateBuffer::commit_next_collision_state(size_t idx) const
+{
+    IDrivingAgentState *next_state = next_states[idx];
+    ViewDrivingAgentState *view_next_state = dynamic_cast<ViewDrivingAgentState*>(next_state);
+
+    if (view_next_state != nullptr)
+    {
+        IDrivingAgent *driving_agent = view_next_state->get_mutable_agent();
+        temporal::Time time = view_next_state->get_time();
+
+        driving_agent->get_mutable_cumilative_collision_time_variable()->set_value(
+                    time, next.cumilative_collision_times[idx]);
+        driving_agent->get_mutable_ttc_variable()->set_value(time, next.ttcs[idx]);
+    }
+    else
+    {
+        DrivingAgentParameterHandles const &handles =
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles();
+        BasicDrivingAgentState *basic_next_state = dynamic_cast<BasicDrivingAgentState*>(next_state);
+
+        commit_constant_value(next_state, basic_next_state, handles.cumilative_collision_time,
+                              "cumilative_collision_time.base", next.cumilative_collision_times[idx],
+                              &IDrivingAgentState::set_cumilative_collision_time_variable);
+        commit_constant_value(next_state, basic_next_state, handles.ttc,
+                              "ttc.base", next.ttcs[idx],
+                              &IDrivingAgentState::set_ttc_variable);
+    }
+}
+
+}
+}
+}
@@ -67,67 +67,67 @@ DrivingSimulationAgent::DrivingSimulationAgent(IDrivingAgent *driving_agent,
     this->simulation_end_time = simulation_end_time;
 
 
-    IVariable<geometry::Vec> *position_variable = driving_agent->get_mutable_position_variable();
+    IVariable<geometry::Vec> const *position_variable = driving_agent->get_position_variable();
     this->position_variable =
                 new BasicSimulatedVariable(position_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<geometry::Vec> *linear_velocity_variable =
-            driving_agent->get_mutable_linear_velocity_variable();
+    IVariable<geometry::Vec> const *linear_velocity_variable =
+            driving_agent->get_linear_velocity_variable();
     this->linear_velocity_variable =
                 new BasicSimulatedVariable(linear_velocity_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<FP_DATA_TYPE> *aligned_linear_velocity_variable =
-            driving_agent->get_mutable_aligned_linear_velocity_variable();
+    IVariable<FP_DATA_TYPE> const *aligned_linear_velocity_variable =
+            driving_agent->get_aligned_linear_velocity_variable();
     this->aligned_linear_velocity_variable =
                 new BasicSimulatedVariable(aligned_linear_velocity_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<geometry::Vec> *linear_acceleration_variable =
-            driving_agent->get_mutable_linear_acceleration_variable();
+    IVariable<geometry::Vec> const *linear_acceleration_variable =
+            driving_agent->get_linear_acceleration_variable();
     this->linear_acceleration_variable =
                 new BasicSimulatedVariable(linear_acceleration_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<FP_DATA_TYPE> *aligned_linear_acceleration_variable =
-            driving_agent->get_mutable_aligned_linear_acceleration_variable();
+    IVariable<FP_DATA_TYPE> const *aligned_linear_acceleration_variable =
+            driving_agent->get_aligned_linear_acceleration_variable();
     this->aligned_linear_acceleration_variable =
                 new BasicSimulatedVariable(aligned_linear_acceleration_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<geometry::Vec> *external_linear_acceleration_variable =
-            driving_agent->get_mutable_external_linear_acceleration_variable();
+    IVariable<geometry::Vec> const *external_linear_acceleration_variable =
+            driving_agent->get_external_linear_acceleration_variable();
     this->external_linear_acceleration_variable =
                 new BasicSimulatedVariable(external_linear_acceleration_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<FP_DATA_TYPE> *rotation_variable =
-            driving_agent->get_mutable_rotation_variable();
+    IVariable<FP_DATA_TYPE> const *rotation_variable =
+            driving_agent->get_rotation_variable();
     this->rotation_variable =
                 new BasicSimulatedVariable(rotation_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<FP_DATA_TYPE> *steer_variable =
-            driving_agent->get_mutable_steer_variable();
+    IVariable<FP_DATA_TYPE> const *steer_variable =
+            driving_agent->get_steer_variable();
     this->steer_variable =
                 new BasicSimulatedVariable(steer_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<FP_DATA_TYPE> *angular_velocity_variable =
-            driving_agent->get_mutable_angular_velocity_variable();
+    IVariable<FP_DATA_TYPE> const *angular_velocity_variable =
+            driving_agent->get_angular_velocity_variable();
     this->angular_velocity_variable =
                 new BasicSimulatedVariable(angular_velocity_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<temporal::Duration> *ttc_variable =
-            driving_agent->get_mutable_ttc_variable();
+    IVariable<temporal::Duration> const *ttc_variable =
+            driving_agent->get_ttc_variable();
     this->ttc_variable =
                 new BasicSimulatedVariable(ttc_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
 
-    IVariable<temporal::Duration> *cumilative_collision_time_variable =
-            driving_agent->get_mutable_cumilative_collision_time_variable();
+    IVariable<temporal::Duration> const *cumilative_collision_time_variable =
+            driving_agent->get_cumilative_collision_time_variable();
     this->cumilative_collision_time_variable =
                 new BasicSimulatedVariable(cumilative_collision_time_variable, simulation_scene, simulation_start_time,
                                       simulation_end_time, start_simulated, simulation_scene->get_time_step());
@@ -194,6 +194,11 @@ IValuelessConstant const* DrivingSimulationAgent::get_constant_parameter(std::st
     return driving_agent->get_constant_parameter(constant_name);
 }
 
+IValuelessConstant const* DrivingSimulationAgent::get_constant_parameter(ParameterHandle constant_handle) const
+{
+    return driving_agent->get_constant_parameter(constant_handle);
+}
+
 structures::IArray<IValuelessVariable const*>* DrivingSimulationAgent::get_variable_parameters() const
 {
     structures::stl::STLConcatArray<IValuelessVariable const*> *variables =
@@ -302,6 +307,19 @@ IValuelessVariable const* DrivingSimulationAgent::get_variable_parameter(std::st
     }
 }
 
+IValuelessVariable const* DrivingSimulationAgent::get_variable_parameter(ParameterHandle variable_handle) const
+{
+    IValuelessVariable const *variable = ADrivingAgent::get_variable_parameter(variable_handle);
+    if (variable != nullptr)
+    {
+        return variable;
+    }
+    else
+    {
+        return driving_agent->get_variable_parameter(variable_handle);
+    }
+}
+
 structures::IArray<IValuelessEvent const*>* DrivingSimulationAgent::get_events() const
 {
     structures::stl::STLConcatArray<IValuelessEvent const*> *events =
@@ -475,6 +493,11 @@ IValuelessConstant* DrivingSimulationAgent::get_mutable_constant_parameter(std::
     return driving_agent->get_mutable_constant_parameter(constant_name);
 }
 
+IValuelessConstant* DrivingSimulationAgent::get_mutable_constant_parameter(ParameterHandle constant_handle)
+{
+    return driving_agent->get_mutable_constant_parameter(constant_handle);
+}
+
 structures::IArray<IValuelessVariable*>* DrivingSimulationAgent::get_mutable_variable_parameters()
 {
     structures::stl::STLConcatArray<IValuelessVariable*> *variables =
@@ -583,6 +606,19 @@ IValuelessVariable* DrivingSimulationAgent::get_mutable_variable_parameter(std::
     }
 }
 
+IValuelessVariable* DrivingSimulationAgent::get_mutable_variable_parameter(ParameterHandle variable_handle)
+{
+    IValuelessVariable *variable = ADrivingAgent::get_mutable_variable_parameter(variable_handle);
+    if (variable != nullptr)
+    {
+        return variable;
+    }
+    else
+    {
+        return driving_agent->get_mutable_variable_parameter(variable_handle);
+    }
+}
+
 structures::IArray<IValuelessEvent*>* DrivingSimulationAgent::get_mutable_events()
 {
     structures::stl::STLConcatArray<IValuelessEvent*> *events =
@@ -0,0 +1,107 @@
+
+#include <ori/simcars/agent/driving_simulation_batch_runner.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+float DrivingSimulationBatchResult::get_real_time_factor() const
+{
+    return float(std::chrono::duration_cast<std::chrono::microseconds>(simulated_time).count()) /
+            float(wall_time.count());
+}
+
+
+DrivingSimulationBatchRunner::DrivingSimulationBatchRunner(size_t thread_count)
+    : thread_pool(new utils::WorkStealingThreadPool(thread_count)) {}
+
+DrivingSimulationBatchRunner::~DrivingSimulationBatchRunner()
+{
+    delete thread_pool;
+}
+
+size_t DrivingSimulationBatchRunner::get_thread_count() const
+{
+    return thread_pool->get_thread_count();
+}
+
+DrivingSimulationBatchResult DrivingSimulationBatchRunner::run(
+        structures::IArray<IDrivingSimulationScene*> *simulation_scenes,
+        temporal::Time simulation_start_time, temporal::Time simulation_end_time) const
+{
+    DrivingSimulationBatchResult result;
+    result.scene_wall_times.resize(simulation_scenes->count());
+    result.simulated_time = (simulation_end_time - simulation_start_time) *
+            temporal::DurationRep(simulation_scenes->count());
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start_time =
+            std::chrono::high_resolution_clock::now();
+
+    size_t i;
+    for (i = 0; i < simulation_scenes->count(); ++i)
+    {
+        thread_pool->submit([simulation_scenes, simulation_end_time, &result, i]()
+        {
+            std::chrono::time_point<std::chrono::high_resolution_clock> scene_start_time =
+                    std::chrono::high_resolution_clock::now();
+
+            (*simulation_scenes)[i]->simulate(simulation_end_time);
+
+            result.scene_wall_times[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::high_resolution_clock::now() - scene_start_time);
+        });
+    }
+
+    thread_pool->wait();
+
+    result.wall_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start_time);
+
+    return result;
+}
+
+DrivingSimulationBatchResult DrivingSimulationBatchRunner::run(
+        std::vector<DrivingSimulationSceneBuilder> const &simulation_scene_builders,
+        structures::IArray<IDrivingSimulationScene*> *simulation_scenes,
+        temporal::Time simulation_start_time, temporal::Time simulation_end_time) const
+{
+    DrivingSimulationBatchResult result;
+    result.scene_wall_times.resize(simulation_scene_builders.size());
+    result.simulated_time = (simulation_end_time - simulation_start_time) *
+            temporal::DurationRep(simulation_scene_builders.size());
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start_time =
+            std::chrono::high_resolution_clock::now();
+
+    size_t i;
+    for (i = 0; i < simulation_scene_builders.size(); ++i)
+    {
+        thread_pool->submit([&simulation_scene_builders, simulation_scenes, simulation_end_time,
+                            &result, i]()
+        {
+            std::chrono::time_point<std::chrono::high_resolution_clock> scene_start_time =
+                    std::chrono::high_resolution_clock::now();
+
+            IDrivingSimulationScene *simulation_scene = simulation_scene_builders[i]();
+            (*simulation_scenes)[i] = simulation_scene;
+            simulation_scene->simulate(simulation_end_time);
+
+            result.scene_wall_times[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::high_resolution_clock::now() - scene_start_time);
+        });
+    }
+
+    thread_pool->wait();
+
+    result.wall_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start_time);
+
+    return result;
+}
+
+}
+}
+}
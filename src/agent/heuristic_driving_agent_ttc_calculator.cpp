@@ -0,0 +1,73 @@
+
+#include <ori/simcars/agent/heuristic_driving_agent_ttc_calculator.hpp>
+
+#include <cmath>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+temporal::Duration HeuristicDrivingAgentTTCCalculator::calc_smallest_buffered_ttc(
+        DrivingSceneStateBuffer const *state_buffer, size_t idx,
+        structures::IArray<size_t> const *candidate_indices, temporal::Duration ttc_limit) const
+{
+    DrivingAgentStateColumns const &next = state_buffer->next;
+
+    geometry::Vec position_1 = next.get_position(idx);
+    geometry::Vec velocity_1 = next.get_linear_velocity(idx);
+    FP_DATA_TYPE width_1 = state_buffer->bb_widths[idx];
+    geometry::OBox const &o_box_1 = state_buffer->bounding_boxes[idx];
+
+    temporal::Duration smallest_ttc = ttc_limit;
+
+    size_t i;
+    for (i = 0; i < candidate_indices->count(); ++i)
+    {
+        size_t j = (*candidate_indices)[i];
+
+        geometry::Vec position_diff = next.get_position(j) - position_1;
+        geometry::Vec velocity_diff = velocity_1 - next.get_linear_velocity(j);
+
+        // Agents that are not closing in cannot pass the cone test
+        if (j == idx || position_diff.dot(velocity_diff) <= 0.0f)
+        {
+            continue;
+        }
+
+        geometry::OBox const &o_box_2 = state_buffer->bounding_boxes[j];
+
+        FP_DATA_TYPE position_diff_norm = position_diff.norm();
+        FP_DATA_TYPE velocity_diff_norm = velocity_diff.norm();
+
+        // Cosine and sine of the rotation of the second agent relative to the first
+        FP_DATA_TYPE cos_rotation_diff = o_box_2.cos_orientation * o_box_1.cos_orientation +
+                o_box_2.sin_orientation * o_box_1.sin_orientation;
+        FP_DATA_TYPE sin_rotation_diff = o_box_2.sin_orientation * o_box_1.cos_orientation -
+                o_box_2.cos_orientation * o_box_1.sin_orientation;
+        FP_DATA_TYPE span_1 = width_1;
+        FP_DATA_TYPE span_2 = width_1 * std::abs(cos_rotation_diff) +
+                2.0f * o_box_2.half_width * std::abs(sin_rotation_diff);
+        FP_DATA_TYPE combined_span = 0.5f * (span_1 + span_2);
+
+        FP_DATA_TYPE dot_product_limit =
+                1.0f / std::sqrt((combined_span / position_diff_norm) * (combined_span / position_diff_norm) + 1.0f);
+        FP_DATA_TYPE dot_product =
+                position_diff.dot(velocity_diff) /
+                (position_diff_norm * velocity_diff_norm);
+
+        if (dot_product >= dot_product_limit)
+        {
+            temporal::Duration ttc(int64_t(position_diff_norm / (velocity_diff_norm * dot_product)));
+            smallest_ttc = std::min(ttc, smallest_ttc);
+        }
+    }
+
+    return smallest_ttc;
+}
+
+}
+}
+}
@@ -22,7 +22,7 @@ HighDDrivingAgent::HighDDrivingAgent() {}
 HighDDrivingAgent::HighDDrivingAgent(IDrivingScene const *driving_scene,
                                      size_t tracks_meta_row,
                                      const rapidcsv::Document &tracks_meta_csv_document,
-                                     const rapidcsv::Document &tracks_csv_document)
+                                     HighDTracks const &tracks)
     : driving_scene(driving_scene)
 {
     size_t const start_frame = tracks_meta_csv_document.GetCell<size_t>("initialFrame", tracks_meta_row);
@@ -97,29 +97,44 @@ HighDDrivingAgent::HighDDrivingAgent(IDrivingScene const *driving_scene,
 
     geometry::TrigBuff const *trig_buff = geometry::TrigBuff::get_instance();
 
-    size_t i;
+    size_t tracks_start_row, tracks_end_row;
+    if (!tracks.get_rows(id, tracks_start_row, tracks_end_row))
+    {
+        throw std::runtime_error("Could not find agent id specified in tracks meta file in tracks file");
+    }
+    if (tracks_end_row - tracks_start_row != end_frame - start_frame + 1)
+    {
+        throw std::runtime_error("Number of rows for agent id in tracks file does not match frames specified in tracks meta file");
+    }
 
-    for (i = 0; i < tracks_csv_document.GetRowCount(); ++i)
+    // WARNING: This makes a rather big assumption that the vehicles are always driving parallel to the lanes, mainly
+    // because the dataset doesn't actually provide any orientation information
+    FP_DATA_TYPE rotation;
+    uint32_t driving_direction = tracks_meta_csv_document.GetCell<uint32_t>("drivingDirection", tracks_meta_row);
+    if (driving_direction == 1)
     {
-        if (tracks_csv_document.GetCell<uint32_t>("id", i) == id)
-        {
-            break;
-        }
+        rotation = -M_PI;
     }
-    if (i == tracks_csv_document.GetRowCount())
+    else if (driving_direction == 2)
     {
-        throw std::runtime_error("Could not find agent id specified in tracks meta file in tracks file");
+        rotation = 0.0f;
     }
+    else
+    {
+        throw std::runtime_error("Unrecognised driving direction");
+    }
+
+    geometry::RotMat const rot_mat = trig_buff->get_rot_mat(rotation);
+    geometry::RotMat const inverse_rot_mat = trig_buff->get_rot_mat(-rotation);
 
-    size_t const tracks_start_row = i;
-    size_t const tracks_end_row = tracks_start_row + (end_frame - start_frame);
-    for (i = tracks_start_row; i <= tracks_end_row; ++i)
+    size_t i;
+    for (i = tracks_start_row; i < tracks_end_row; ++i)
     {
         temporal::Time timestamp = this->min_temporal_limit + temporal::Duration((i - tracks_start_row) * 40);
         assert(timestamp <= this->max_temporal_limit);
 
-        FP_DATA_TYPE const position_x = tracks_csv_document.GetCell<FP_DATA_TYPE>("x", i) + bb_length / 2.0f;
-        FP_DATA_TYPE const position_y = tracks_csv_document.GetCell<FP_DATA_TYPE>("y", i) + bb_width / 2.0f;
+        FP_DATA_TYPE const position_x = tracks.get_position_x(i) + bb_length / 2.0f;
+        FP_DATA_TYPE const position_y = tracks.get_position_y(i) + bb_width / 2.0f;
         min_position_x = std::min(position_x, min_position_x);
         max_position_x = std::max(position_x, max_position_x);
         min_position_y = std::min(position_y, min_position_y);
@@ -127,39 +142,23 @@ HighDDrivingAgent::HighDDrivingAgent(IDrivingScene const *driving_scene,
         geometry::Vec const position(position_x, position_y);
         position_variable->set_value(timestamp, position);
 
-        geometry::Vec const linear_velocity = geometry::Vec(tracks_csv_document.GetCell<FP_DATA_TYPE>("xVelocity", i),
-                                                            tracks_csv_document.GetCell<FP_DATA_TYPE>("yVelocity", i)) * 1e-3f;
+        geometry::Vec const linear_velocity = geometry::Vec(tracks.get_linear_velocity_x(i),
+                                                            tracks.get_linear_velocity_y(i)) * 1e-3f;
         linear_velocity_variable->set_value(timestamp, linear_velocity);
 
-        geometry::Vec const linear_acceleration = geometry::Vec(tracks_csv_document.GetCell<FP_DATA_TYPE>("xAcceleration", i),
-                                                                tracks_csv_document.GetCell<FP_DATA_TYPE>("yAcceleration", i)) * 1e-6f;
+        geometry::Vec const linear_acceleration = geometry::Vec(tracks.get_linear_acceleration_x(i),
+                                                                tracks.get_linear_acceleration_y(i)) * 1e-6f;
         linear_acceleration_variable->set_value(timestamp, linear_acceleration);
 
-        // WARNING: This makes a rather big assumption that the vehicles are always driving parallel to the lanes, mainly
-        // because the dataset doesn't actually provide any orientation information
-        FP_DATA_TYPE rotation;
-        uint32_t driving_direction = tracks_meta_csv_document.GetCell<uint32_t>("drivingDirection", tracks_meta_row);
-        if (driving_direction == 1)
-        {
-            rotation = -M_PI;
-        }
-        else if (driving_direction == 2)
-        {
-            rotation = 0.0f;
-        }
-        else
-        {
-            throw std::runtime_error("Unrecognised driving direction");
-        }
         rotation_variable->set_value(timestamp, rotation);
 
-        FP_DATA_TYPE const aligned_linear_velocity = (trig_buff->get_rot_mat(-rotation) * linear_velocity).x();
+        FP_DATA_TYPE const aligned_linear_velocity = (inverse_rot_mat * linear_velocity).x();
         aligned_linear_velocity_variable->set_value(timestamp, aligned_linear_velocity);
 
-        FP_DATA_TYPE const aligned_linear_acceleration = (trig_buff->get_rot_mat(-rotation) * linear_acceleration).x();
+        FP_DATA_TYPE const aligned_linear_acceleration = (inverse_rot_mat * linear_acceleration).x();
         aligned_linear_acceleration_variable->set_value(timestamp, aligned_linear_acceleration);
 
-        geometry::Vec const external_linear_acceleration = linear_acceleration - (trig_buff->get_rot_mat(rotation) * geometry::Vec(aligned_linear_acceleration, 0));
+        geometry::Vec const external_linear_acceleration = linear_acceleration - (rot_mat * geometry::Vec(aligned_linear_acceleration, 0));
         external_linear_acceleration_variable->set_value(timestamp, external_linear_acceleration);
 
         // WARNING: Again, assuming no angular velocity due to lack of orientation information
@@ -169,7 +168,7 @@ HighDDrivingAgent::HighDDrivingAgent(IDrivingScene const *driving_scene,
         FP_DATA_TYPE const steer = angular_velocity / aligned_linear_velocity;
         steer_variable->set_value(timestamp, steer);
 
-        FP_DATA_TYPE const ttc_raw = tracks_csv_document.GetCell<FP_DATA_TYPE>("ttc", i);
+        FP_DATA_TYPE const ttc_raw = tracks.get_ttc(i);
         temporal::Duration ttc;
         if (ttc_raw > 0.0f)
         {
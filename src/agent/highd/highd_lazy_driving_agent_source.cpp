@@ -0,0 +1,127 @@
+
+#include <ori/simcars/agent/highd/highd_lazy_driving_agent_source.hpp>
+#include <ori/simcars/agent/highd/highd_driving_agent.hpp>
+
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace highd
+{
+
+HighDLazyDrivingAgentSource::HighDLazyDrivingAgentSource(std::ifstream &input_filestream_1,
+                                                         std::ifstream &input_filestream_2,
+                                                         structures::ISet<std::string>* agent_names)
+    : tracks_meta_csv_document(input_filestream_1), tracks(rapidcsv::Document(input_filestream_2))
+{
+    for (size_t i = 0; i < tracks_meta_csv_document.GetRowCount(); ++i)
+    {
+        uint32_t const id = tracks_meta_csv_document.GetCell<uint32_t>("id", i);
+        bool const ego = false;
+
+        std::string agent_name = (ego ? "ego_vehicle_" : "non_ego_vehicle_") + std::to_string(id);
+
+        if (agent_names != nullptr && !agent_names->contains(agent_name))
+        {
+            continue;
+        }
+
+        size_t const start_frame = tracks_meta_csv_document.GetCell<size_t>("initialFrame", i);
+        size_t const end_frame = tracks_meta_csv_document.GetCell<size_t>("finalFrame", i);
+
+        FP_DATA_TYPE const bb_length = tracks_meta_csv_document.GetCell<FP_DATA_TYPE>("width", i);
+        FP_DATA_TYPE const bb_width = tracks_meta_csv_document.GetCell<FP_DATA_TYPE>("height", i);
+
+        size_t tracks_start_row, tracks_end_row;
+        if (!tracks.get_rows(id, tracks_start_row, tracks_end_row))
+        {
+            throw std::runtime_error("Could not find agent id specified in tracks meta file in tracks file");
+        }
+
+        // Spatial limits are worked out the same way as HighDDrivingAgent does, without building any variables
+        FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+        FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+        FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+        FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+
+        for (size_t j = tracks_start_row; j < tracks_end_row; ++j)
+        {
+            FP_DATA_TYPE const position_x = tracks.get_position_x(j) + bb_length / 2.0f;
+            FP_DATA_TYPE const position_y = tracks.get_position_y(j) + bb_width / 2.0f;
+            min_position_x = std::min(position_x, min_position_x);
+            max_position_x = std::max(position_x, max_position_x);
+            min_position_y = std::min(position_y, min_position_y);
+            max_position_y = std::max(position_y, max_position_y);
+        }
+
+        LazyDrivingAgentEntry driving_agent_entry;
+        driving_agent_entry.name = agent_name;
+        driving_agent_entry.min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
+        driving_agent_entry.max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+        driving_agent_entry.min_temporal_limit = temporal::Time(temporal::Duration(start_frame * 40));
+        driving_agent_entry.max_temporal_limit = temporal::Time(temporal::Duration(end_frame * 40));
+        driving_agent_entry.frame_count = tracks_end_row - tracks_start_row;
+
+        tracks_meta_rows.push_back(i);
+        driving_agent_entries.push_back(driving_agent_entry);
+    }
+}
+
+std::shared_ptr<HighDLazyDrivingAgentSource const> HighDLazyDrivingAgentSource::load(
+        std::string const &input_file_1_path_str, std::string const &input_file_2_path_str,
+        structures::ISet<std::string>* agent_names)
+{
+    std::filesystem::path input_file_1_path(input_file_1_path_str);
+
+    if (!std::filesystem::is_regular_file(input_file_1_path))
+    {
+        throw std::invalid_argument("Input file 1 path '" + input_file_1_path_str + "' does not indicate a valid file");
+    }
+
+    std::ifstream input_filestream_1(input_file_1_path, std::ios_base::binary);
+
+    std::filesystem::path input_file_2_path(input_file_2_path_str);
+
+    if (!std::filesystem::is_regular_file(input_file_2_path))
+    {
+        throw std::invalid_argument("Input file 2 path '" + input_file_2_path_str + "' does not indicate a valid file");
+    }
+
+    std::ifstream input_filestream_2(input_file_2_path, std::ios_base::binary);
+
+    return std::shared_ptr<HighDLazyDrivingAgentSource const>(
+                new HighDLazyDrivingAgentSource(input_filestream_1, input_filestream_2, agent_names));
+}
+
+temporal::Duration HighDLazyDrivingAgentSource::get_time_step() const
+{
+    return temporal::Duration(40);
+}
+
+size_t HighDLazyDrivingAgentSource::get_driving_agent_count() const
+{
+    return driving_agent_entries.size();
+}
+
+LazyDrivingAgentEntry const& HighDLazyDrivingAgentSource::get_driving_agent_entry(size_t driving_agent_idx) const
+{
+    return driving_agent_entries[driving_agent_idx];
+}
+
+IDrivingAgent* HighDLazyDrivingAgentSource::load_driving_agent(IDrivingScene const *driving_scene,
+                                                               size_t driving_agent_idx) const
+{
+    return new HighDDrivingAgent(driving_scene, tracks_meta_rows[driving_agent_idx], tracks_meta_csv_document,
+                                 tracks);
+}
+
+}
+}
+}
+}
@@ -2,6 +2,9 @@
 #include <ori/simcars/utils/exceptions.hpp>
 #include <ori/simcars/agent/highd/highd_scene.hpp>
 
+#include <vector>
+#include <chrono>
+
 namespace ori
 {
 namespace simcars
@@ -73,21 +76,18 @@ void HighDScene::save_virt(std::ofstream &output_filestream_1, std::ofstream &ou
 }
 
 void HighDScene::load_virt(std::ifstream &input_filestream_1, std::ifstream &input_filestream_2,
-                           structures::ISet<std::string>* agent_names)
+                           structures::ISet<std::string>* agent_names,
+                           utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings)
 {
+    std::chrono::time_point<std::chrono::high_resolution_clock> stage_start_time =
+            std::chrono::high_resolution_clock::now();
+
     rapidcsv::Document tracks_meta_csv_document(input_filestream_1);
     rapidcsv::Document tracks_csv_document(input_filestream_2);
 
-    this->time_step = temporal::Duration(40);
-
-    this->min_temporal_limit = temporal::Time::max();
-    this->max_temporal_limit = temporal::Time::min();
-
-    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
-    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+    HighDTracks const tracks(tracks_csv_document);
 
+    std::vector<size_t> tracks_meta_rows;
     for (size_t i = 0; i < tracks_meta_csv_document.GetRowCount(); ++i)
     {
         uint32_t const id = tracks_meta_csv_document.GetCell<uint32_t>("id", i);
@@ -100,10 +100,85 @@ void HighDScene::load_virt(std::ifstream &input_filestream_1, std::ifstream &inp
             continue;
         }
 
-        HighDDrivingAgent *driving_agent =
-                new HighDDrivingAgent(this, i, tracks_meta_csv_document,
-                                      tracks_csv_document);
+        tracks_meta_rows.push_back(i);
+    }
+
+    if (load_timings != nullptr)
+    {
+        load_timings->parse_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
+    stage_start_time = std::chrono::high_resolution_clock::now();
+
+    // Agents size their variables by the time step as they are constructed
+    this->time_step = temporal::Duration(40);
+
+    // Agents are constructed into slots ordered as in the file, so the scene does not depend on the order in which
+    // worker threads finish
+    std::vector<HighDDrivingAgent*> driving_agents(tracks_meta_rows.size(), nullptr);
+
+    try
+    {
+        for (size_t i = 0; i < tracks_meta_rows.size(); ++i)
+        {
+            auto construct_driving_agent = [this, &tracks_meta_rows, &tracks_meta_csv_document, &tracks,
+                                           &driving_agents, i]()
+            {
+                driving_agents[i] = new HighDDrivingAgent(this, tracks_meta_rows[i], tracks_meta_csv_document,
+                                                          tracks);
+            };
+
+            if (thread_pool != nullptr)
+            {
+                thread_pool->submit(construct_driving_agent);
+            }
+            else
+            {
+                construct_driving_agent();
+            }
+        }
+
+        if (thread_pool != nullptr)
+        {
+            thread_pool->wait();
+        }
+    }
+    catch (...)
+    {
+        if (thread_pool != nullptr)
+        {
+            // Tasks still in flight refer to the agent slots, so they have to finish before anything is released
+            try
+            {
+                thread_pool->wait();
+            }
+            catch (...) {}
+        }
+
+        for (HighDDrivingAgent *driving_agent : driving_agents)
+        {
+            delete driving_agent;
+        }
+        throw;
+    }
+
+    if (load_timings != nullptr)
+    {
+        load_timings->construction_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
+    stage_start_time = std::chrono::high_resolution_clock::now();
+
+    this->min_temporal_limit = temporal::Time::max();
+    this->max_temporal_limit = temporal::Time::min();
+
+    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
 
+    for (HighDDrivingAgent *driving_agent : driving_agents)
+    {
         driving_agent_dict.update(driving_agent->get_name(), driving_agent);
 
         this->min_temporal_limit = std::min(driving_agent->get_min_temporal_limit(), this->min_temporal_limit);
@@ -120,6 +195,12 @@ void HighDScene::load_virt(std::ifstream &input_filestream_1, std::ifstream &inp
 
     this->min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
     this->max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+
+    if (load_timings != nullptr)
+    {
+        load_timings->merge_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
 }
 
 geometry::Vec HighDScene::get_min_spatial_limits() const
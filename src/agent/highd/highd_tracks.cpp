@@ -0,0 +1,96 @@
+
+#include <ori/simcars/agent/highd/highd_tracks.hpp>
+
+#include <stdexcept>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+namespace highd
+{
+
+HighDTracks::HighDTracks(rapidcsv::Document const &tracks_csv_document)
+{
+    std::vector<uint32_t> const id_column = tracks_csv_document.GetColumn<uint32_t>("id");
+
+    position_x_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("x");
+    position_y_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("y");
+    linear_velocity_x_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("xVelocity");
+    linear_velocity_y_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("yVelocity");
+    linear_acceleration_x_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("xAcceleration");
+    linear_acceleration_y_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("yAcceleration");
+    ttc_column = tracks_csv_document.GetColumn<FP_DATA_TYPE>("ttc");
+
+    // Rows of the tracks file are grouped by agent id
+    size_t start_row = 0;
+    for (size_t i = 1; i <= id_column.size(); ++i)
+    {
+        if (i == id_column.size() || id_column[i] != id_column[start_row])
+        {
+            if (id_start_row_dict.contains(id_column[start_row]))
+            {
+                throw std::runtime_error("Rows of agent id " + std::to_string(id_column[start_row]) +
+                                         " are not contiguous in tracks file");
+            }
+
+            id_start_row_dict.update(id_column[start_row], start_row);
+            id_end_row_dict.update(id_column[start_row], i);
+            start_row = i;
+        }
+    }
+}
+
+bool HighDTracks::get_rows(uint32_t id, size_t &start_row, size_t &end_row) const
+{
+    if (!id_start_row_dict.contains(id))
+    {
+        return false;
+    }
+
+    start_row = id_start_row_dict[id];
+    end_row = id_end_row_dict[id];
+    return true;
+}
+
+FP_DATA_TYPE HighDTracks::get_position_x(size_t row) const
+{
+    return position_x_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_position_y(size_t row) const
+{
+    return position_y_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_linear_velocity_x(size_t row) const
+{
+    return linear_velocity_x_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_linear_velocity_y(size_t row) const
+{
+    return linear_velocity_y_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_linear_acceleration_x(size_t row) const
+{
+    return linear_acceleration_x_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_linear_acceleration_y(size_t row) const
+{
+    return linear_acceleration_y_column[row];
+}
+
+FP_DATA_TYPE HighDTracks::get_ttc(size_t row) const
+{
+    return ttc_column[row];
+}
+
+}
+}
+}
+}
@@ -0,0 +1,323 @@
+
+#include <ori/simcars/agent/lazy_driving_agent.hpp>
+#include <ori/simcars/agent/lazy_driving_scene.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+LazyDrivingAgent::LazyDrivingAgent(LazyDrivingScene const *driving_scene, size_t driving_agent_idx,
+                                   LazyDrivingAgentEntry const *driving_agent_entry)
+    : driving_scene(driving_scene), driving_agent_idx(driving_agent_idx), driving_agent_entry(driving_agent_entry) {}
+
+IDrivingAgent const* LazyDrivingAgent::get_materialised_driving_agent() const
+{
+    return driving_scene->materialise_driving_agent(driving_agent_idx, LazyDrivingScene::MaterialiseMode::HOLD);
+}
+
+IDrivingAgent* LazyDrivingAgent::get_mutable_materialised_driving_agent()
+{
+    return driving_scene->materialise_driving_agent(driving_agent_idx, LazyDrivingScene::MaterialiseMode::PIN);
+}
+
+IDrivingAgent const* LazyDrivingAgent::borrow() const
+{
+    return driving_scene->materialise_driving_agent(driving_agent_idx, LazyDrivingScene::MaterialiseMode::BORROW);
+}
+
+void LazyDrivingAgent::release() const
+{
+    driving_scene->release_driving_agent(driving_agent_idx);
+}
+
+bool LazyDrivingAgent::is_materialised() const
+{
+    return driving_scene->is_driving_agent_materialised(driving_agent_idx);
+}
+
+std::string LazyDrivingAgent::get_name() const
+{
+    return driving_agent_entry->name;
+}
+
+geometry::Vec LazyDrivingAgent::get_min_spatial_limits() const
+{
+    return driving_agent_entry->min_spatial_limits;
+}
+
+geometry::Vec LazyDrivingAgent::get_max_spatial_limits() const
+{
+    return driving_agent_entry->max_spatial_limits;
+}
+
+temporal::Time LazyDrivingAgent::get_min_temporal_limit() const
+{
+    return driving_agent_entry->min_temporal_limit;
+}
+
+temporal::Time LazyDrivingAgent::get_max_temporal_limit() const
+{
+    return driving_agent_entry->max_temporal_limit;
+}
+
+structures::IArray<IValuelessConstant const*>* LazyDrivingAgent::get_constant_parameters() const
+{
+    return get_materialised_driving_agent()->get_constant_parameters();
+}
+
+IValuelessConstant const* LazyDrivingAgent::get_constant_parameter(std::string const &constant_name) const
+{
+    return get_materialised_driving_agent()->get_constant_parameter(constant_name);
+}
+
+IValuelessConstant const* LazyDrivingAgent::get_constant_parameter(ParameterHandle constant_handle) const
+{
+    return get_materialised_driving_agent()->get_constant_parameter(constant_handle);
+}
+
+structures::IArray<IValuelessVariable const*>* LazyDrivingAgent::get_variable_parameters() const
+{
+    return get_materialised_driving_agent()->get_variable_parameters();
+}
+
+IValuelessVariable const* LazyDrivingAgent::get_variable_parameter(std::string const &variable_name) const
+{
+    return get_materialised_driving_agent()->get_variable_parameter(variable_name);
+}
+
+IValuelessVariable const* LazyDrivingAgent::get_variable_parameter(ParameterHandle variable_handle) const
+{
+    return get_materialised_driving_agent()->get_variable_parameter(variable_handle);
+}
+
+structures::IArray<IValuelessEvent const*>* LazyDrivingAgent::get_events() const
+{
+    return get_materialised_driving_agent()->get_events();
+}
+
+IDrivingAgent* LazyDrivingAgent::driving_agent_deep_copy(IDrivingScene *driving_scene) const
+{
+    return get_materialised_driving_agent()->driving_agent_deep_copy(driving_scene);
+}
+
+IDrivingScene const* LazyDrivingAgent::get_driving_scene() const
+{
+    return driving_scene;
+}
+
+IConstant<uint32_t> const* LazyDrivingAgent::get_id_constant() const
+{
+    return get_materialised_driving_agent()->get_id_constant();
+}
+
+IConstant<bool> const* LazyDrivingAgent::get_ego_constant() const
+{
+    return get_materialised_driving_agent()->get_ego_constant();
+}
+
+IConstant<FP_DATA_TYPE> const* LazyDrivingAgent::get_bb_length_constant() const
+{
+    return get_materialised_driving_agent()->get_bb_length_constant();
+}
+
+IConstant<FP_DATA_TYPE> const* LazyDrivingAgent::get_bb_width_constant() const
+{
+    return get_materialised_driving_agent()->get_bb_width_constant();
+}
+
+IConstant<DrivingAgentClass> const* LazyDrivingAgent::get_driving_agent_class_constant() const
+{
+    return get_materialised_driving_agent()->get_driving_agent_class_constant();
+}
+
+IVariable<geometry::Vec> const* LazyDrivingAgent::get_position_variable() const
+{
+    return get_materialised_driving_agent()->get_position_variable();
+}
+
+IVariable<geometry::Vec> const* LazyDrivingAgent::get_linear_velocity_variable() const
+{
+    return get_materialised_driving_agent()->get_linear_velocity_variable();
+}
+
+IVariable<FP_DATA_TYPE> const* LazyDrivingAgent::get_aligned_linear_velocity_variable() const
+{
+    return get_materialised_driving_agent()->get_aligned_linear_velocity_variable();
+}
+
+IVariable<geometry::Vec> const* LazyDrivingAgent::get_linear_acceleration_variable() const
+{
+    return get_materialised_driving_agent()->get_linear_acceleration_variable();
+}
+
+IVariable<FP_DATA_TYPE> const* LazyDrivingAgent::get_aligned_linear_acceleration_variable() const
+{
+    return get_materialised_driving_agent()->get_aligned_linear_acceleration_variable();
+}
+
+IVariable<geometry::Vec> const* LazyDrivingAgent::get_external_linear_acceleration_variable() const
+{
+    return get_materialised_driving_agent()->get_external_linear_acceleration_variable();
+}
+
+IVariable<FP_DATA_TYPE> const* LazyDrivingAgent::get_rotation_variable() const
+{
+    return get_materialised_driving_agent()->get_rotation_variable();
+}
+
+IVariable<FP_DATA_TYPE> const* LazyDrivingAgent::get_steer_variable() const
+{
+    return get_materialised_driving_agent()->get_steer_variable();
+}
+
+IVariable<FP_DATA_TYPE> const* LazyDrivingAgent::get_angular_velocity_variable() const
+{
+    return get_materialised_driving_agent()->get_angular_velocity_variable();
+}
+
+IVariable<temporal::Duration> const* LazyDrivingAgent::get_ttc_variable() const
+{
+    return get_materialised_driving_agent()->get_ttc_variable();
+}
+
+IVariable<temporal::Duration> const* LazyDrivingAgent::get_cumilative_collision_time_variable() const
+{
+    return get_materialised_driving_agent()->get_cumilative_collision_time_variable();
+}
+
+
+structures::IArray<IValuelessConstant*>* LazyDrivingAgent::get_mutable_constant_parameters()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_constant_parameters();
+}
+
+IValuelessConstant* LazyDrivingAgent::get_mutable_constant_parameter(std::string const &constant_name)
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_constant_parameter(constant_name);
+}
+
+IValuelessConstant* LazyDrivingAgent::get_mutable_constant_parameter(ParameterHandle constant_handle)
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_constant_parameter(constant_handle);
+}
+
+structures::IArray<IValuelessVariable*>* LazyDrivingAgent::get_mutable_variable_parameters()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_variable_parameters();
+}
+
+IValuelessVariable* LazyDrivingAgent::get_mutable_variable_parameter(std::string const &variable_name)
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_variable_parameter(variable_name);
+}
+
+IValuelessVariable* LazyDrivingAgent::get_mutable_variable_parameter(ParameterHandle variable_handle)
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_variable_parameter(variable_handle);
+}
+
+structures::IArray<IValuelessEvent*>* LazyDrivingAgent::get_mutable_events()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_events();
+}
+
+IConstant<uint32_t>* LazyDrivingAgent::get_mutable_id_constant()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_id_constant();
+}
+
+IConstant<bool>* LazyDrivingAgent::get_mutable_ego_constant()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_ego_constant();
+}
+
+IConstant<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_bb_length_constant()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_bb_length_constant();
+}
+
+IConstant<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_bb_width_constant()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_bb_width_constant();
+}
+
+IConstant<DrivingAgentClass>* LazyDrivingAgent::get_mutable_driving_agent_class_constant()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_driving_agent_class_constant();
+}
+
+IVariable<geometry::Vec>* LazyDrivingAgent::get_mutable_position_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_position_variable();
+}
+
+IVariable<geometry::Vec>* LazyDrivingAgent::get_mutable_linear_velocity_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_linear_velocity_variable();
+}
+
+IVariable<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_aligned_linear_velocity_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_aligned_linear_velocity_variable();
+}
+
+IVariable<geometry::Vec>* LazyDrivingAgent::get_mutable_linear_acceleration_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_linear_acceleration_variable();
+}
+
+IVariable<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_aligned_linear_acceleration_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_aligned_linear_acceleration_variable();
+}
+
+IVariable<geometry::Vec>* LazyDrivingAgent::get_mutable_external_linear_acceleration_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_external_linear_acceleration_variable();
+}
+
+IVariable<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_rotation_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_rotation_variable();
+}
+
+IVariable<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_steer_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_steer_variable();
+}
+
+IVariable<FP_DATA_TYPE>* LazyDrivingAgent::get_mutable_angular_velocity_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_angular_velocity_variable();
+}
+
+IVariable<temporal::Duration>* LazyDrivingAgent::get_mutable_ttc_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_ttc_variable();
+}
+
+IVariable<temporal::Duration>* LazyDrivingAgent::get_mutable_cumilative_collision_time_variable()
+{
+    return get_mutable_materialised_driving_agent()->get_mutable_cumilative_collision_time_variable();
+}
+
+
+LazyDrivingAgentBorrow::LazyDrivingAgentBorrow(LazyDrivingAgent const *driving_agent)
+    : driving_agent(driving_agent), materialised_driving_agent(driving_agent->borrow()) {}
+
+LazyDrivingAgentBorrow::~LazyDrivingAgentBorrow()
+{
+    driving_agent->release();
+}
+
+IDrivingAgent const* LazyDrivingAgentBorrow::get_driving_agent() const
+{
+    return materialised_driving_agent;
+}
+
+}
+}
+}
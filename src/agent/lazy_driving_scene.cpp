@@ -0,0 +1,313 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/agent/lazy_driving_scene.hpp>
+
+#include <limits>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+LazyDrivingScene::LazyDrivingScene(std::shared_ptr<ILazyDrivingAgentSource const> const &driving_agent_source,
+                                   size_t memory_budget)
+    : driving_agent_source(driving_agent_source), memory_budget(memory_budget),
+      driving_agent_dict(driving_agent_source->get_driving_agent_count()),
+      materialised_driving_agents(driving_agent_source->get_driving_agent_count(), nullptr),
+      pinned_driving_agents(driving_agent_source->get_driving_agent_count(), false),
+      held_driving_agents(driving_agent_source->get_driving_agent_count(), false),
+      driving_agent_borrow_counts(driving_agent_source->get_driving_agent_count(), 0),
+      materialised_size(0),
+      eviction_queue_itrs(driving_agent_source->get_driving_agent_count())
+{
+    this->min_temporal_limit = temporal::Time::max();
+    this->max_temporal_limit = temporal::Time::min();
+
+    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+
+    size_t i;
+    for (i = 0; i < driving_agent_source->get_driving_agent_count(); ++i)
+    {
+        LazyDrivingAgentEntry const &driving_agent_entry = driving_agent_source->get_driving_agent_entry(i);
+
+        LazyDrivingAgent *driving_agent = new LazyDrivingAgent(this, i, &driving_agent_entry);
+        driving_agents.push_back(driving_agent);
+        driving_agent_dict.update(driving_agent_entry.name, driving_agent);
+
+        this->min_temporal_limit = std::min(driving_agent_entry.min_temporal_limit, this->min_temporal_limit);
+        this->max_temporal_limit = std::max(driving_agent_entry.max_temporal_limit, this->max_temporal_limit);
+
+        min_position_x = std::min(driving_agent_entry.min_spatial_limits.x(), min_position_x);
+        min_position_y = std::min(driving_agent_entry.min_spatial_limits.y(), min_position_y);
+        max_position_x = std::max(driving_agent_entry.max_spatial_limits.x(), max_position_x);
+        max_position_y = std::max(driving_agent_entry.max_spatial_limits.y(), max_position_y);
+    }
+
+    this->min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
+    this->max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+}
+
+LazyDrivingScene::~LazyDrivingScene()
+{
+    size_t i;
+    for (i = 0; i < driving_agents.size(); ++i)
+    {
+        delete materialised_driving_agents[i];
+        delete driving_agents[i];
+    }
+}
+
+LazyDrivingScene* LazyDrivingScene::construct_from(
+        std::shared_ptr<ILazyDrivingAgentSource const> const &driving_agent_source, size_t memory_budget)
+{
+    return new LazyDrivingScene(driving_agent_source, memory_budget);
+}
+
+size_t LazyDrivingScene::get_driving_agent_size(size_t driving_agent_idx) const
+{
+    return driving_agent_source->get_driving_agent_entry(driving_agent_idx).frame_count *
+            LAZY_DRIVING_AGENT_BYTES_PER_FRAME;
+}
+
+bool LazyDrivingScene::is_driving_agent_evictable(size_t driving_agent_idx) const
+{
+    return !pinned_driving_agents[driving_agent_idx] && !held_driving_agents[driving_agent_idx] &&
+            driving_agent_borrow_counts[driving_agent_idx] == 0;
+}
+
+void LazyDrivingScene::mark_driving_agent(size_t driving_agent_idx, MaterialiseMode mode) const
+{
+    switch (mode)
+    {
+    case MaterialiseMode::BORROW:
+        ++driving_agent_borrow_counts[driving_agent_idx];
+        break;
+
+    case MaterialiseMode::HOLD:
+        held_driving_agents[driving_agent_idx] = true;
+        break;
+
+    case MaterialiseMode::PIN:
+        pinned_driving_agents[driving_agent_idx] = true;
+        break;
+    }
+}
+
+IDrivingAgent* LazyDrivingScene::materialise_driving_agent(size_t driving_agent_idx, MaterialiseMode mode) const
+{
+    {
+        std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+        IDrivingAgent *driving_agent = materialised_driving_agents[driving_agent_idx];
+
+        if (driving_agent != nullptr)
+        {
+            if (is_driving_agent_evictable(driving_agent_idx))
+            {
+                eviction_queue.erase(eviction_queue_itrs[driving_agent_idx]);
+            }
+            mark_driving_agent(driving_agent_idx, mode);
+
+            return driving_agent;
+        }
+    }
+
+    // Decoding is by far the slowest part, so it is done without holding up accesses to other agents, at the cost of
+    // occasionally decoding an agent twice when several threads first access it at once
+    IDrivingAgent *loaded_driving_agent = driving_agent_source->load_driving_agent(this, driving_agent_idx);
+
+    IDrivingAgent *driving_agent;
+    std::vector<IDrivingAgent*> evicted_driving_agents;
+
+    {
+        std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+        driving_agent = materialised_driving_agents[driving_agent_idx];
+
+        if (driving_agent == nullptr)
+        {
+            size_t const driving_agent_size = get_driving_agent_size(driving_agent_idx);
+
+            if (memory_budget != 0)
+            {
+                while (!eviction_queue.empty() && materialised_size + driving_agent_size > memory_budget)
+                {
+                    size_t const evicted_driving_agent_idx = eviction_queue.front();
+                    eviction_queue.pop_front();
+
+                    evicted_driving_agents.push_back(materialised_driving_agents[evicted_driving_agent_idx]);
+                    materialised_driving_agents[evicted_driving_agent_idx] = nullptr;
+                    materialised_size -= get_driving_agent_size(evicted_driving_agent_idx);
+                }
+            }
+
+            driving_agent = loaded_driving_agent;
+            loaded_driving_agent = nullptr;
+            materialised_driving_agents[driving_agent_idx] = driving_agent;
+            materialised_size += driving_agent_size;
+        }
+        else if (is_driving_agent_evictable(driving_agent_idx))
+        {
+            eviction_queue.erase(eviction_queue_itrs[driving_agent_idx]);
+        }
+
+        mark_driving_agent(driving_agent_idx, mode);
+    }
+
+    // Neither the agent decoded by a thread that lost the race nor evicted agents are reachable any longer
+    delete loaded_driving_agent;
+    for (IDrivingAgent *evicted_driving_agent : evicted_driving_agents)
+    {
+        delete evicted_driving_agent;
+    }
+
+    return driving_agent;
+}
+
+void LazyDrivingScene::release_driving_agent(size_t driving_agent_idx) const
+{
+    std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+    --driving_agent_borrow_counts[driving_agent_idx];
+
+    if (is_driving_agent_evictable(driving_agent_idx))
+    {
+        eviction_queue_itrs[driving_agent_idx] = eviction_queue.insert(eviction_queue.end(), driving_agent_idx);
+    }
+}
+
+bool LazyDrivingScene::is_driving_agent_materialised(size_t driving_agent_idx) const
+{
+    std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+    return materialised_driving_agents[driving_agent_idx] != nullptr;
+}
+
+std::shared_ptr<ILazyDrivingAgentSource const> LazyDrivingScene::get_driving_agent_source() const
+{
+    return driving_agent_source;
+}
+
+size_t LazyDrivingScene::get_memory_budget() const
+{
+    return memory_budget;
+}
+
+size_t LazyDrivingScene::get_materialised_size() const
+{
+    std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+    return materialised_size;
+}
+
+size_t LazyDrivingScene::get_materialised_driving_agent_count() const
+{
+    std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+    size_t materialised_driving_agent_count = 0;
+
+    size_t i;
+    for (i = 0; i < materialised_driving_agents.size(); ++i)
+    {
+        if (materialised_driving_agents[i] != nullptr)
+        {
+            ++materialised_driving_agent_count;
+        }
+    }
+
+    return materialised_driving_agent_count;
+}
+
+IDrivingScene* LazyDrivingScene::driving_scene_deep_copy() const
+{
+    LazyDrivingScene *new_driving_scene = new LazyDrivingScene(driving_agent_source, memory_budget);
+
+    std::lock_guard<std::mutex> materialised_driving_agents_lock(materialised_driving_agents_mutex);
+
+    // Pinned agents may have been modified, so they cannot simply be decoded again
+    size_t i;
+    for (i = 0; i < driving_agents.size(); ++i)
+    {
+        if (pinned_driving_agents[i])
+        {
+            new_driving_scene->materialised_driving_agents[i] =
+                    materialised_driving_agents[i]->driving_agent_deep_copy(new_driving_scene);
+            new_driving_scene->pinned_driving_agents[i] = true;
+            new_driving_scene->materialised_size += get_driving_agent_size(i);
+        }
+    }
+
+    return new_driving_scene;
+}
+
+geometry::Vec LazyDrivingScene::get_min_spatial_limits() const
+{
+    return this->min_spatial_limits;
+}
+
+geometry::Vec LazyDrivingScene::get_max_spatial_limits() const
+{
+    return this->max_spatial_limits;
+}
+
+temporal::Duration LazyDrivingScene::get_time_step() const
+{
+    return driving_agent_source->get_time_step();
+}
+
+temporal::Time LazyDrivingScene::get_min_temporal_limit() const
+{
+    return this->min_temporal_limit;
+}
+
+temporal::Time LazyDrivingScene::get_max_temporal_limit() const
+{
+    return this->max_temporal_limit;
+}
+
+structures::IArray<IDrivingAgent const*>* LazyDrivingScene::get_driving_agents() const
+{
+    structures::stl::STLStackArray<IDrivingAgent const*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent const*>(this->driving_agents.size());
+
+    size_t i;
+    for (i = 0; i < this->driving_agents.size(); ++i)
+    {
+        (*driving_agents)[i] = this->driving_agents[i];
+    }
+
+    return driving_agents;
+}
+
+IDrivingAgent const* LazyDrivingScene::get_driving_agent(std::string const &driving_agent_name) const
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+structures::IArray<IDrivingAgent*>* LazyDrivingScene::get_mutable_driving_agents()
+{
+    structures::stl::STLStackArray<IDrivingAgent*> *driving_agents =
+            new structures::stl::STLStackArray<IDrivingAgent*>(this->driving_agents.size());
+
+    size_t i;
+    for (i = 0; i < this->driving_agents.size(); ++i)
+    {
+        (*driving_agents)[i] = this->driving_agents[i];
+    }
+
+    return driving_agents;
+}
+
+IDrivingAgent* LazyDrivingScene::get_mutable_driving_agent(std::string const &driving_agent_name)
+{
+    return driving_agent_dict[driving_agent_name];
+}
+
+}
+}
+}
@@ -1,11 +1,16 @@
 
 #include <ori/simcars/utils/exceptions.hpp>
+#include <ori/simcars/utils/json_stream_splitter.hpp>
 #include <ori/simcars/agent/lyft/lyft_scene.hpp>
 
 #include <lz4_stream.h>
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 
+#include <deque>
+#include <memory>
+#include <chrono>
+
 namespace ori
 {
 namespace simcars
@@ -76,40 +81,128 @@ void LyftScene::save_virt(std::ofstream &output_filestream) const
     throw utils::NotImplementedException();
 }
 
-void LyftScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names)
+void LyftScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names,
+                          utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings)
 {
+    std::chrono::time_point<std::chrono::high_resolution_clock> stage_start_time =
+            std::chrono::high_resolution_clock::now();
+
     lz4_stream::istream input_lz4_stream(input_filestream);
     rapidjson::BasicIStreamWrapper input_lz4_json_stream(input_lz4_stream);
 
-    rapidjson::Document json_document;
-    json_document.ParseStream(input_lz4_json_stream);
+    // Agents are decided upon as soon as their id and ego flag have been read, so states of agents that are not
+    // wanted are never buffered
+    auto agent_filter =
+            [agent_names](rapidjson::Value const &json_agent_data) -> bool
+            {
+                if (agent_names == nullptr || !json_agent_data.HasMember("id") || !json_agent_data.HasMember("ego"))
+                {
+                    return true;
+                }
 
-    this->time_step = temporal::Duration(100);
+                uint32_t const id = json_agent_data["id"].GetInt();
+                bool const ego = json_agent_data["ego"].GetBool();
 
-    this->min_temporal_limit = temporal::Time::max();
-    this->max_temporal_limit = temporal::Time::min();
+                return agent_names->contains((ego ? "ego_vehicle_" : "non_ego_vehicle_") + std::to_string(id));
+            };
 
-    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
-    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+    // Agents size their variables by the time step as they are constructed
+    this->time_step = temporal::Duration(100);
 
-    for (rapidjson::Value const &json_document_element : json_document.GetArray())
+    // Agents are constructed while the file is still being streamed in, either inline or across the thread pool,
+    // into slots ordered as in the file so the scene does not depend on the order in which worker threads finish
+    std::deque<LyftDrivingAgent*> driving_agents;
+    std::chrono::microseconds inline_construction_time = std::chrono::microseconds::zero();
+
+    utils::JSONStreamSplitter json_stream_splitter(
+                1,
+                agent_filter,
+                [&](std::vector<std::string> const&, rapidjson::Document &json_document_element)
+                {
+                    if (!agent_filter(json_document_element))
+                    {
+                        return;
+                    }
+
+                    LyftDrivingAgent *&driving_agent = driving_agents.emplace_back(nullptr);
+
+                    if (thread_pool != nullptr)
+                    {
+                        std::shared_ptr<rapidjson::Document> json_agent_data = std::make_shared<rapidjson::Document>();
+                        json_agent_data->Swap(json_document_element);
+                        std::shared_ptr<rapidjson::Document const> const_json_agent_data = json_agent_data;
+
+                        LyftDrivingAgent **driving_agent_slot = &driving_agent;
+                        thread_pool->submit([this, const_json_agent_data, driving_agent_slot]()
+                        {
+                            *driving_agent_slot = new LyftDrivingAgent(this, const_json_agent_data->GetObject());
+                        });
+                    }
+                    else
+                    {
+                        std::chrono::time_point<std::chrono::high_resolution_clock> construction_start_time =
+                                std::chrono::high_resolution_clock::now();
+
+                        rapidjson::Value const &json_agent_data = json_document_element;
+                        driving_agent = new LyftDrivingAgent(this, json_agent_data.GetObject());
+
+                        inline_construction_time += std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::high_resolution_clock::now() - construction_start_time);
+                    }
+                });
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> parse_end_time;
+
+    try
     {
-        rapidjson::Value::ConstObject const &json_agent_data = json_document_element.GetObject();
+        json_stream_splitter.parse(input_lz4_json_stream);
 
-        uint32_t const id = json_agent_data["id"].GetInt();
-        bool const ego = json_agent_data["ego"].GetBool();
+        parse_end_time = std::chrono::high_resolution_clock::now();
 
-        std::string agent_name = (ego ? "ego_vehicle_" : "non_ego_vehicle_") + std::to_string(id);
+        if (thread_pool != nullptr)
+        {
+            thread_pool->wait();
+        }
+    }
+    catch (...)
+    {
+        if (thread_pool != nullptr)
+        {
+            // Tasks still in flight refer to the agent slots, so they have to finish before anything is released
+            try
+            {
+                thread_pool->wait();
+            }
+            catch (...) {}
+        }
 
-        if (agent_names != nullptr && !agent_names->contains(agent_name))
+        for (LyftDrivingAgent *driving_agent : driving_agents)
         {
-            continue;
+            delete driving_agent;
         }
+        throw;
+    }
+
+    if (load_timings != nullptr)
+    {
+        load_timings->parse_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    parse_end_time - stage_start_time) - inline_construction_time;
+        load_timings->construction_time = inline_construction_time +
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - parse_end_time);
+    }
+    stage_start_time = std::chrono::high_resolution_clock::now();
 
-        LyftDrivingAgent *driving_agent = new LyftDrivingAgent(this, json_agent_data);
+    this->min_temporal_limit = temporal::Time::max();
+    this->max_temporal_limit = temporal::Time::min();
 
+    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+
+    for (LyftDrivingAgent *driving_agent : driving_agents)
+    {
         driving_agent_dict.update(driving_agent->get_name(), driving_agent);
 
         this->min_temporal_limit = std::min(driving_agent->get_min_temporal_limit(), this->min_temporal_limit);
@@ -126,6 +219,12 @@ void LyftScene::load_virt(std::ifstream &input_filestream, structures::ISet<std:
 
     this->min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
     this->max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+
+    if (load_timings != nullptr)
+    {
+        load_timings->merge_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
 }
 
 geometry::Vec LyftScene::get_min_spatial_limits() const
@@ -0,0 +1,126 @@
+
+#include <ori/simcars/agent/parameter_registry.hpp>
+
+#include <mutex>
+#include <stdexcept>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+ParameterRegistry::ParameterRegistry()
+{
+    driving_agent_parameter_handles.id = intern("id");
+    driving_agent_parameter_handles.ego = intern("ego");
+    driving_agent_parameter_handles.bb_length = intern("bb_length");
+    driving_agent_parameter_handles.bb_width = intern("bb_width");
+    driving_agent_parameter_handles.driving_agent_class = intern("driving_agent_class");
+    driving_agent_parameter_handles.position = intern("position.base");
+    driving_agent_parameter_handles.linear_velocity = intern("linear_velocity.base");
+    driving_agent_parameter_handles.aligned_linear_velocity = intern("aligned_linear_velocity.base");
+    driving_agent_parameter_handles.linear_acceleration = intern("linear_acceleration.base");
+    driving_agent_parameter_handles.aligned_linear_acceleration =
+            intern("aligned_linear_acceleration.indirect_actuation");
+    driving_agent_parameter_handles.external_linear_acceleration = intern("linear_acceleration.external");
+    driving_agent_parameter_handles.rotation = intern("rotation.base");
+    driving_agent_parameter_handles.steer = intern("steer.indirect_actuation");
+    driving_agent_parameter_handles.angular_velocity = intern("angular_velocity.base");
+    driving_agent_parameter_handles.ttc = intern("ttc.base");
+    driving_agent_parameter_handles.cumilative_collision_time = intern("cumilative_collision_time.base");
+    driving_agent_parameter_handles.aligned_linear_velocity_goal = intern("aligned_linear_velocity.goal");
+    driving_agent_parameter_handles.lane_goal = intern("lane.goal");
+}
+
+ParameterRegistry* ParameterRegistry::get_instance()
+{
+    static ParameterRegistry instance;
+    return &instance;
+}
+
+size_t ParameterRegistry::count() const
+{
+    std::shared_lock<std::shared_mutex> names_lock(names_mutex);
+    return parameter_names.size();
+}
+
+ParameterHandle ParameterRegistry::intern(std::string const &parameter_name)
+{
+    ParameterHandle parameter_handle;
+    if (get_handle(std::string_view(parameter_name), parameter_handle))
+    {
+        return parameter_handle;
+    }
+
+    std::unique_lock<std::shared_mutex> names_lock(names_mutex);
+
+    // Another thread may have interned the name between the locks
+    auto it = parameter_handles.find(std::string_view(parameter_name));
+    if (it != parameter_handles.end())
+    {
+        return it->second;
+    }
+
+    parameter_handle = ParameterHandle(parameter_names.size());
+    parameter_names.push_back(parameter_name);
+    parameter_handles.emplace(std::string_view(parameter_names.back()), parameter_handle);
+    return parameter_handle;
+}
+
+bool ParameterRegistry::get_handle(std::string_view parameter_name, ParameterHandle &parameter_handle) const
+{
+    std::shared_lock<std::shared_mutex> names_lock(names_mutex);
+    auto it = parameter_handles.find(parameter_name);
+    if (it != parameter_handles.end())
+    {
+        parameter_handle = it->second;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool ParameterRegistry::get_handle(std::string const &entity_name, std::string const &full_name,
+                                   ParameterHandle &parameter_handle) const
+{
+    if (full_name.size() <= entity_name.size() ||
+            full_name.compare(0, entity_name.size(), entity_name) != 0 ||
+            full_name[entity_name.size()] != '.')
+    {
+        return false;
+    }
+
+    return get_handle(std::string_view(full_name).substr(entity_name.size() + 1), parameter_handle);
+}
+
+std::string const& ParameterRegistry::get_parameter_name(ParameterHandle parameter_handle) const
+{
+    std::shared_lock<std::shared_mutex> names_lock(names_mutex);
+    if (parameter_handle < parameter_names.size())
+    {
+        return parameter_names[parameter_handle];
+    }
+    else
+    {
+        throw std::out_of_range("Parameter handle has not been registered");
+    }
+}
+
+std::string ParameterRegistry::get_full_name(std::string const &entity_name,
+                                             ParameterHandle parameter_handle) const
+{
+    return entity_name + "." + get_parameter_name(parameter_handle);
+}
+
+DrivingAgentParameterHandles const& ParameterRegistry::get_driving_agent_parameter_handles() const
+{
+    return driving_agent_parameter_handles;
+}
+
+}
+}
+}
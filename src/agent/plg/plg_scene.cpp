@@ -2,6 +2,10 @@
 #include <ori/simcars/utils/exceptions.hpp>
 #include <ori/simcars/agent/plg/plg_scene.hpp>
 
+#include <vector>
+#include <utility>
+#include <chrono>
+
 namespace ori
 {
 namespace simcars
@@ -72,22 +76,18 @@ void PLGScene::save_virt(std::ofstream &output_filestream) const
     throw utils::NotImplementedException();
 }
 
-void PLGScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names)
+void PLGScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::string>* agent_names,
+                         utils::WorkStealingThreadPool *thread_pool, SceneLoadTimings *load_timings)
 {
+    std::chrono::time_point<std::chrono::high_resolution_clock> stage_start_time =
+            std::chrono::high_resolution_clock::now();
+
     rapidcsv::Document tracks_csv_document(input_filestream, rapidcsv::LabelParams(-1, -1),
                                            rapidcsv::SeparatorParams(' '));
 
     size_t row_count = tracks_csv_document.GetRowCount();
 
-    this->time_step = temporal::Duration(10);
-
-    this->min_temporal_limit = temporal::Time::max();
-    this->max_temporal_limit = temporal::Time::min();
-
-    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
-    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
-    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+    std::vector<std::pair<size_t, size_t>> tracks_index_ranges;
 
     uint32_t previous_id = uint32_t(tracks_csv_document.GetCell<FP_DATA_TYPE>(0, 0));
     size_t i = 0;
@@ -111,33 +111,113 @@ void PLGScene::load_virt(std::ifstream &input_filestream, structures::ISet<std::
                 continue;
             }
 
-            PLGDrivingAgent *driving_agent =
-                    new PLGDrivingAgent(this, tracks_start_index, tracks_end_index,
-                                        tracks_csv_document);
+            tracks_index_ranges.push_back(std::make_pair(tracks_start_index, tracks_end_index));
+        }
+
+        previous_id = id;
+    }
+
+    if (load_timings != nullptr)
+    {
+        load_timings->parse_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
+    stage_start_time = std::chrono::high_resolution_clock::now();
 
-            driving_agent_dict.update(driving_agent->get_name(), driving_agent);
+    // Agents size their variables by the time step as they are constructed
+    this->time_step = temporal::Duration(10);
 
-            this->min_temporal_limit = std::min(driving_agent->get_min_temporal_limit(),
-                                                this->min_temporal_limit);
-            this->max_temporal_limit = std::max(driving_agent->get_max_temporal_limit(),
-                                                this->max_temporal_limit);
+    // Agents are constructed into slots ordered as in the file, so the scene does not depend on the order in which
+    // worker threads finish
+    std::vector<PLGDrivingAgent*> driving_agents(tracks_index_ranges.size(), nullptr);
 
-            geometry::Vec driving_agent_min_spatial_limits =
-                    driving_agent->get_min_spatial_limits();
-            min_position_x = std::min(driving_agent_min_spatial_limits.x(), min_position_x);
-            min_position_y = std::min(driving_agent_min_spatial_limits.y(), min_position_y);
+    try
+    {
+        for (size_t k = 0; k < tracks_index_ranges.size(); ++k)
+        {
+            auto construct_driving_agent = [this, &tracks_index_ranges, &tracks_csv_document, &driving_agents, k]()
+            {
+                driving_agents[k] = new PLGDrivingAgent(this, tracks_index_ranges[k].first,
+                                                        tracks_index_ranges[k].second, tracks_csv_document);
+            };
 
-            geometry::Vec driving_agent_max_spatial_limits =
-                    driving_agent->get_max_spatial_limits();
-            max_position_x = std::max(driving_agent_max_spatial_limits.x(), max_position_x);
-            max_position_y = std::max(driving_agent_max_spatial_limits.y(), max_position_y);
+            if (thread_pool != nullptr)
+            {
+                thread_pool->submit(construct_driving_agent);
+            }
+            else
+            {
+                construct_driving_agent();
+            }
         }
 
-        previous_id = id;
+        if (thread_pool != nullptr)
+        {
+            thread_pool->wait();
+        }
+    }
+    catch (...)
+    {
+        if (thread_pool != nullptr)
+        {
+            // Tasks still in flight refer to the agent slots, so they have to finish before anything is released
+            try
+            {
+                thread_pool->wait();
+            }
+            catch (...) {}
+        }
+
+        for (PLGDrivingAgent *driving_agent : driving_agents)
+        {
+            delete driving_agent;
+        }
+        throw;
+    }
+
+    if (load_timings != nullptr)
+    {
+        load_timings->construction_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
+    stage_start_time = std::chrono::high_resolution_clock::now();
+
+    this->min_temporal_limit = temporal::Time::max();
+    this->max_temporal_limit = temporal::Time::min();
+
+    FP_DATA_TYPE min_position_x = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_x = std::numeric_limits<FP_DATA_TYPE>::min();
+    FP_DATA_TYPE min_position_y = std::numeric_limits<FP_DATA_TYPE>::max();
+    FP_DATA_TYPE max_position_y = std::numeric_limits<FP_DATA_TYPE>::min();
+
+    for (PLGDrivingAgent *driving_agent : driving_agents)
+    {
+        driving_agent_dict.update(driving_agent->get_name(), driving_agent);
+
+        this->min_temporal_limit = std::min(driving_agent->get_min_temporal_limit(),
+                                            this->min_temporal_limit);
+        this->max_temporal_limit = std::max(driving_agent->get_max_temporal_limit(),
+                                            this->max_temporal_limit);
+
+        geometry::Vec driving_agent_min_spatial_limits =
+                driving_agent->get_min_spatial_limits();
+        min_position_x = std::min(driving_agent_min_spatial_limits.x(), min_position_x);
+        min_position_y = std::min(driving_agent_min_spatial_limits.y(), min_position_y);
+
+        geometry::Vec driving_agent_max_spatial_limits =
+                driving_agent->get_max_spatial_limits();
+        max_position_x = std::max(driving_agent_max_spatial_limits.x(), max_position_x);
+        max_position_y = std::max(driving_agent_max_spatial_limits.y(), max_position_y);
     }
 
     this->min_spatial_limits = geometry::Vec(min_position_x, min_position_y);
     this->max_spatial_limits = geometry::Vec(max_position_x, max_position_y);
+
+    if (load_timings != nullptr)
+    {
+        load_timings->merge_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - stage_start_time);
+    }
 }
 
 geometry::Vec PLGScene::get_min_spatial_limits() const
@@ -11,112 +11,128 @@ namespace agent
 IConstant<uint32_t> const* AReadOnlyDrivingAgentState::get_id_constant() const
 {
     IValuelessConstant const *id_valueless_constant =
-            this->get_parameter_value(this->get_name() + ".id");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().id);
     return dynamic_cast<IConstant<uint32_t> const*>(id_valueless_constant);
 }
 
 IConstant<bool> const* AReadOnlyDrivingAgentState::get_ego_constant() const
 {
     IValuelessConstant const *ego_valueless_constant =
-            this->get_parameter_value(this->get_name() + ".ego");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ego);
     return dynamic_cast<IConstant<bool> const*>(ego_valueless_constant);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_bb_length_constant() const
 {
     IValuelessConstant const *bb_length_valueless_constant =
-            this->get_parameter_value(this->get_name() + ".bb_length");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_length);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(bb_length_valueless_constant);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_bb_width_constant() const
 {
     IValuelessConstant const *bb_width_valueless_constant =
-            this->get_parameter_value(this->get_name() + ".bb_width");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().bb_width);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(bb_width_valueless_constant);
 }
 
 IConstant<DrivingAgentClass> const* AReadOnlyDrivingAgentState::get_driving_agent_class_constant() const
 {
     IValuelessConstant const *driving_agent_class_valueless_constant =
-            this->get_parameter_value(this->get_name() + ".driving_agent_class");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().driving_agent_class);
     return dynamic_cast<IConstant<DrivingAgentClass> const*>(driving_agent_class_valueless_constant);
 }
 
 IConstant<geometry::Vec> const* AReadOnlyDrivingAgentState::get_position_variable() const
 {
     IValuelessConstant const *position_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".position.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position);
     return dynamic_cast<IConstant<geometry::Vec> const*>(position_valueless_variable);
 }
 
 IConstant<geometry::Vec> const* AReadOnlyDrivingAgentState::get_linear_velocity_variable() const
 {
     IValuelessConstant const *linear_velocity_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".linear_velocity.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_velocity);
     return dynamic_cast<IConstant<geometry::Vec> const*>(linear_velocity_valueless_variable);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_aligned_linear_velocity_variable() const
 {
     IValuelessConstant const *aligned_linear_velocity_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".aligned_linear_velocity.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_velocity);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(aligned_linear_velocity_valueless_variable);
 }
 
 IConstant<geometry::Vec> const* AReadOnlyDrivingAgentState::get_linear_acceleration_variable() const
 {
     IValuelessConstant const *linear_acceleration_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".linear_acceleration.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().linear_acceleration);
     return dynamic_cast<IConstant<geometry::Vec> const*>(linear_acceleration_valueless_variable);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_aligned_linear_acceleration_variable() const
 {
     IValuelessConstant const *aligned_linear_acceleration_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".aligned_linear_acceleration.indirect_actuation");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().aligned_linear_acceleration);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(aligned_linear_acceleration_valueless_variable);
 }
 
 IConstant<geometry::Vec> const* AReadOnlyDrivingAgentState::get_external_linear_acceleration_variable() const
 {
     IValuelessConstant const *linear_acceleration_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".linear_acceleration.external");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().external_linear_acceleration);
     return dynamic_cast<IConstant<geometry::Vec> const*>(linear_acceleration_valueless_variable);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_rotation_variable() const
 {
     IValuelessConstant const *rotation_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".rotation.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().rotation);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(rotation_valueless_variable);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_steer_variable() const
 {
     IValuelessConstant const *steer_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".steer.indirect_actuation");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().steer);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(steer_valueless_variable);
 }
 
 IConstant<FP_DATA_TYPE> const* AReadOnlyDrivingAgentState::get_angular_velocity_variable() const
 {
     IValuelessConstant const *angular_velocity_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".angular_velocity.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().angular_velocity);
     return dynamic_cast<IConstant<FP_DATA_TYPE> const*>(angular_velocity_valueless_variable);
 }
 
 IConstant<temporal::Duration> const* AReadOnlyDrivingAgentState::get_ttc_variable() const
 {
     IValuelessConstant const *ttc_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".ttc.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().ttc);
     return dynamic_cast<IConstant<temporal::Duration> const*>(ttc_valueless_variable);
 }
 
 IConstant<temporal::Duration> const* AReadOnlyDrivingAgentState::get_cumilative_collision_time_variable() const
 {
     IValuelessConstant const *cumilative_collision_time_valueless_variable =
-            this->get_parameter_value(this->get_name() + ".cumilative_collision_time.base");
+            this->get_parameter_value(
+                ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().cumilative_collision_time);
     return dynamic_cast<IConstant<temporal::Duration> const*>(cumilative_collision_time_valueless_variable);
 }
 
@@ -21,7 +21,7 @@ FP_DATA_TYPE SafeSpeedyDrivingAgentRewardCalculator::calculate_driving_state_rew
     poe_reward *= collision_reward;
 
     FP_DATA_TYPE aligned_linear_velocity = state->get_aligned_linear_velocity_variable()->get_value();
-    FP_DATA_TYPE velocity_reward = 1.0f - 0.5f * std::exp(-std::max(aligned_linear_velocity * 1e2f, 0.0f));
+    FP_DATA_TYPE velocity_reward = 1.0f - 0.5f * std::exp(-std::max(aligned_linear_velocity * FP_DATA_TYPE(1e2), FP_DATA_TYPE(0)));
     poe_reward *= velocity_reward;
 
     return poe_reward;
@@ -0,0 +1,131 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/agent/swept_box_driving_agent_ttc_calculator.hpp>
+
+#include <cmath>
+
+namespace ori
+{
+namespace simcars
+{
+namespace agent
+{
+
+temporal::Duration SweptBoxDrivingAgentTTCCalculator::calc_smallest_buffered_ttc(
+        DrivingSceneStateBuffer const *state_buffer, size_t idx,
+        structures::IArray<size_t> const *candidate_indices, temporal::Duration ttc_limit) const
+{
+    // Calculators are shared between threads, hence the buffers being per thread
+    thread_local structures::stl::STLStackArray<size_t> contact_indices;
+    thread_local structures::stl::STLStackArray<FP_DATA_TYPE> contact_time_bounds;
+    thread_local geometry::OBoxBatch contact_o_boxes;
+    thread_local structures::stl::STLStackArray<FP_DATA_TYPE> collision_times;
+
+    DrivingAgentStateColumns const &next = state_buffer->next;
+
+    geometry::OBox const &o_box_1 = state_buffer->bounding_boxes[idx];
+    geometry::Vec velocity_1 = next.get_linear_velocity(idx);
+
+    // Times are in the units velocities are given in, as with the step sizes used in simulation
+    FP_DATA_TYPE smallest_collision_time = FP_DATA_TYPE(ttc_limit.count());
+
+    // Candidates are first projected onto their velocity relative to the agent and the normal to it, ruling out
+    // those which never come into contact and bounding when the rest could, so that only candidates which could
+    // collide sooner than any found so far go on to the full test
+    contact_indices.clear();
+    contact_time_bounds.clear();
+    size_t soonest_contact_k = 0;
+
+    size_t k;
+    for (k = 0; k < candidate_indices->count(); ++k)
+    {
+        size_t j = (*candidate_indices)[k];
+
+        if (j == idx)
+        {
+            continue;
+        }
+
+        geometry::OBox const &o_box_2 = state_buffer->bounding_boxes[j];
+
+        // Projections are all scaled by the relative speed, which leaves comparisons between them unaffected
+        geometry::Vec position_diff(o_box_2.centre_x - o_box_1.centre_x, o_box_2.centre_y - o_box_1.centre_y);
+        geometry::Vec velocity_diff = next.get_linear_velocity(j) - velocity_1;
+        geometry::Vec velocity_diff_normal(-velocity_diff.y(), velocity_diff.x());
+
+        if (std::abs(position_diff.dot(velocity_diff_normal)) >
+                o_box_1.calc_projected_half_extent(velocity_diff_normal) +
+                o_box_2.calc_projected_half_extent(velocity_diff_normal))
+        {
+            continue;
+        }
+
+        FP_DATA_TYPE closing_distance = -position_diff.dot(velocity_diff);
+        FP_DATA_TYPE contact_distance = o_box_1.calc_projected_half_extent(velocity_diff) +
+                o_box_2.calc_projected_half_extent(velocity_diff);
+
+        if (closing_distance < -contact_distance)
+        {
+            continue;
+        }
+
+        FP_DATA_TYPE velocity_diff_squared_norm = velocity_diff.squaredNorm();
+        FP_DATA_TYPE contact_time_bound = closing_distance > contact_distance ?
+                    (closing_distance - contact_distance) / velocity_diff_squared_norm : 0.0f;
+
+        if (contact_time_bound >= smallest_collision_time)
+        {
+            continue;
+        }
+
+        if (contact_indices.count() == 0 || contact_time_bound < contact_time_bounds[soonest_contact_k])
+        {
+            soonest_contact_k = contact_indices.count();
+        }
+        contact_indices.push_back(j);
+        contact_time_bounds.push_back(contact_time_bound);
+    }
+
+    if (contact_indices.count() == 0)
+    {
+        return ttc_limit;
+    }
+
+    // The candidate that could come into contact soonest is tested first on its own, as it most often collides
+    // first, then whichever of the rest could collide sooner than it are tested together
+    size_t j = contact_indices[soonest_contact_k];
+    smallest_collision_time = std::min(
+                smallest_collision_time,
+                o_box_1.calc_collision_time(state_buffer->bounding_boxes[j],
+                                            next.get_linear_velocity(j) - velocity_1));
+
+    contact_o_boxes.clear();
+    for (k = 0; k < contact_indices.count(); ++k)
+    {
+        if (k != soonest_contact_k && contact_time_bounds[k] < smallest_collision_time)
+        {
+            j = contact_indices[k];
+            contact_o_boxes.push_back(state_buffer->bounding_boxes[j], next.get_linear_velocity(j));
+        }
+    }
+
+    collision_times.clear();
+    contact_o_boxes.get_collision_times(o_box_1, velocity_1, &collision_times);
+    for (k = 0; k < collision_times.count(); ++k)
+    {
+        smallest_collision_time = std::min(smallest_collision_time, collision_times[k]);
+    }
+
+    if (smallest_collision_time < FP_DATA_TYPE(ttc_limit.count()))
+    {
+        return temporal::Duration(int64_t(smallest_collision_time));
+    }
+    else
+    {
+        return ttc_limit;
+    }
+}
+
+}
+}
+}
@@ -82,6 +82,29 @@ IValuelessConstant const* ViewDrivingAgentState::get_parameter_value(std::string
     }
 }
 
+IValuelessConstant const* ViewDrivingAgentState::get_parameter_value(ParameterHandle parameter_handle) const
+{
+    IValuelessConstant const *parameter_value;
+    parameter_value = agent->get_constant_parameter(parameter_handle);
+    if (parameter_value != nullptr)
+    {
+        return parameter_value;
+    }
+    else
+    {
+        IValuelessVariable const *valueless_variable =
+                agent->get_variable_parameter(parameter_handle);
+        if (valueless_variable != nullptr)
+        {
+            return valueless_variable->get_valueless_event(time);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+}
+
 IConstant<uint32_t> const* ViewDrivingAgentState::get_id_constant() const
 {
     return agent->get_id_constant();
@@ -167,6 +190,11 @@ IDrivingAgent const* ViewDrivingAgentState::get_agent() const
     return agent;
 }
 
+IDrivingAgent* ViewDrivingAgentState::get_mutable_agent()
+{
+    return agent;
+}
+
 // Inefficient, use other access functions if you can
 structures::IArray<IValuelessConstant*>* ViewDrivingAgentState::get_mutable_parameter_values()
 {
@@ -216,6 +244,29 @@ IValuelessConstant* ViewDrivingAgentState::get_mutable_parameter_value(std::stri
     }
 }
 
+IValuelessConstant* ViewDrivingAgentState::get_mutable_parameter_value(ParameterHandle parameter_handle)
+{
+    IValuelessConstant *parameter_value;
+    parameter_value = agent->get_mutable_constant_parameter(parameter_handle);
+    if (parameter_value != nullptr)
+    {
+        return parameter_value;
+    }
+    else
+    {
+        IValuelessVariable *valueless_variable =
+                agent->get_mutable_variable_parameter(parameter_handle);
+        if (valueless_variable != nullptr)
+        {
+            return valueless_variable->get_mutable_valueless_event(time);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+}
+
 void ViewDrivingAgentState::set_id_constant(IConstant<uint32_t> *id_constant)
 {
     agent->get_mutable_id_constant()->set_value(id_constant->get_value());
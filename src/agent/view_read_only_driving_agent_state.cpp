@@ -68,6 +68,20 @@ IValuelessConstant const* ViewReadOnlyDrivingAgentState::get_parameter_value(std
     }
 }
 
+IValuelessConstant const* ViewReadOnlyDrivingAgentState::get_parameter_value(ParameterHandle parameter_handle) const
+{
+    IValuelessConstant const *parameter_value;
+    parameter_value = agent->get_constant_parameter(parameter_handle);
+    if (parameter_value != nullptr)
+    {
+        return parameter_value;
+    }
+    else
+    {
+        return agent->get_variable_parameter(parameter_handle)->get_valueless_event(time);
+    }
+}
+
 IConstant<uint32_t> const* ViewReadOnlyDrivingAgentState::get_id_constant() const
 {
     return agent->get_id_constant();
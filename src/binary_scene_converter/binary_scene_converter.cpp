@@ -0,0 +1,96 @@
+
+#include <ori/simcars/utils/work_stealing_thread_pool.hpp>
+#include <ori/simcars/geometry/trig_buff.hpp>
+#include <ori/simcars/agent/highd/highd_scene.hpp>
+#include <ori/simcars/agent/lyft/lyft_scene.hpp>
+#include <ori/simcars/agent/plg/plg_scene.hpp>
+#include <ori/simcars/agent/binary/binary_scene.hpp>
+
+#include <iostream>
+#include <exception>
+#include <string>
+
+using namespace ori::simcars;
+
+int main(int argc, char *argv[])
+{
+    std::string const dataset = argc > 1 ? argv[1] : "";
+
+    if (!((dataset == "highd" && argc >= 5) || ((dataset == "lyft" || dataset == "plg") && argc >= 4)))
+    {
+        std::cerr << "Usage: ./binary_scene_converter highd tracks_meta_file_path tracks_file_path output_file_path [thread_count]" << std::endl;
+        std::cerr << "       ./binary_scene_converter lyft scene_file_path output_file_path [thread_count]" << std::endl;
+        std::cerr << "       ./binary_scene_converter plg scene_file_path output_file_path [thread_count]" << std::endl;
+        return -1;
+    }
+
+    int const thread_count_arg_idx = dataset == "highd" ? 5 : 4;
+
+    // Agents are only constructed in parallel when a thread count is given, zero using every hardware thread
+    utils::WorkStealingThreadPool *thread_pool = nullptr;
+    if (argc > thread_count_arg_idx)
+    {
+        thread_pool = new utils::WorkStealingThreadPool(std::stoul(argv[thread_count_arg_idx]));
+    }
+
+    geometry::TrigBuff::init_instance(360000, geometry::AngleType::RADIANS);
+
+    std::cout << "Beginning scene load" << std::endl;
+
+    agent::IDrivingScene *scene;
+    std::string output_file_path;
+    agent::SceneLoadTimings load_timings;
+
+    try
+    {
+        if (dataset == "highd")
+        {
+            scene = agent::highd::HighDScene::load(argv[2], argv[3], nullptr, thread_pool, &load_timings);
+            output_file_path = argv[4];
+        }
+        else if (dataset == "lyft")
+        {
+            scene = agent::lyft::LyftScene::load(argv[2], nullptr, thread_pool, &load_timings);
+            output_file_path = argv[3];
+        }
+        else
+        {
+            scene = agent::plg::PLGScene::load(argv[2], nullptr, thread_pool, &load_timings);
+            output_file_path = argv[3];
+        }
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Exception occured during scene load:" << std::endl << e.what() << std::endl;
+        delete thread_pool;
+        return -1;
+    }
+
+    delete thread_pool;
+
+    std::cout << "Finished scene load" << std::endl;
+
+    std::cout << "Parse time: " << load_timings.parse_time.count() << " us" << std::endl;
+    std::cout << "Construction time: " << load_timings.construction_time.count() << " us" << std::endl;
+    std::cout << "Merge time: " << load_timings.merge_time.count() << " us" << std::endl;
+    std::cout << "Total load time: " << load_timings.total_time.count() << " us" << std::endl;
+
+    std::cout << "Beginning binary scene write" << std::endl;
+
+    try
+    {
+        agent::binary::BinaryScene::write(scene, output_file_path);
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Exception occured during binary scene write:" << std::endl << e.what() << std::endl;
+        delete scene;
+        return -1;
+    }
+
+    std::cout << "Finished binary scene write" << std::endl;
+
+    delete scene;
+
+    geometry::TrigBuff::destroy_instance();
+}
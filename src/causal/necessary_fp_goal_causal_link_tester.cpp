@@ -4,8 +4,11 @@
 #include <ori/simcars/agent/defines.hpp>
 #include <ori/simcars/agent/variable_interface.hpp>
 #include <ori/simcars/agent/basic_event.hpp>
+#include <ori/simcars/agent/driving_scene_fork.hpp>
 #include <ori/simcars/causal/necessary_fp_goal_causal_link_tester.hpp>
 
+#include <memory>
+
 #ifdef CD_DEBUG_PRINT
 #include <iostream>
 #include <iomanip>
@@ -23,11 +26,24 @@ NecessaryFPGoalCausalLinkTester::NecessaryFPGoalCausalLinkTester(
         agent::ISimulationSceneFactory const *simulation_scene_factory,
         agent::ISimulator const *simulator, agent::IRewardCalculator const *reward_calculator,
         agent::IAgencyCalculator const *agency_calculator, FP_DATA_TYPE reward_diff_threshold,
-        temporal::Duration simulation_horizon)
+        temporal::Duration simulation_horizon, SimulationRolloutCache *rollout_cache)
     : action_sampler(action_sampler), simulation_scene_factory(simulation_scene_factory),
       simulator(simulator), reward_calculator(reward_calculator),
       agency_calculator(agency_calculator), reward_diff_threshold(reward_diff_threshold),
-      simulation_horizon(simulation_horizon) {}
+      simulation_horizon(simulation_horizon), rollout_cache(rollout_cache) {}
+
+agent::IScene* NecessaryFPGoalCausalLinkTester::fork_scene(agent::IScene const *scene)
+{
+    agent::IDrivingScene const *driving_scene = dynamic_cast<agent::IDrivingScene const*>(scene);
+    if (driving_scene != nullptr)
+    {
+        return agent::DrivingSceneFork::construct_from(driving_scene);
+    }
+    else
+    {
+        return scene->scene_deep_copy();
+    }
+}
 
 void NecessaryFPGoalCausalLinkTester::test_causal_link(
         agent::IScene const *scene,
@@ -42,57 +58,94 @@ void NecessaryFPGoalCausalLinkTester::test_causal_link(
     }
 
 
-    agent::IScene *original_scene = scene->scene_deep_copy();
-
-    agent::IEntity *cause_entity = original_scene->get_mutable_entity(cause->get_entity_name());
-    agent::IValuelessVariable *cause_variable =
-            cause_entity->get_mutable_variable_parameter(cause->get_full_name());
-    structures::IArray<agent::IValuelessEvent*> *cause_events =
-            cause_variable->get_mutable_valueless_events();
-
-    agent::IEntity *effect_entity = original_scene->get_mutable_entity(effect->get_entity_name());
-    agent::IValuelessVariable *effect_variable =
-            effect_entity->get_mutable_variable_parameter(effect->get_full_name());
-    structures::IArray<agent::IValuelessEvent*> *effect_events =
-            effect_variable->get_mutable_valueless_events();
+    agent::IEntity const *cause_entity = scene->get_entity(cause->get_entity_name());
+    agent::IEntity const *effect_entity = scene->get_entity(effect->get_entity_name());
 
     temporal::Time time_window_start = cause->get_time();
     temporal::Time time_window_end =
             std::min(effect_entity->get_max_temporal_limit() + simulation_horizon,
                      scene->get_max_temporal_limit());
+    temporal::Time original_simulation_start_time =
+            std::min(cause_entity->get_max_temporal_limit(),
+                     effect_entity->get_max_temporal_limit());
 
-    cause_variable->propogate_events_forward(time_window_end);
-    effect_variable->propogate_events_forward(time_window_end);
 
-
-    structures::ISet<std::string> *relevant_agent_names = new structures::stl::STLSet<std::string>;
+    std::unique_ptr<structures::ISet<std::string>> relevant_agent_names(
+                new structures::stl::STLSet<std::string>);
     relevant_agent_names->insert(cause->get_entity_name());
     relevant_agent_names->insert(effect->get_entity_name());
 
 
-    agent::IScene *simulated_original_scene =
-            simulation_scene_factory->create_simulation_scene(
-                original_scene, simulator, scene->get_time_step(),
-                std::min(cause_entity->get_max_temporal_limit(),
-                         effect_entity->get_max_temporal_limit()),
-                time_window_end, relevant_agent_names);
-
-    agent::IScene *cause_intervened_scene = original_scene->scene_deep_copy();
-    agent::IEntity *cause_intervened_entity =
-            cause_intervened_scene->get_mutable_entity(cause->get_entity_name());
-    agent::IValuelessVariable *cause_intervened_variable =
-            cause_intervened_entity->get_mutable_variable_parameter(cause->get_full_name());
-    if (cause->get_time() == cause_intervened_variable->get_min_temporal_limit())
+    SimulationRolloutCache local_rollout_cache;
+    SimulationRolloutCache *active_rollout_cache =
+            rollout_cache != nullptr ? rollout_cache : &local_rollout_cache;
+
+    // The unintervened rollout only depends on which agents are simulated and over what time window,
+    // so it is shared by every pair of events belonging to the same pair of agents
+    std::string original_rollout_key =
+            std::min(cause->get_entity_name(), effect->get_entity_name()) + "|" +
+            std::max(cause->get_entity_name(), effect->get_entity_name()) + "|" +
+            std::to_string(original_simulation_start_time.time_since_epoch().count()) + "|" +
+            std::to_string(time_window_end.time_since_epoch().count());
+
+    SimulationRolloutCache::ScopedRollout original_rollout(
+                active_rollout_cache, original_rollout_key,
+                [&](agent::IScene *&new_original_scene,
+                    agent::ISimulationScene *&new_simulated_original_scene)
     {
-        throw std::invalid_argument("Potential cause event cannot be an initialising event");
-    }
-    cause_intervened_variable->remove_value(cause->get_time());
-    cause_intervened_variable->propogate_events_forward(time_window_end);
-    agent::IScene *simulated_cause_intervened_scene =
-            simulation_scene_factory->create_simulation_scene(cause_intervened_scene, simulator,
-                                                              scene->get_time_step(),
-                                                              time_window_start, time_window_end,
-                                                              relevant_agent_names);
+        new_original_scene = fork_scene(scene);
+
+        agent::IValuelessVariable *cause_variable =
+                new_original_scene->get_mutable_entity(cause->get_entity_name())->
+                get_mutable_variable_parameter(cause->get_full_name());
+        agent::IValuelessVariable *effect_variable =
+                new_original_scene->get_mutable_entity(effect->get_entity_name())->
+                get_mutable_variable_parameter(effect->get_full_name());
+
+        cause_variable->propogate_events_forward(time_window_end);
+        effect_variable->propogate_events_forward(time_window_end);
+
+        new_simulated_original_scene =
+                simulation_scene_factory->create_simulation_scene(
+                    new_original_scene, simulator, scene->get_time_step(),
+                    original_simulation_start_time, time_window_end,
+                    relevant_agent_names.get());
+    }, time_window_end);
+    agent::IScene const *original_scene = original_rollout.get_scene();
+    agent::ISimulationScene const *simulated_original_scene =
+            original_rollout.get_simulation_scene();
+
+    // Likewise the cause intervened rollout is shared by every effect of the same agent tested
+    // against the same cause
+    std::string cause_intervened_rollout_key =
+            original_rollout_key + "|" + cause->get_full_name() + "|" +
+            std::to_string(cause->get_time().time_since_epoch().count());
+
+    SimulationRolloutCache::ScopedRollout cause_intervened_rollout(
+                active_rollout_cache, cause_intervened_rollout_key,
+                [&](agent::IScene *&new_cause_intervened_scene,
+                    agent::ISimulationScene *&new_simulated_cause_intervened_scene)
+    {
+        new_cause_intervened_scene = fork_scene(original_scene);
+
+        agent::IValuelessVariable *cause_intervened_variable =
+                new_cause_intervened_scene->get_mutable_entity(cause->get_entity_name())->
+                get_mutable_variable_parameter(cause->get_full_name());
+        if (cause->get_time() == cause_intervened_variable->get_min_temporal_limit())
+        {
+            throw std::invalid_argument("Potential cause event cannot be an initialising event");
+        }
+        cause_intervened_variable->remove_value(cause->get_time());
+        cause_intervened_variable->propogate_events_forward(time_window_end);
+
+        new_simulated_cause_intervened_scene =
+                simulation_scene_factory->create_simulation_scene(
+                    new_cause_intervened_scene, simulator, scene->get_time_step(),
+                    time_window_start, time_window_end, relevant_agent_names.get());
+    }, time_window_end, original_rollout_key);
+    agent::IScene const *cause_intervened_scene = cause_intervened_rollout.get_scene();
+    agent::ISimulationScene const *simulated_cause_intervened_scene =
+            cause_intervened_rollout.get_simulation_scene();
 
 
     FP_DATA_TYPE preeffect_min_original_effect_reward = 1.0f;
@@ -177,7 +230,7 @@ void NecessaryFPGoalCausalLinkTester::test_causal_link(
     }
 
 
-    agent::IScene *effect_intervened_scene = original_scene->scene_deep_copy();
+    std::unique_ptr<agent::IScene> effect_intervened_scene(fork_scene(original_scene));
     agent::IEntity *effect_intervened_entity =
             effect_intervened_scene->get_mutable_entity(effect->get_entity_name());
     agent::IValuelessVariable *effect_intervened_variable =
@@ -188,27 +241,24 @@ void NecessaryFPGoalCausalLinkTester::test_causal_link(
     }
     effect_intervened_variable->remove_value(effect->get_time());
     effect_intervened_variable->propogate_events_forward(time_window_end);
-    agent::IScene *simulated_effect_intervened_scene =
+    std::unique_ptr<agent::IScene> simulated_effect_intervened_scene(
             simulation_scene_factory->create_simulation_scene(
-                effect_intervened_scene, simulator, scene->get_time_step(),
+                effect_intervened_scene.get(), simulator, scene->get_time_step(),
                 std::min(effect->get_time(), cause_entity->get_max_temporal_limit()),
-                time_window_end, relevant_agent_names);
+                time_window_end, relevant_agent_names.get()));
 
-    agent::IScene *cause_effect_intervened_scene =
-            cause_intervened_scene->scene_deep_copy();
+    std::unique_ptr<agent::IScene> cause_effect_intervened_scene(
+            fork_scene(cause_intervened_scene));
     agent::IEntity *cause_effect_intervened_entity =
             cause_effect_intervened_scene->get_mutable_entity(effect->get_entity_name());
     agent::IValuelessVariable *cause_effect_intervened_variable =
             cause_effect_intervened_entity->get_mutable_variable_parameter(effect->get_full_name());
     cause_effect_intervened_variable->remove_value(effect->get_time());
     cause_effect_intervened_variable->propogate_events_forward(time_window_end);
-    agent::IScene *simulated_cause_effect_intervened_scene =
-            simulation_scene_factory->create_simulation_scene(cause_effect_intervened_scene,
-                                                              simulator, scene->get_time_step(),
-                                                              time_window_start, time_window_end,
-                                                              relevant_agent_names);
-
-    delete relevant_agent_names;
+    std::unique_ptr<agent::IScene> simulated_cause_effect_intervened_scene(
+            simulation_scene_factory->create_simulation_scene(
+                cause_effect_intervened_scene.get(), simulator, scene->get_time_step(),
+                time_window_start, time_window_end, relevant_agent_names.get()));
 
 
     FP_DATA_TYPE posteffect_min_original_effect_reward = 1.0f;
@@ -407,15 +457,6 @@ void NecessaryFPGoalCausalLinkTester::test_causal_link(
 #endif
 
 
-    delete simulated_cause_effect_intervened_scene;
-    delete cause_effect_intervened_scene;
-    delete simulated_effect_intervened_scene;
-    delete effect_intervened_scene;
-    delete simulated_cause_intervened_scene;
-    delete cause_intervened_scene;
-    delete simulated_original_scene;
-    delete original_scene;
-
     reward_found = causally_significant;
     agency_found = (active_type || passive_type) && !(facilitation_type || mutual_effect_motive);
     hybrid_found = (causally_significant || active_type || passive_type) &&
@@ -0,0 +1,242 @@
+
+#include <ori/simcars/causal/simulation_rollout_cache.hpp>
+
+#include <stdexcept>
+
+namespace ori
+{
+namespace simcars
+{
+namespace causal
+{
+
+SimulationRolloutCache::Entry::Entry(std::string const &key) :
+    key(key), scene(nullptr), simulation_scene(nullptr), parent(nullptr), borrow_count(0) {}
+
+SimulationRolloutCache::Entry::~Entry()
+{
+    delete simulation_scene;
+    delete scene;
+}
+
+
+SimulationRolloutCache::SimulationRolloutCache(size_t max_count) :
+    max_count(max_count), hit_count(0), miss_count(0) {}
+
+SimulationRolloutCache::~SimulationRolloutCache()
+{
+    clear();
+}
+
+void SimulationRolloutCache::borrow(Entry *entry)
+{
+    if (entry->borrow_count == 0)
+    {
+        evictable_entries.erase(entry->evictable_it);
+    }
+    ++entry->borrow_count;
+}
+
+void SimulationRolloutCache::release(Entry *entry)
+{
+    --entry->borrow_count;
+    if (entry->borrow_count == 0)
+    {
+        entry->evictable_it = evictable_entries.insert(evictable_entries.end(), entry);
+    }
+}
+
+void SimulationRolloutCache::evict()
+{
+    while (max_count != 0 && entries.size() > max_count && evictable_entries.size() > 0)
+    {
+        Entry *entry = evictable_entries.front();
+        evictable_entries.pop_front();
+        entries.erase(entry->key);
+
+        // The parent may only become evictable once the rollout forked from it has been deleted
+        Entry *parent = entry->parent;
+        delete entry;
+        if (parent != nullptr)
+        {
+            release(parent);
+        }
+    }
+}
+
+void SimulationRolloutCache::drop(Entry *entry)
+{
+    entries.erase(entry->key);
+
+    // A failed rollout never needs its parent again, so it should not keep it from being evicted
+    if (entry->parent != nullptr)
+    {
+        release(entry->parent);
+        entry->parent = nullptr;
+    }
+}
+
+size_t SimulationRolloutCache::count() const
+{
+    std::lock_guard<std::mutex> entries_lock(entries_mutex);
+    return entries.size();
+}
+
+size_t SimulationRolloutCache::get_hit_count() const
+{
+    std::lock_guard<std::mutex> entries_lock(entries_mutex);
+    return hit_count;
+}
+
+size_t SimulationRolloutCache::get_miss_count() const
+{
+    std::lock_guard<std::mutex> entries_lock(entries_mutex);
+    return miss_count;
+}
+
+void SimulationRolloutCache::get_rollout(std::string const &key,
+                                         RolloutCreator const &rollout_creator,
+                                         temporal::Time simulation_end_time,
+                                         agent::IScene const *&scene,
+                                         agent::ISimulationScene const *&simulation_scene,
+                                         std::string const &parent_key)
+{
+    Entry *entry;
+    std::promise<void> ready_promise;
+    bool create_rollout;
+
+    {
+        std::lock_guard<std::mutex> entries_lock(entries_mutex);
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            entry = it->second;
+            create_rollout = false;
+            ++hit_count;
+        }
+        else
+        {
+            entry = new Entry(key);
+            entry->ready = ready_promise.get_future().share();
+            if (!parent_key.empty())
+            {
+                auto parent_it = entries.find(parent_key);
+                if (parent_it == entries.end())
+                {
+                    delete entry;
+                    throw std::invalid_argument("Parent rollout is not cached");
+                }
+                entry->parent = parent_it->second;
+                borrow(entry->parent);
+            }
+            entry->evictable_it = evictable_entries.end();
+            ++entry->borrow_count;
+            entries.emplace(key, entry);
+            create_rollout = true;
+            ++miss_count;
+        }
+
+        if (!create_rollout)
+        {
+            borrow(entry);
+        }
+
+        evict();
+    }
+
+    if (create_rollout)
+    {
+        try
+        {
+            rollout_creator(entry->scene, entry->simulation_scene);
+            entry->simulation_scene->simulate(simulation_end_time);
+            ready_promise.set_value();
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> entries_lock(entries_mutex);
+                drop(entry);
+                evict();
+            }
+            ready_promise.set_exception(std::current_exception());
+        }
+    }
+
+    try
+    {
+        // Rethrows any exception thrown while creating the rollout
+        entry->ready.get();
+    }
+    catch (...)
+    {
+        // The entry has already been dropped, so it is deleted rather than made evictable once no
+        // thread waiting upon it still borrows it
+        std::lock_guard<std::mutex> entries_lock(entries_mutex);
+        --entry->borrow_count;
+        if (entry->borrow_count == 0)
+        {
+            delete entry;
+        }
+        throw;
+    }
+
+    scene = entry->scene;
+    simulation_scene = entry->simulation_scene;
+}
+
+void SimulationRolloutCache::release_rollout(std::string const &key)
+{
+    std::lock_guard<std::mutex> entries_lock(entries_mutex);
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second->borrow_count == 0)
+    {
+        throw std::invalid_argument("Rollout is not borrowed");
+    }
+    release(it->second);
+    evict();
+}
+
+void SimulationRolloutCache::clear()
+{
+    std::lock_guard<std::mutex> entries_lock(entries_mutex);
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        delete it->second;
+    }
+    entries.clear();
+    evictable_entries.clear();
+    hit_count = 0;
+    miss_count = 0;
+}
+
+
+SimulationRolloutCache::ScopedRollout::ScopedRollout(SimulationRolloutCache *cache,
+                                                     std::string const &key,
+                                                     RolloutCreator const &rollout_creator,
+                                                     temporal::Time simulation_end_time,
+                                                     std::string const &parent_key) :
+    cache(cache), key(key)
+{
+    cache->get_rollout(key, rollout_creator, simulation_end_time, scene, simulation_scene,
+                       parent_key);
+}
+
+SimulationRolloutCache::ScopedRollout::~ScopedRollout()
+{
+    cache->release_rollout(key);
+}
+
+agent::IScene const* SimulationRolloutCache::ScopedRollout::get_scene() const
+{
+    return scene;
+}
+
+agent::ISimulationScene const* SimulationRolloutCache::ScopedRollout::get_simulation_scene() const
+{
+    return simulation_scene;
+}
+
+}
+}
+}
@@ -0,0 +1,178 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/geometry/trig_buff.hpp>
+#include <ori/simcars/geometry/o_box.hpp>
+#include <ori/simcars/geometry/tri_batch.hpp>
+
+#include <chrono>
+#include <random>
+#include <iostream>
+
+#define BOX_COUNT 1000
+#define TRI_COUNT 1000
+#define POINT_COUNT 100000
+#define KINEMATIC_AGENT_COUNT 1000
+#define KINEMATIC_STEP_COUNT 1000
+#define KINEMATIC_TIME_STEP FP_DATA_TYPE(0.1)
+#define MAX_COLLISION_TIME FP_DATA_TYPE(10.0)
+#define SPATIAL_RANGE 500.0
+
+using namespace ori::simcars;
+using namespace ori::simcars::geometry;
+using namespace std::chrono;
+
+// Times the geometry kernels the simulator spends most of its time in, build once with each SIMCARS_FP_DATA_TYPE
+// and compare the output
+int main()
+{
+    TrigBuff const *trig_buff = TrigBuff::init_instance(2000, AngleType::RADIANS);
+
+    time_point<high_resolution_clock> start_time;
+    microseconds time_elapsed;
+
+    // Inputs are generated in double precision and rounded, so that both precisions are given the same inputs
+    std::minstd_rand generator(0);
+    std::uniform_real_distribution<double> position_distribution(0.0, SPATIAL_RANGE);
+    std::uniform_real_distribution<double> orientation_distribution(-M_PI, M_PI);
+    std::uniform_real_distribution<double> speed_distribution(-20.0, 20.0);
+    std::uniform_real_distribution<double> offset_distribution(-5.0, 5.0);
+
+    std::cout << "Scalar size: " << sizeof(FP_DATA_TYPE) * 8 << " bits" << std::endl;
+
+    size_t i, j;
+
+
+    std::vector<OBox> o_boxes(BOX_COUNT);
+    std::vector<Vec> velocities(BOX_COUNT);
+    OBoxBatch o_box_batch;
+    for (i = 0; i < BOX_COUNT; ++i)
+    {
+        o_boxes[i] = OBox::create(Vec(position_distribution(generator), position_distribution(generator)), 4.5f, 2.0f,
+                                  orientation_distribution(generator), trig_buff);
+        velocities[i] = Vec(speed_distribution(generator), speed_distribution(generator));
+        o_box_batch.push_back(o_boxes[i], velocities[i]);
+    }
+
+    size_t collision_count = 0;
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < BOX_COUNT; ++i)
+    {
+        for (j = 0; j < BOX_COUNT; ++j)
+        {
+            collision_count += o_boxes[i].check_collision(o_boxes[j]);
+        }
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Box Collisions: " << time_elapsed.count() << " us (" << collision_count << " colliding)" <<
+                 std::endl;
+
+
+    FP_DATA_TYPE collision_time_sum = 0.0f;
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < BOX_COUNT; ++i)
+    {
+        for (j = 0; j < BOX_COUNT; ++j)
+        {
+            FP_DATA_TYPE const collision_time = o_boxes[i].calc_collision_time(o_boxes[j],
+                                                                                velocities[j] - velocities[i]);
+            if (collision_time < MAX_COLLISION_TIME)
+            {
+                collision_time_sum += collision_time;
+            }
+        }
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Box Collision Times: " << time_elapsed.count() << " us (" << collision_time_sum << " s summed)" <<
+                 std::endl;
+
+
+    structures::stl::STLStackArray<FP_DATA_TYPE> collision_times;
+    collision_time_sum = 0.0f;
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < BOX_COUNT; ++i)
+    {
+        collision_times.clear();
+        o_box_batch.get_collision_times(o_boxes[i], velocities[i], &collision_times);
+        for (j = 0; j < collision_times.count(); ++j)
+        {
+            if (collision_times[j] < MAX_COLLISION_TIME)
+            {
+                collision_time_sum += collision_times[j];
+            }
+        }
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Batched Box Collision Times: " << time_elapsed.count() << " us (" << collision_time_sum <<
+                 " s summed)" << std::endl;
+
+
+    structures::stl::STLStackArray<Tri> tris;
+    for (i = 0; i < TRI_COUNT; ++i)
+    {
+        Vec const vertex(position_distribution(generator), position_distribution(generator));
+        tris.push_back(Tri(vertex,
+                           vertex + Vec(offset_distribution(generator), offset_distribution(generator)),
+                           vertex + Vec(offset_distribution(generator), offset_distribution(generator))));
+    }
+    TriBatch const tri_batch(&tris);
+    Rect const bounding_box(-5.0, -5.0, SPATIAL_RANGE + 5.0, SPATIAL_RANGE + 5.0);
+
+    Vecs points(2, POINT_COUNT);
+    for (i = 0; i < POINT_COUNT; ++i)
+    {
+        points(0, i) = position_distribution(generator);
+        points(1, i) = position_distribution(generator);
+    }
+
+    structures::stl::STLStackArray<size_t> encapsulated_point_indices;
+
+    start_time = high_resolution_clock::now();
+
+    tri_batch.check_encapsulation(points, bounding_box, &encapsulated_point_indices);
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Batched Tri Encapsulation: " << time_elapsed.count() << " us (" <<
+                 encapsulated_point_indices.count() << " encapsulated)" << std::endl;
+
+
+    Vecs positions(2, KINEMATIC_AGENT_COUNT);
+    Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> speeds(KINEMATIC_AGENT_COUNT);
+    Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> rotations(KINEMATIC_AGENT_COUNT);
+    Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> angular_velocities(KINEMATIC_AGENT_COUNT);
+    for (i = 0; i < KINEMATIC_AGENT_COUNT; ++i)
+    {
+        positions(0, i) = position_distribution(generator);
+        positions(1, i) = position_distribution(generator);
+        speeds(i) = speed_distribution(generator);
+        rotations(i) = orientation_distribution(generator);
+        angular_velocities(i) = speed_distribution(generator) * 0.01;
+    }
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < KINEMATIC_STEP_COUNT; ++i)
+    {
+        for (j = 0; j < KINEMATIC_AGENT_COUNT; ++j)
+        {
+            positions(0, j) += trig_buff->get_cos(rotations(j)) * speeds(j) * KINEMATIC_TIME_STEP;
+            positions(1, j) += trig_buff->get_sin(rotations(j)) * speeds(j) * KINEMATIC_TIME_STEP;
+        }
+        rotations += angular_velocities * KINEMATIC_TIME_STEP;
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Kinematic Steps: " << time_elapsed.count() << " us (" << positions.sum() << " summed)" <<
+                 std::endl;
+
+
+    TrigBuff::destroy_instance();
+}
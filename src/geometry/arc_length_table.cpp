@@ -0,0 +1,111 @@
+
+#include <ori/simcars/geometry/arc_length_table.hpp>
+
+#include <algorithm>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+ArcLengthTable::ArcLengthTable() : cumulative_lengths(1, 0.0f) {}
+
+ArcLengthTable::ArcLengthTable(Vecs const &points) : points(points)
+{
+    size_t const segment_count = points.cols() > 1 ? points.cols() - 1 : 0;
+
+    directions = Vecs::Zero(2, segment_count);
+    cumulative_lengths.resize(segment_count + 1);
+    cumulative_lengths[0] = 0.0f;
+
+    size_t i;
+    for (i = 0; i < segment_count; ++i)
+    {
+        Vec const segment = points.col(i + 1) - points.col(i);
+        FP_DATA_TYPE const segment_length = segment.norm();
+        if (segment_length > 0.0f)
+        {
+            directions.col(i) = segment / segment_length;
+        }
+        cumulative_lengths[i + 1] = cumulative_lengths[i] + segment_length;
+    }
+}
+
+size_t ArcLengthTable::get_segment_count() const
+{
+    return cumulative_lengths.size() - 1;
+}
+
+FP_DATA_TYPE ArcLengthTable::get_length() const
+{
+    return cumulative_lengths.back();
+}
+
+FP_DATA_TYPE ArcLengthTable::get_cumulative_length(size_t point_idx) const
+{
+    return cumulative_lengths[point_idx];
+}
+
+Vec ArcLengthTable::get_point(size_t point_idx) const
+{
+    return points.col(point_idx);
+}
+
+Vec ArcLengthTable::get_direction(size_t segment_idx) const
+{
+    return directions.col(segment_idx);
+}
+
+size_t ArcLengthTable::get_segment(FP_DATA_TYPE arc_position) const
+{
+    size_t const segment_idx =
+            std::upper_bound(cumulative_lengths.begin() + 1, cumulative_lengths.end(), arc_position) -
+            (cumulative_lengths.begin() + 1);
+    size_t const segment_count = get_segment_count();
+    return segment_count > 0 ? std::min(segment_idx, segment_count - 1) : 0;
+}
+
+FP_DATA_TYPE ArcLengthTable::project(Vec const &point) const
+{
+    size_t segment_idx;
+    return project(point, segment_idx);
+}
+
+FP_DATA_TYPE ArcLengthTable::project(Vec const &point, size_t &segment_idx) const
+{
+    return std::clamp(project_unclamped(point, segment_idx), FP_DATA_TYPE(0), get_length());
+}
+
+FP_DATA_TYPE ArcLengthTable::project_unclamped(Vec const &point, size_t &segment_idx) const
+{
+    size_t const segment_count = get_segment_count();
+    if (segment_count == 0)
+    {
+        segment_idx = 0;
+        return 0.0f;
+    }
+
+    // Segments behind the point end behind it, so the first segment ending ahead of it is found by bisection
+    size_t low = 0, high = segment_count - 1;
+    while (low < high)
+    {
+        size_t const mid = low + (high - low) / 2;
+        if (directions.col(mid).dot(point - points.col(mid + 1)) < 0.0f)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+    segment_idx = low;
+
+    return cumulative_lengths[segment_idx] + directions.col(segment_idx).dot(point - points.col(segment_idx));
+}
+
+}
+}
+}
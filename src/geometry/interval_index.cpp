@@ -0,0 +1,87 @@
+
+#include <ori/simcars/geometry/interval_index.hpp>
+
+#include <algorithm>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+IntervalIndex::IntervalIndex() {}
+
+size_t IntervalIndex::count() const
+{
+    return mins.size();
+}
+
+void IntervalIndex::get_indices_containing(FP_DATA_TYPE value, structures::IStackArray<size_t> *indices) const
+{
+    get_indices_overlapping(value, value, indices);
+}
+
+void IntervalIndex::get_indices_overlapping(FP_DATA_TYPE min, FP_DATA_TYPE max,
+                                            structures::IStackArray<size_t> *indices) const
+{
+    size_t const start = indices->count();
+
+    visit_indices_overlapping(
+                min, max,
+                [indices, start](size_t idx)
+                {
+                    indices->push_back(idx);
+                    size_t i;
+                    for (i = indices->count() - 1; i > start && (*indices)[i - 1] > idx; --i)
+                    {
+                        (*indices)[i] = (*indices)[i - 1];
+                    }
+                    (*indices)[i] = idx;
+                });
+}
+
+void IntervalIndex::reset(size_t count)
+{
+    mins.assign(count, 0.0f);
+    maxs.assign(count, 0.0f);
+    sorted_indices.clear();
+    sorted_mins.clear();
+    sorted_max_prefix_maxs.clear();
+}
+
+void IntervalIndex::set_interval(size_t idx, FP_DATA_TYPE min, FP_DATA_TYPE max)
+{
+    mins[idx] = min;
+    maxs[idx] = max;
+}
+
+void IntervalIndex::sort()
+{
+    sorted_indices.resize(mins.size());
+
+    size_t i;
+    for (i = 0; i < sorted_indices.size(); ++i)
+    {
+        sorted_indices[i] = i;
+    }
+
+    std::stable_sort(sorted_indices.begin(), sorted_indices.end(),
+                     [this](size_t idx_1, size_t idx_2)
+                     {
+                         return mins[idx_1] < mins[idx_2];
+                     });
+
+    sorted_mins.resize(sorted_indices.size());
+    sorted_max_prefix_maxs.resize(sorted_indices.size());
+    for (i = 0; i < sorted_indices.size(); ++i)
+    {
+        sorted_mins[i] = mins[sorted_indices[i]];
+        sorted_max_prefix_maxs[i] = i > 0 ? std::max(sorted_max_prefix_maxs[i - 1], maxs[sorted_indices[i]]) :
+                                            maxs[sorted_indices[i]];
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,277 @@
+
+#include <ori/simcars/geometry/o_box.hpp>
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define O_BOX_BATCH_BLOCK_SIZE 16
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+OBox OBox::create(Vec const &centre, FP_DATA_TYPE width, FP_DATA_TYPE height, FP_DATA_TYPE orientation,
+                  TrigBuff const *trig_buff)
+{
+    return OBox{centre.x(), centre.y(), 0.5f * width, 0.5f * height,
+                trig_buff->get_cos(orientation), trig_buff->get_sin(orientation)};
+}
+
+FP_DATA_TYPE OBox::calc_projected_half_extent(Vec const &axis) const
+{
+    return half_width * std::abs(axis.x() * cos_orientation + axis.y() * sin_orientation) +
+            half_height * std::abs(axis.y() * cos_orientation - axis.x() * sin_orientation);
+}
+
+bool OBox::check_collision(OBox const &o_box) const
+{
+    FP_DATA_TYPE const diff_x = o_box.centre_x - centre_x;
+    FP_DATA_TYPE const diff_y = o_box.centre_y - centre_y;
+
+    // Cosine and sine of the orientation of the other box relative to this one
+    FP_DATA_TYPE const cos_diff = std::abs(o_box.cos_orientation * cos_orientation +
+                                           o_box.sin_orientation * sin_orientation);
+    FP_DATA_TYPE const sin_diff = std::abs(o_box.sin_orientation * cos_orientation -
+                                           o_box.cos_orientation * sin_orientation);
+
+    // Boxes collide unless their projections are disjoint upon one of the four edge normals
+    return std::abs(diff_x * cos_orientation + diff_y * sin_orientation) <=
+            half_width + o_box.half_width * cos_diff + o_box.half_height * sin_diff &&
+            std::abs(diff_y * cos_orientation - diff_x * sin_orientation) <=
+            half_height + o_box.half_width * sin_diff + o_box.half_height * cos_diff &&
+            std::abs(diff_x * o_box.cos_orientation + diff_y * o_box.sin_orientation) <=
+            o_box.half_width + half_width * cos_diff + half_height * sin_diff &&
+            std::abs(diff_y * o_box.cos_orientation - diff_x * o_box.sin_orientation) <=
+            o_box.half_height + half_width * sin_diff + half_height * cos_diff;
+}
+
+// Narrows the interval of times over which the projections of two boxes overlap upon an axis, given the
+// separation of their centres, its rate of change and the sum of their projected half extents along the axis
+static void restrict_collision_interval(FP_DATA_TYPE separation, FP_DATA_TYPE separation_rate, FP_DATA_TYPE radius,
+                                        FP_DATA_TYPE &entry_time, FP_DATA_TYPE &exit_time)
+{
+    if (separation_rate == 0.0f)
+    {
+        if (std::abs(separation) > radius)
+        {
+            exit_time = -std::numeric_limits<FP_DATA_TYPE>::infinity();
+        }
+        return;
+    }
+
+    FP_DATA_TYPE const inverse_separation_rate = 1.0f / separation_rate;
+    FP_DATA_TYPE const time_1 = (-radius - separation) * inverse_separation_rate;
+    FP_DATA_TYPE const time_2 = (radius - separation) * inverse_separation_rate;
+    entry_time = std::max(entry_time, std::min(time_1, time_2));
+    exit_time = std::min(exit_time, std::max(time_1, time_2));
+}
+
+FP_DATA_TYPE OBox::calc_collision_time(OBox const &o_box, Vec const &relative_velocity) const
+{
+    FP_DATA_TYPE const diff_x = o_box.centre_x - centre_x;
+    FP_DATA_TYPE const diff_y = o_box.centre_y - centre_y;
+
+    FP_DATA_TYPE const cos_diff = std::abs(o_box.cos_orientation * cos_orientation +
+                                           o_box.sin_orientation * sin_orientation);
+    FP_DATA_TYPE const sin_diff = std::abs(o_box.sin_orientation * cos_orientation -
+                                           o_box.cos_orientation * sin_orientation);
+
+    // Boxes that keep their orientations touch exactly when their projections overlap upon all four edge normals,
+    // so the collision time is the start of the intersection of the intervals over which each pair overlaps
+    FP_DATA_TYPE entry_time = 0.0f;
+    FP_DATA_TYPE exit_time = std::numeric_limits<FP_DATA_TYPE>::infinity();
+    restrict_collision_interval(
+                diff_x * cos_orientation + diff_y * sin_orientation,
+                relative_velocity.x() * cos_orientation + relative_velocity.y() * sin_orientation,
+                half_width + o_box.half_width * cos_diff + o_box.half_height * sin_diff,
+                entry_time, exit_time);
+    restrict_collision_interval(
+                diff_y * cos_orientation - diff_x * sin_orientation,
+                relative_velocity.y() * cos_orientation - relative_velocity.x() * sin_orientation,
+                half_height + o_box.half_width * sin_diff + o_box.half_height * cos_diff,
+                entry_time, exit_time);
+    restrict_collision_interval(
+                diff_x * o_box.cos_orientation + diff_y * o_box.sin_orientation,
+                relative_velocity.x() * o_box.cos_orientation + relative_velocity.y() * o_box.sin_orientation,
+                o_box.half_width + half_width * cos_diff + half_height * sin_diff,
+                entry_time, exit_time);
+    restrict_collision_interval(
+                diff_y * o_box.cos_orientation - diff_x * o_box.sin_orientation,
+                relative_velocity.y() * o_box.cos_orientation - relative_velocity.x() * o_box.sin_orientation,
+                o_box.half_height + half_width * sin_diff + half_height * cos_diff,
+                entry_time, exit_time);
+
+    return entry_time <= exit_time ? entry_time : std::numeric_limits<FP_DATA_TYPE>::infinity();
+}
+
+OBoxBatch::OBoxBatch() {}
+
+size_t OBoxBatch::count() const
+{
+    return centre_xs.size();
+}
+
+OBox OBoxBatch::get_o_box(size_t idx) const
+{
+    return OBox{centre_xs[idx], centre_ys[idx], half_widths[idx], half_heights[idx],
+                cos_orientations[idx], sin_orientations[idx]};
+}
+
+void OBoxBatch::get_colliding_indices(OBox const &o_box, structures::IStackArray<size_t> *indices) const
+{
+    typedef Eigen::Map<Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> const> Column;
+    // Blocks are bounded in size so that they are evaluated on the stack
+    typedef Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1, Eigen::ColMajor, O_BOX_BATCH_BLOCK_SIZE, 1> Block;
+
+    size_t start, i;
+    for (start = 0; start < count(); start += O_BOX_BATCH_BLOCK_SIZE)
+    {
+        size_t const block_size = std::min(count() - start, size_t(O_BOX_BATCH_BLOCK_SIZE));
+
+        Column const other_centre_xs(centre_xs.data() + start, block_size);
+        Column const other_centre_ys(centre_ys.data() + start, block_size);
+        Column const other_half_widths(half_widths.data() + start, block_size);
+        Column const other_half_heights(half_heights.data() + start, block_size);
+        Column const other_coss(cos_orientations.data() + start, block_size);
+        Column const other_sins(sin_orientations.data() + start, block_size);
+
+        Block const diff_xs = other_centre_xs - o_box.centre_x;
+        Block const diff_ys = other_centre_ys - o_box.centre_y;
+        Block const cos_diffs = (other_coss * o_box.cos_orientation + other_sins * o_box.sin_orientation).abs();
+        Block const sin_diffs = (other_sins * o_box.cos_orientation - other_coss * o_box.sin_orientation).abs();
+
+        // Largest gap between the projections of the boxes over the four edge normals, positive when separated
+        Block const separations =
+                ((diff_xs * o_box.cos_orientation + diff_ys * o_box.sin_orientation).abs() -
+                 (o_box.half_width + other_half_widths * cos_diffs + other_half_heights * sin_diffs)).max(
+                ((diff_ys * o_box.cos_orientation - diff_xs * o_box.sin_orientation).abs() -
+                 (o_box.half_height + other_half_widths * sin_diffs + other_half_heights * cos_diffs))).max(
+                ((diff_xs * other_coss + diff_ys * other_sins).abs() -
+                 (other_half_widths + o_box.half_width * cos_diffs + o_box.half_height * sin_diffs))).max(
+                ((diff_ys * other_coss - diff_xs * other_sins).abs() -
+                 (other_half_heights + o_box.half_width * sin_diffs + o_box.half_height * cos_diffs)));
+
+        for (i = 0; i < block_size; ++i)
+        {
+            if (separations(i) <= 0.0f)
+            {
+                indices->push_back(start + i);
+            }
+        }
+    }
+}
+
+void OBoxBatch::get_collision_times(OBox const &o_box, Vec const &velocity,
+                                    structures::IStackArray<FP_DATA_TYPE> *collision_times) const
+{
+    typedef Eigen::Map<Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1> const> Column;
+    typedef Eigen::Array<FP_DATA_TYPE, Eigen::Dynamic, 1, Eigen::ColMajor, O_BOX_BATCH_BLOCK_SIZE, 1> Block;
+
+    FP_DATA_TYPE const infinity = std::numeric_limits<FP_DATA_TYPE>::infinity();
+
+    size_t start, i;
+    for (start = 0; start < count(); start += O_BOX_BATCH_BLOCK_SIZE)
+    {
+        size_t const block_size = std::min(count() - start, size_t(O_BOX_BATCH_BLOCK_SIZE));
+
+        Column const other_centre_xs(centre_xs.data() + start, block_size);
+        Column const other_centre_ys(centre_ys.data() + start, block_size);
+        Column const other_half_widths(half_widths.data() + start, block_size);
+        Column const other_half_heights(half_heights.data() + start, block_size);
+        Column const other_coss(cos_orientations.data() + start, block_size);
+        Column const other_sins(sin_orientations.data() + start, block_size);
+        Column const other_velocity_xs(velocity_xs.data() + start, block_size);
+        Column const other_velocity_ys(velocity_ys.data() + start, block_size);
+
+        Block const diff_xs = other_centre_xs - o_box.centre_x;
+        Block const diff_ys = other_centre_ys - o_box.centre_y;
+        Block const velocity_diff_xs = other_velocity_xs - velocity.x();
+        Block const velocity_diff_ys = other_velocity_ys - velocity.y();
+        Block const cos_diffs = (other_coss * o_box.cos_orientation + other_sins * o_box.sin_orientation).abs();
+        Block const sin_diffs = (other_sins * o_box.cos_orientation - other_coss * o_box.sin_orientation).abs();
+
+        Block entry_times = Block::Zero(block_size);
+        Block exit_times = Block::Constant(block_size, infinity);
+
+        // As restrict_collision_interval, with both branches evaluated and the pertinent one selected
+        auto restrict_collision_intervals = [&](Block const &separations, Block const &separation_rates,
+                Block const &radii)
+        {
+            Block const inverse_separation_rates = separation_rates.inverse();
+            Block const times_1 = (-radii - separations) * inverse_separation_rates;
+            Block const times_2 = (radii - separations) * inverse_separation_rates;
+            entry_times = (separation_rates != 0.0f).select(entry_times.max(times_1.min(times_2)), entry_times);
+            exit_times = (separation_rates != 0.0f).select(
+                        exit_times.min(times_1.max(times_2)),
+                        (separations.abs() <= radii).select(exit_times, -infinity));
+        };
+
+        restrict_collision_intervals(
+                    diff_xs * o_box.cos_orientation + diff_ys * o_box.sin_orientation,
+                    velocity_diff_xs * o_box.cos_orientation + velocity_diff_ys * o_box.sin_orientation,
+                    o_box.half_width + other_half_widths * cos_diffs + other_half_heights * sin_diffs);
+        restrict_collision_intervals(
+                    diff_ys * o_box.cos_orientation - diff_xs * o_box.sin_orientation,
+                    velocity_diff_ys * o_box.cos_orientation - velocity_diff_xs * o_box.sin_orientation,
+                    o_box.half_height + other_half_widths * sin_diffs + other_half_heights * cos_diffs);
+        restrict_collision_intervals(
+                    diff_xs * other_coss + diff_ys * other_sins,
+                    velocity_diff_xs * other_coss + velocity_diff_ys * other_sins,
+                    other_half_widths + o_box.half_width * cos_diffs + o_box.half_height * sin_diffs);
+        restrict_collision_intervals(
+                    diff_ys * other_coss - diff_xs * other_sins,
+                    velocity_diff_ys * other_coss - velocity_diff_xs * other_sins,
+                    other_half_heights + o_box.half_width * sin_diffs + o_box.half_height * cos_diffs);
+
+        for (i = 0; i < block_size; ++i)
+        {
+            collision_times->push_back(entry_times(i) <= exit_times(i) ? entry_times(i) : infinity);
+        }
+    }
+}
+
+void OBoxBatch::clear()
+{
+    centre_xs.clear();
+    centre_ys.clear();
+    half_widths.clear();
+    half_heights.clear();
+    cos_orientations.clear();
+    sin_orientations.clear();
+    velocity_xs.clear();
+    velocity_ys.clear();
+}
+
+void OBoxBatch::push_back(OBox const &o_box)
+{
+    centre_xs.push_back(o_box.centre_x);
+    centre_ys.push_back(o_box.centre_y);
+    half_widths.push_back(o_box.half_width);
+    half_heights.push_back(o_box.half_height);
+    cos_orientations.push_back(o_box.cos_orientation);
+    sin_orientations.push_back(o_box.sin_orientation);
+    velocity_xs.push_back(0.0f);
+    velocity_ys.push_back(0.0f);
+}
+
+void OBoxBatch::push_back(OBox const &o_box, Vec const &velocity)
+{
+    centre_xs.push_back(o_box.centre_x);
+    centre_ys.push_back(o_box.centre_y);
+    half_widths.push_back(o_box.half_width);
+    half_heights.push_back(o_box.half_height);
+    cos_orientations.push_back(o_box.cos_orientation);
+    sin_orientations.push_back(o_box.sin_orientation);
+    velocity_xs.push_back(velocity.x());
+    velocity_ys.push_back(velocity.y());
+}
+
+}
+}
+}
@@ -0,0 +1,152 @@
+
+#include <ori/simcars/geometry/sweep_and_prune.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+SweepAndPrune::SweepAndPrune() {}
+
+void SweepAndPrune::swap_ranks(size_t rank_1, size_t rank_2)
+{
+    std::swap(sorted_indices[rank_1], sorted_indices[rank_2]);
+    std::swap(sorted_xs[rank_1], sorted_xs[rank_2]);
+    ranks[sorted_indices[rank_1]] = rank_1;
+    ranks[sorted_indices[rank_2]] = rank_2;
+}
+
+size_t SweepAndPrune::count() const
+{
+    return positions.size();
+}
+
+Vec const& SweepAndPrune::get_position(size_t idx) const
+{
+    return positions[idx];
+}
+
+size_t SweepAndPrune::get_index(size_t rank) const
+{
+    return sorted_indices[rank];
+}
+
+FP_DATA_TYPE SweepAndPrune::get_x(size_t rank) const
+{
+    return sorted_xs[rank];
+}
+
+size_t SweepAndPrune::get_lower_bound_rank(FP_DATA_TYPE x) const
+{
+    return std::lower_bound(sorted_xs.begin(), sorted_xs.end(), x) - sorted_xs.begin();
+}
+
+void SweepAndPrune::get_indices_in_range(Vec const &point, FP_DATA_TYPE range,
+                                         structures::IStackArray<size_t> *indices) const
+{
+    // Indices are kept in ascending order, so candidates can be visited in the same order as a
+    // brute force pass would visit them
+    size_t const start = indices->count();
+
+    size_t rank, i;
+    for (rank = get_lower_bound_rank(point.x() - range);
+         rank < sorted_xs.size() && sorted_xs[rank] <= point.x() + range; ++rank)
+    {
+        size_t idx = sorted_indices[rank];
+        if (std::abs(positions[idx].y() - point.y()) <= range)
+        {
+            indices->push_back(idx);
+            for (i = indices->count() - 1; i > start && (*indices)[i - 1] > idx; --i)
+            {
+                (*indices)[i] = (*indices)[i - 1];
+            }
+            (*indices)[i] = idx;
+        }
+    }
+}
+
+void SweepAndPrune::reset(size_t count)
+{
+    if (count != positions.size())
+    {
+        positions.resize(count);
+        sorted_indices.resize(count);
+        ranks.resize(count);
+        sorted_xs.resize(count);
+
+        size_t i;
+        for (i = 0; i < count; ++i)
+        {
+            sorted_indices[i] = i;
+        }
+    }
+}
+
+void SweepAndPrune::set_position(size_t idx, Vec const &position)
+{
+    positions[idx] = position;
+}
+
+void SweepAndPrune::sort()
+{
+    // Insertion sort is close to linear when the ordering is retained from the previous time step,
+    // but give up on it if the ordering turns out to be far from sorted
+    size_t const shift_limit = 8 * positions.size();
+    size_t shifts = 0;
+
+    size_t i, j;
+    for (i = 1; i < sorted_indices.size() && shifts <= shift_limit; ++i)
+    {
+        size_t idx = sorted_indices[i];
+        FP_DATA_TYPE x = positions[idx].x();
+        for (j = i; j > 0 && positions[sorted_indices[j - 1]].x() > x; --j)
+        {
+            sorted_indices[j] = sorted_indices[j - 1];
+            ++shifts;
+        }
+        sorted_indices[j] = idx;
+    }
+
+    if (shifts > shift_limit)
+    {
+        std::sort(sorted_indices.begin(), sorted_indices.end(),
+                  [this](size_t idx_1, size_t idx_2)
+        {
+            return positions[idx_1].x() < positions[idx_2].x();
+        });
+    }
+
+    for (i = 0; i < sorted_indices.size(); ++i)
+    {
+        ranks[sorted_indices[i]] = i;
+        sorted_xs[i] = positions[sorted_indices[i]].x();
+    }
+}
+
+void SweepAndPrune::update_position(size_t idx, Vec const &position)
+{
+    positions[idx] = position;
+
+    size_t rank = ranks[idx];
+    sorted_xs[rank] = position.x();
+
+    while (rank > 0 && sorted_xs[rank - 1] > sorted_xs[rank])
+    {
+        swap_ranks(rank - 1, rank);
+        --rank;
+    }
+    while (rank + 1 < sorted_xs.size() && sorted_xs[rank + 1] < sorted_xs[rank])
+    {
+        swap_ranks(rank, rank + 1);
+        ++rank;
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,85 @@
+
+#include <ori/simcars/geometry/tri_batch.hpp>
+
+namespace ori
+{
+namespace simcars
+{
+namespace geometry
+{
+
+TriBatch::TriBatch() {}
+
+TriBatch::TriBatch(structures::IArray<Tri> const *tris)
+{
+    size_t const tri_count = tris->count();
+
+    size_t i, j, k;
+    for (j = 0; j < 3; ++j)
+    {
+        vertex_xs[j].resize(tri_count);
+        vertex_ys[j].resize(tri_count);
+        edge_normal_xs[j].resize(tri_count);
+        edge_normal_ys[j].resize(tri_count);
+    }
+
+    for (i = 0; i < tri_count; ++i)
+    {
+        Tri const &tri = (*tris)[i];
+        for (j = 0; j < 3; ++j)
+        {
+            k = (j + 1) % 3;
+            vertex_xs[j](i) = tri[j].x();
+            vertex_ys[j](i) = tri[j].y();
+            edge_normal_xs[j](i) = tri[j].y() - tri[k].y();
+            edge_normal_ys[j](i) = tri[k].x() - tri[j].x();
+        }
+    }
+}
+
+size_t TriBatch::count() const
+{
+    return vertex_xs[0].size();
+}
+
+bool TriBatch::check_encapsulation(Vec const &point) const
+{
+    if (count() == 0)
+    {
+        return false;
+    }
+
+    auto const dot_product_0 = (point.x() - vertex_xs[0]) * edge_normal_xs[0] +
+            (point.y() - vertex_ys[0]) * edge_normal_ys[0];
+    auto const dot_product_1 = (point.x() - vertex_xs[1]) * edge_normal_xs[1] +
+            (point.y() - vertex_ys[1]) * edge_normal_ys[1];
+    auto const dot_product_2 = (point.x() - vertex_xs[2]) * edge_normal_xs[2] +
+            (point.y() - vertex_ys[2]) * edge_normal_ys[2];
+
+    // A point is encapsulated when its dot products with the edge normals all share a sign, which is the case
+    // exactly when the smallest of them is non-negative or the largest is non-positive. Comparing them against zero,
+    // rather than the sign of their product, keeps products that underflow to -0 from counting as encapsulated.
+    return ((dot_product_0.min(dot_product_1).min(dot_product_2) >= 0) ||
+            (dot_product_0.max(dot_product_1).max(dot_product_2) <= 0)).any();
+}
+
+void TriBatch::check_encapsulation(Vecs const &points, Rect const &bounding_box,
+                                   structures::IStackArray<size_t> *encapsulated_point_indices) const
+{
+    Eigen::Array<bool, 1, Eigen::Dynamic> const within_bounds =
+            points.row(0).array() >= bounding_box.get_min_x() && points.row(0).array() <= bounding_box.get_max_x() &&
+            points.row(1).array() >= bounding_box.get_min_y() && points.row(1).array() <= bounding_box.get_max_y();
+
+    size_t i;
+    for (i = 0; i < size_t(points.cols()); ++i)
+    {
+        if (within_bounds(i) && check_encapsulation(points.col(i)))
+        {
+            encapsulated_point_indices->push_back(i);
+        }
+    }
+}
+
+}
+}
+}
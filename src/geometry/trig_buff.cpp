@@ -4,10 +4,12 @@
 
 #include <magic_enum.hpp>
 
+#include <algorithm>
 #include <string>
 #include <exception>
 #include <cmath>
 #include <cstdlib>
+#include <cstdint>
 
 namespace ori
 {
@@ -16,10 +18,11 @@ namespace simcars
 namespace geometry
 {
 
-TrigBuff *TrigBuff::instance = nullptr;
+std::atomic<TrigBuff*> TrigBuff::instance = nullptr;
 
-TrigBuff::TrigBuff(size_t num_bins, AngleType default_angle_type)
-    : num_bins(num_bins), default_angle_type(default_angle_type), radian_multi(num_bins / (2.0f * M_PI)), degree_multi(num_bins / 360.0f)
+TrigBuff::TrigBuff(size_t num_bins, AngleType default_angle_type, bool interpolated)
+    : num_bins(num_bins), default_angle_type(default_angle_type), interpolated(interpolated),
+      radian_multi(num_bins / (2.0f * M_PI)), degree_multi(num_bins / 360.0f)
 {
     if (num_bins < 1)
     {
@@ -34,15 +37,16 @@ TrigBuff::TrigBuff(size_t num_bins, AngleType default_angle_type)
                                     + std::to_string(magic_enum::enum_integer(default_angle_type)) + "'");
     }
 
-    sin_bins = new FP_DATA_TYPE[num_bins];
-    cos_bins = new FP_DATA_TYPE[num_bins];
-    tan_bins = new FP_DATA_TYPE[num_bins];
+    // The bin following the last repeats the first, so that interpolation never has to wrap
+    sin_bins = new FP_DATA_TYPE[num_bins + 1];
+    cos_bins = new FP_DATA_TYPE[num_bins + 1];
+    tan_bins = new FP_DATA_TYPE[num_bins + 1];
 
     FP_DATA_TYPE angle;
     size_t i;
-    for (i = 0; i < num_bins; ++i)
+    for (i = 0; i <= num_bins; ++i)
     {
-        angle = i * (2.0f * M_PI) / num_bins;
+        angle = (i % num_bins) * (2.0f * M_PI) / num_bins;
         sin_bins[i] = sin(angle);
         cos_bins[i] = cos(angle);
         tan_bins[i] = tan(angle);
@@ -56,18 +60,19 @@ TrigBuff::~TrigBuff()
     delete[] tan_bins;
 }
 
-TrigBuff const* TrigBuff::init_instance(size_t num_bins, AngleType default_angle_type)
+TrigBuff const* TrigBuff::init_instance(size_t num_bins, AngleType default_angle_type, bool interpolated)
 {
-    TrigBuff::instance = new TrigBuff(num_bins, default_angle_type);
-    return TrigBuff::instance;
+    TrigBuff *new_instance = new TrigBuff(num_bins, default_angle_type, interpolated);
+    TrigBuff::instance.store(new_instance, std::memory_order_release);
+    return new_instance;
 }
 
 void TrigBuff::destroy_instance()
 {
-    if (TrigBuff::instance != nullptr)
+    TrigBuff *current_instance = TrigBuff::instance.exchange(nullptr, std::memory_order_acq_rel);
+    if (current_instance != nullptr)
     {
-        delete TrigBuff::instance;
-        TrigBuff::instance = nullptr;
+        delete current_instance;
     }
     else
     {
@@ -75,6 +80,31 @@ void TrigBuff::destroy_instance()
     }
 }
 
+FP_DATA_TYPE TrigBuff::interpolate(FP_DATA_TYPE const *bins, FP_DATA_TYPE bin_position) const
+{
+    // Wrapped into [0, num_bins], the upper end only being reached through rounding
+    FP_DATA_TYPE const float_num_bins = num_bins;
+    FP_DATA_TYPE const wrapped_bin_position = bin_position - float_num_bins * std::floor(bin_position / float_num_bins);
+    size_t const idx = std::min(size_t(wrapped_bin_position), num_bins - 1);
+    FP_DATA_TYPE const weight = wrapped_bin_position - idx;
+    return bins[idx] + weight * (bins[idx + 1] - bins[idx]);
+}
+
+size_t TrigBuff::get_num_bins() const
+{
+    return num_bins;
+}
+
+AngleType TrigBuff::get_default_angle_type() const
+{
+    return default_angle_type;
+}
+
+bool TrigBuff::is_interpolated() const
+{
+    return interpolated;
+}
+
 FP_DATA_TYPE TrigBuff::wrap(FP_DATA_TYPE angle) const
 {
     if (std::isinf(angle))
@@ -125,10 +155,12 @@ FP_DATA_TYPE TrigBuff::get_sin(FP_DATA_TYPE angle) const
     switch (default_angle_type)
     {
     case AngleType::RADIANS:
+        if (interpolated) return interpolate(sin_bins, angle * radian_multi);
         if (angle < 0.0f) return get_sin(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f));
         return sin_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated) return interpolate(sin_bins, angle * degree_multi);
         if (angle < 0.0f) return get_sin(angle + 360.0f * (int(-angle / 360.0f) + 1.0f));
         return sin_bins[int(angle * degree_multi) % num_bins];
 
@@ -147,10 +179,12 @@ FP_DATA_TYPE TrigBuff::get_sin(FP_DATA_TYPE angle, AngleType angle_type) const
     switch (angle_type)
     {
     case AngleType::RADIANS:
+        if (interpolated) return interpolate(sin_bins, angle * radian_multi);
         if (angle < 0.0f) return get_sin(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f), angle_type);
         return sin_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated) return interpolate(sin_bins, angle * degree_multi);
         if (angle < 0.0f) return get_sin(angle + 360.0f * (int(-angle / 360.0f) + 1.0f), angle_type);
         return sin_bins[int(angle * degree_multi) % num_bins];
 
@@ -169,10 +203,12 @@ FP_DATA_TYPE TrigBuff::get_cos(FP_DATA_TYPE angle) const
     switch (default_angle_type)
     {
     case AngleType::RADIANS:
+        if (interpolated) return interpolate(cos_bins, angle * radian_multi);
         if (angle < 0.0f) return get_cos(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f));
         return cos_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated) return interpolate(cos_bins, angle * degree_multi);
         if (angle < 0.0f) return get_cos(angle + 360.0f * (int(-angle / 360.0f) + 1.0f));
         return cos_bins[int(angle * degree_multi) % num_bins];
 
@@ -191,10 +227,12 @@ FP_DATA_TYPE TrigBuff::get_cos(FP_DATA_TYPE angle, AngleType angle_type) const
     switch (angle_type)
     {
     case AngleType::RADIANS:
+        if (interpolated) return interpolate(cos_bins, angle * radian_multi);
         if (angle < 0.0f) return get_cos(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f), angle_type);
         return cos_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated) return interpolate(cos_bins, angle * degree_multi);
         if (angle < 0.0f) return get_cos(angle + 360.0f * (int(-angle / 360.0f) + 1.0f), angle_type);
         return cos_bins[int(angle * degree_multi) % num_bins];
 
@@ -213,10 +251,15 @@ FP_DATA_TYPE TrigBuff::get_tan(FP_DATA_TYPE angle) const
     switch (default_angle_type)
     {
     case AngleType::RADIANS:
+        // Interpolating tangents across their asymptotes would give nonsense
+        if (interpolated)
+            return interpolate(sin_bins, angle * radian_multi) / interpolate(cos_bins, angle * radian_multi);
         if (angle < 0.0f) return get_tan(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f));
         return tan_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated)
+            return interpolate(sin_bins, angle * degree_multi) / interpolate(cos_bins, angle * degree_multi);
         if (angle < 0.0f) return get_tan(angle + 360.0f * (int(-angle / 360.0f) + 1.0f));
         return tan_bins[int(angle * degree_multi) % num_bins];
 
@@ -235,10 +278,15 @@ FP_DATA_TYPE TrigBuff::get_tan(FP_DATA_TYPE angle, AngleType angle_type) const
     switch (angle_type)
     {
     case AngleType::RADIANS:
+        // Interpolating tangents across their asymptotes would give nonsense
+        if (interpolated)
+            return interpolate(sin_bins, angle * radian_multi) / interpolate(cos_bins, angle * radian_multi);
         if (angle < 0.0f) return get_tan(angle + (2.0f * M_PI) * (int(-angle / (2.0f * M_PI)) + 1.0f), angle_type);
         return tan_bins[int(angle * radian_multi) % num_bins];
 
     case AngleType::DEGREES:
+        if (interpolated)
+            return interpolate(sin_bins, angle * degree_multi) / interpolate(cos_bins, angle * degree_multi);
         if (angle < 0.0f) return get_tan(angle + 360.0f * (int(-angle / 360.0f) + 1.0f), angle_type);
         return tan_bins[int(angle * degree_multi) % num_bins];
 
@@ -265,6 +313,50 @@ RotMat TrigBuff::get_rot_mat(FP_DATA_TYPE angle, AngleType angle_type) const
     return rot_mat;
 }
 
+void TrigBuff::get_sin_cos(FP_DATA_TYPE const *angles, FP_DATA_TYPE *sins, FP_DATA_TYPE *coss, size_t count) const
+{
+    size_t i;
+
+    if (!interpolated)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            sins[i] = get_sin(angles[i]);
+            coss[i] = get_cos(angles[i]);
+        }
+        return;
+    }
+
+    FP_DATA_TYPE multi;
+    switch (default_angle_type)
+    {
+    case AngleType::RADIANS:
+        multi = radian_multi;
+        break;
+
+    case AngleType::DEGREES:
+        multi = degree_multi;
+        break;
+
+    default:
+        throw utils::NotImplementedException();
+    }
+
+    FP_DATA_TYPE const float_num_bins = num_bins;
+    int32_t const max_idx = int32_t(num_bins) - 1;
+
+    for (i = 0; i < count; ++i)
+    {
+        FP_DATA_TYPE const bin_position = angles[i] * multi;
+        FP_DATA_TYPE const wrapped_bin_position =
+                bin_position - float_num_bins * std::floor(bin_position / float_num_bins);
+        int32_t const idx = std::min(int32_t(wrapped_bin_position), max_idx);
+        FP_DATA_TYPE const weight = wrapped_bin_position - idx;
+        sins[i] = sin_bins[idx] + weight * (sin_bins[idx + 1] - sin_bins[idx]);
+        coss[i] = cos_bins[idx] + weight * (cos_bins[idx + 1] - cos_bins[idx]);
+    }
+}
+
 }
 }
 }
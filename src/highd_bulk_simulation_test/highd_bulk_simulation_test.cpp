@@ -3,10 +3,12 @@
 #include <ori/simcars/geometry/trig_buff.hpp>
 #include <ori/simcars/map/highd/highd_map.hpp>
 #include <ori/simcars/agent/driving_goal_extraction_scene.hpp>
+#include <ori/simcars/agent/driving_scene_fork.hpp>
 #include <ori/simcars/agent/basic_fp_action_sampler.hpp>
 #include <ori/simcars/agent/basic_driving_agent_controller.hpp>
 #include <ori/simcars/agent/basic_driving_simulator.hpp>
 #include <ori/simcars/agent/driving_simulation_scene.hpp>
+#include <ori/simcars/agent/driving_simulation_batch_runner.hpp>
 #include <ori/simcars/agent/highd/highd_scene.hpp>
 
 #include <iostream>
@@ -20,7 +22,7 @@
 using namespace ori::simcars;
 using namespace std::chrono;
 
-void simulate(agent::IDrivingScene const *simulated_scene)
+void check_simulation(agent::IDrivingScene const *simulated_scene)
 {
     structures::IArray<agent::IDrivingAgent const*> *driving_agents =
             simulated_scene->get_driving_agents();
@@ -196,14 +198,28 @@ int main(int argc, char *argv[])
         }
     }
 
-    delete driving_agents_with_actions;
-
     if (selected_action_goal_event == nullptr)
     {
+        delete driving_agents_with_actions;
         std::cerr << "Could not find action to replace" << std::endl;
         return -1;
     }
 
+    // Every scene simulated is a fork of this one, which is left as it is while they exist. The forks share the
+    // goals of the agents they do not edit, which the simulator propagates up to the end of the simulation, so they
+    // are propagated that far before the scene is forked.
+    for (i = 0; i < driving_agents_with_actions->count(); ++i)
+    {
+        agent::IDrivingAgent const *driving_agent_with_actions =
+                (*driving_agents_with_actions)[i];
+
+        driving_agent_with_actions->get_variable_parameter(
+                    driving_agent_with_actions->get_name() +
+                    ".aligned_linear_velocity.goal")->propogate_events_forward(next_action_time);
+    }
+
+    delete driving_agents_with_actions;
+
     std::random_device random_device;
     std::mt19937 randomness_generator(random_device());
     std::uniform_int_distribution<size_t> agent_selector(1, NUMBER_OF_AGENTS);
@@ -231,11 +247,12 @@ int main(int argc, char *argv[])
     structures::IArray<agent::IDrivingScene*> *scenes_with_actions =
             new structures::stl::STLStackArray<agent::IDrivingScene*>(NUMBER_OF_SCENES);
 
-    (*scenes_with_actions)[0] = scene_with_actions;
+    // The first scene keeps the original actions
+    (*scenes_with_actions)[0] = agent::DrivingSceneFork::construct_from(scene_with_actions);
 
     for (i = 1; i < NUMBER_OF_SCENES; ++i)
     {
-        agent::IDrivingScene *new_scene = scene_with_actions->driving_scene_deep_copy();
+        agent::IDrivingScene *new_scene = agent::DrivingSceneFork::construct_from(scene_with_actions);
 
         agent::IDrivingAgent *driving_agent_to_edit =
                 new_scene->get_mutable_driving_agent(
@@ -324,24 +341,30 @@ int main(int argc, char *argv[])
 
     delete simulated_agent_names;
 
-    std::cout << "Beginning simulation" << std::endl;
+    agent::DrivingSimulationBatchRunner batch_runner;
 
-    start_time = high_resolution_clock::now();
+    std::cout << "Beginning simulation (" << batch_runner.get_thread_count() << " threads)" << std::endl;
 
+    agent::DrivingSimulationBatchResult batch_result =
+            batch_runner.run(simulated_scenes, simulation_start_time, simulation_end_time);
+
+    microseconds max_scene_time_elapsed(0);
+    microseconds total_scene_time_elapsed(0);
     for (i = 0; i < NUMBER_OF_SCENES; ++i)
     {
-        simulate((*simulated_scenes)[i]);
+        max_scene_time_elapsed = std::max(max_scene_time_elapsed, batch_result.scene_wall_times[i]);
+        total_scene_time_elapsed += batch_result.scene_wall_times[i];
     }
 
-    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Finished simulation (" << batch_result.wall_time.count() << " μs, mean scene time = " <<
+                 total_scene_time_elapsed.count() / NUMBER_OF_SCENES << " μs, max scene time = " <<
+                 max_scene_time_elapsed.count() << " μs, rtf = " << batch_result.get_real_time_factor() << ")" <<
+                 std::endl;
 
-    temporal::Duration simulation_time_covered = simulation_end_time - simulation_start_time;
-    float real_time_factor =
-            NUMBER_OF_SCENES *
-            float(duration_cast<microseconds>(simulation_time_covered).count()) /
-            float(time_elapsed.count());
-
-    std::cout << "Finished simulation (" << time_elapsed.count() << " μs, rtf = " << real_time_factor << ")" << std::endl;
+    for (i = 0; i < NUMBER_OF_SCENES; ++i)
+    {
+        check_simulation((*simulated_scenes)[i]);
+    }
 
     for (i = 0; i < NUMBER_OF_SCENES; ++i)
     {
@@ -351,6 +374,8 @@ int main(int argc, char *argv[])
     delete simulated_scenes;
     delete scenes_with_actions;
 
+    // Forks are all deleted before the scene they were forked from
+    delete scene_with_actions;
     delete scene;
 
     delete driving_simulator;
@@ -3,10 +3,12 @@
 #include <ori/simcars/geometry/trig_buff.hpp>
 #include <ori/simcars/map/highd/highd_map.hpp>
 #include <ori/simcars/agent/driving_goal_extraction_scene.hpp>
+#include <ori/simcars/agent/driving_scene_fork.hpp>
 #include <ori/simcars/agent/basic_fp_action_sampler.hpp>
 #include <ori/simcars/agent/basic_driving_agent_controller.hpp>
 #include <ori/simcars/agent/basic_driving_simulator.hpp>
 #include <ori/simcars/agent/driving_simulation_scene.hpp>
+#include <ori/simcars/agent/driving_simulation_batch_runner.hpp>
 #include <ori/simcars/agent/highd/highd_scene.hpp>
 
 #include <rapidjson/document.h>
@@ -24,7 +26,7 @@
 using namespace ori::simcars;
 using namespace std::chrono;
 
-void simulate(agent::IDrivingScene const *simulated_scene)
+void check_simulation(agent::IDrivingScene const *simulated_scene)
 {
     structures::IArray<agent::IDrivingAgent const*> *driving_agents =
             simulated_scene->get_driving_agents();
@@ -268,7 +270,7 @@ int main(int argc, char *argv[])
     size_t i;
     for (i = 1; i < NUMBER_OF_SCENES; ++i)
     {
-        agent::IDrivingScene *new_scene = scene_with_actions->driving_scene_deep_copy();
+        agent::IDrivingScene *new_scene = agent::DrivingSceneFork::construct_from(scene_with_actions);
 
         agent::IDrivingAgent *driving_agent_to_edit =
                 new_scene->get_mutable_driving_agent(
@@ -360,26 +362,31 @@ int main(int argc, char *argv[])
 
     delete simulated_agent_names;
 
-    std::cout << "Beginning simulation" << std::endl;
+    agent::DrivingSimulationBatchRunner batch_runner;
 
-    start_time = high_resolution_clock::now();
+    std::cout << "Beginning simulation (" << batch_runner.get_thread_count() << " threads)" << std::endl;
+
+    agent::DrivingSimulationBatchResult batch_result =
+            batch_runner.run(simulated_scenes, simulation_start_time, simulation_end_time);
 
+    microseconds max_scene_time_elapsed(0);
+    microseconds total_scene_time_elapsed(0);
     for (i = 0; i < NUMBER_OF_SCENES; ++i)
     {
-        simulate((*simulated_scenes)[i]);
+        max_scene_time_elapsed = std::max(max_scene_time_elapsed, batch_result.scene_wall_times[i]);
+        total_scene_time_elapsed += batch_result.scene_wall_times[i];
     }
 
-    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
-
-    temporal::Duration simulation_time_covered = simulation_end_time - simulation_start_time;
-    float real_time_factor =
-            NUMBER_OF_SCENES *
-            float(duration_cast<microseconds>(simulation_time_covered).count()) /
-            float(time_elapsed.count());
+    std::cout << "Finished simulation (actual time = " << batch_result.wall_time.count() << " μs, simulated time = " <<
+                 duration_cast<microseconds>(batch_result.simulated_time).count() << " μs, mean scene time = " <<
+                 total_scene_time_elapsed.count() / NUMBER_OF_SCENES << " μs, max scene time = " <<
+                 max_scene_time_elapsed.count() << " μs, rtf = " << batch_result.get_real_time_factor() << ")" <<
+                 std::endl;
 
-    std::cout << "Finished simulation (actual time = " << time_elapsed.count() << " μs, simulated time = " <<
-                 duration_cast<microseconds>(simulation_time_covered).count() << " μs, rtf = " <<
-                 real_time_factor << ")" << std::endl;
+    for (i = 0; i < NUMBER_OF_SCENES; ++i)
+    {
+        check_simulation((*simulated_scenes)[i]);
+    }
 
     for (i = 0; i < NUMBER_OF_SCENES; ++i)
     {
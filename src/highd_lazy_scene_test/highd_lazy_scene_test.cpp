@@ -0,0 +1,175 @@
+
+#include <ori/simcars/geometry/trig_buff.hpp>
+#include <ori/simcars/agent/lazy_driving_scene.hpp>
+#include <ori/simcars/agent/highd/highd_lazy_driving_agent_source.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <exception>
+
+using namespace ori::simcars;
+
+// Borrows every agent in turn, reading its position at its first time step, and checks that the agents decoded never
+// exceed the memory budget once each borrow has gone out of scope
+static bool check_budget_eviction(agent::LazyDrivingScene const *scene,
+                                  std::vector<agent::LazyDrivingAgent const*> const &driving_agents,
+                                  size_t &evicted_count)
+{
+    size_t i;
+    for (i = 0; i < driving_agents.size(); ++i)
+    {
+        {
+            agent::LazyDrivingAgentBorrow driving_agent_borrow(driving_agents[i]);
+            agent::IDrivingAgent const *driving_agent = driving_agent_borrow.get_driving_agent();
+            geometry::Vec position;
+            driving_agent->get_position_variable()->get_value(driving_agent->get_min_temporal_limit(), position);
+        }
+
+        if (scene->get_materialised_size() > scene->get_memory_budget())
+        {
+            std::cerr << "Decoded agents exceed memory budget after borrowing " << driving_agents[i]->get_name() <<
+                         ": " << scene->get_materialised_size() << " > " << scene->get_memory_budget() << std::endl;
+            return false;
+        }
+    }
+
+    evicted_count = 0;
+    for (i = 0; i < driving_agents.size(); ++i)
+    {
+        if (!driving_agents[i]->is_materialised())
+        {
+            ++evicted_count;
+        }
+    }
+
+    return true;
+}
+
+// Keeps the first agent borrowed while every other agent is borrowed in turn, and checks that it is neither evicted
+// nor decoded again in the meantime
+static bool check_borrowed_retention(std::vector<agent::LazyDrivingAgent const*> const &driving_agents)
+{
+    agent::LazyDrivingAgentBorrow held_driving_agent_borrow(driving_agents[0]);
+
+    size_t i;
+    for (i = 1; i < driving_agents.size(); ++i)
+    {
+        {
+            agent::LazyDrivingAgentBorrow driving_agent_borrow(driving_agents[i]);
+        }
+
+        if (!driving_agents[0]->is_materialised())
+        {
+            std::cerr << "Borrowed agent " << driving_agents[0]->get_name() << " evicted after borrowing " <<
+                         driving_agents[i]->get_name() << std::endl;
+            return false;
+        }
+    }
+
+    agent::LazyDrivingAgentBorrow driving_agent_borrow(driving_agents[0]);
+    if (driving_agent_borrow.get_driving_agent() != held_driving_agent_borrow.get_driving_agent())
+    {
+        std::cerr << "Borrowed agent " << driving_agents[0]->get_name() << " decoded again while borrowed" <<
+                     std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: ./highd_lazy_scene_test tracks_meta_file_path tracks_file_path [memory_budget]" <<
+                     std::endl;
+        return -1;
+    }
+
+    geometry::TrigBuff::init_instance(360000, geometry::AngleType::RADIANS);
+
+    std::cout << "Beginning source load" << std::endl;
+
+    std::shared_ptr<agent::highd::HighDLazyDrivingAgentSource const> driving_agent_source;
+
+    try
+    {
+        driving_agent_source = agent::highd::HighDLazyDrivingAgentSource::load(argv[1], argv[2]);
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Exception occured during source load:" << std::endl << e.what() << std::endl;
+        return -1;
+    }
+
+    std::cout << "Finished source load" << std::endl;
+
+    if (driving_agent_source->get_driving_agent_count() < 2)
+    {
+        std::cerr << "Recording must contain at least two agents" << std::endl;
+        return -1;
+    }
+
+    // By default the budget only fits the two largest agents, so that borrowing every agent has to evict some
+    size_t memory_budget;
+    if (argc > 3)
+    {
+        memory_budget = std::stoull(argv[3]);
+    }
+    else
+    {
+        size_t max_frame_count = 0;
+
+        size_t i;
+        for (i = 0; i < driving_agent_source->get_driving_agent_count(); ++i)
+        {
+            max_frame_count = std::max(driving_agent_source->get_driving_agent_entry(i).frame_count,
+                                       max_frame_count);
+        }
+
+        memory_budget = 2 * max_frame_count * LAZY_DRIVING_AGENT_BYTES_PER_FRAME;
+    }
+
+    agent::LazyDrivingScene *scene = agent::LazyDrivingScene::construct_from(driving_agent_source, memory_budget);
+
+    structures::IArray<agent::IDrivingAgent const*> *scene_driving_agents = scene->get_driving_agents();
+    std::vector<agent::LazyDrivingAgent const*> driving_agents;
+
+    size_t i;
+    for (i = 0; i < scene_driving_agents->count(); ++i)
+    {
+        driving_agents.push_back(dynamic_cast<agent::LazyDrivingAgent const*>((*scene_driving_agents)[i]));
+    }
+
+    delete scene_driving_agents;
+
+    bool passed = true;
+
+    size_t evicted_count;
+    if (check_budget_eviction(scene, driving_agents, evicted_count))
+    {
+        std::cout << "Budget eviction passed, " << evicted_count << " of " << driving_agents.size() <<
+                     " agents evicted with a budget of " << memory_budget << " bytes" << std::endl;
+    }
+    else
+    {
+        passed = false;
+    }
+
+    if (check_borrowed_retention(driving_agents))
+    {
+        std::cout << "Borrowed retention passed" << std::endl;
+    }
+    else
+    {
+        passed = false;
+    }
+
+    delete scene;
+
+    geometry::TrigBuff::destroy_instance();
+
+    return passed ? 0 : -1;
+}
@@ -26,7 +26,7 @@ int main(int argc, char *argv[])
 
     try
     {
-        map = map::lyft::LyftMap::load(argv[1]);
+        map = map::lyft::LyftMap::load_cached(argv[1]);
     }
     catch (std::exception const &e)
     {
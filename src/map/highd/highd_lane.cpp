@@ -46,6 +46,8 @@ HighDLane::HighDLane(uint8_t id, IMap<uint8_t> const *map, FP_DATA_TYPE upper_bo
         right_boundary(1, 1) = lower_bound;
     }
 
+    left_boundary_arc_lengths = geometry::ArcLengthTable(left_boundary);
+
     centroid(0) = 210.0f;
     centroid(1) = (upper_bound + lower_bound) / 2.0f;
 
@@ -54,6 +56,7 @@ HighDLane::HighDLane(uint8_t id, IMap<uint8_t> const *map, FP_DATA_TYPE upper_bo
     tris->push_back(tri_1);
     geometry::Tri tri_2(right_boundary.col(0), right_boundary.col(1), left_boundary.col(1));
     tris->push_back(tri_2);
+    tri_batch = geometry::TriBatch(tris);
 
     bounding_box = geometry::Rect(-40.0f, upper_bound, 460.0f, lower_bound);
 
@@ -87,6 +90,11 @@ geometry::Vecs const& HighDLane::get_right_boundary() const
     return right_boundary;
 }
 
+geometry::ArcLengthTable const& HighDLane::get_left_boundary_arc_lengths() const
+{
+    return left_boundary_arc_lengths;
+}
+
 structures::IArray<geometry::Tri> const* HighDLane::get_tris() const
 {
     return tris;
@@ -94,18 +102,13 @@ structures::IArray<geometry::Tri> const* HighDLane::get_tris() const
 
 bool HighDLane::check_encapsulation(geometry::Vec const &point) const
 {
-    if (bounding_box.check_encapsulation(point))
-    {
-        size_t i;
-        for (i = 0; i < tris->count(); ++i)
-        {
-            if ((*tris)[i].check_encapsulation(point))
-            {
-                return true;
-            }
-        }
-    }
-    return false;
+    return bounding_box.check_encapsulation(point) && tri_batch.check_encapsulation(point);
+}
+
+void HighDLane::check_encapsulation(geometry::Vecs const &points,
+                                    structures::IStackArray<size_t> *encapsulated_point_indices) const
+{
+    tri_batch.check_encapsulation(points, bounding_box, encapsulated_point_indices);
 }
 
 geometry::Vec const& HighDLane::get_centroid() const
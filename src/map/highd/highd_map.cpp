@@ -107,6 +107,24 @@ void HighDMap::load_virt(std::ifstream &input_filestream)
                                 new HighDLane(lane_id, this, lower_lane_markings[i], lower_lane_markings[i + 1],
                                               false, left_adjacent_lane_id, right_adjacent_lane_id));
     }
+
+    build_lane_index();
+}
+
+void HighDMap::build_lane_index()
+{
+    structures::IArray<HighDLane*> const *lane_array =
+            id_to_lane_dict->get_values();
+
+    indexed_lanes.resize(lane_array->count());
+    lane_index.reset(lane_array->count());
+    for (size_t i = 0; i < lane_array->count(); ++i)
+    {
+        indexed_lanes[i] = (*lane_array)[i];
+        geometry::Rect const &lane_bounding_box = indexed_lanes[i]->get_bounding_box();
+        lane_index.set_interval(i, lane_bounding_box.get_min_y(), lane_bounding_box.get_max_y());
+    }
+    lane_index.sort();
 }
 
 HighDMap::~HighDMap()
@@ -145,18 +163,57 @@ ILane<uint8_t> const* HighDMap::get_lane(uint8_t id) const
 ILaneArray<uint8_t> const* HighDMap::get_encapsulating_lanes(geometry::Vec point) const
 {
     map::LivingLaneStackArray<uint8_t> *encapsulating_lanes = new map::LivingLaneStackArray<uint8_t>;
+    get_encapsulating_lanes(point, encapsulating_lanes);
+    return encapsulating_lanes;
+}
 
-    structures::IArray<HighDLane*> const *lane_array =
-            id_to_lane_dict->get_values();
-    for (size_t i = 0; i < lane_array->count(); ++i)
+void HighDMap::get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<uint8_t> const*> *lanes) const
+{
+    // Maps are shared between threads, hence the indices being per thread, their storage is retained between calls
+    thread_local structures::stl::STLStackArray<size_t> lane_idxs;
+
+    lanes->clear();
+
+    // Indices are taken in ascending order, so lanes come back in the order of the lane dictionary whichever of them
+    // are found
+    lane_idxs.clear();
+    lane_index.get_indices_containing(point.y(), &lane_idxs);
+
+    size_t i;
+    for (i = 0; i < lane_idxs.count(); ++i)
     {
-        if ((*lane_array)[i]->check_encapsulation(point))
+        HighDLane const *lane = indexed_lanes[lane_idxs[i]];
+        if (lane->check_encapsulation(point))
         {
-            encapsulating_lanes->push_back((*lane_array)[i]);
+            lanes->push_back(lane);
         }
     }
+}
 
-    return encapsulating_lanes;
+void HighDMap::get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                             structures::IStackArray<ILane<uint8_t> const*> *lanes) const
+{
+    thread_local structures::stl::STLStackArray<size_t> point_idxs;
+
+    lanes->clear();
+    lanes->resize(points.cols());
+
+    // Maps hold few lanes, so each is tested against every point, the bounding box pass of the lane rejecting most of
+    // them, in the order get_encapsulating_lanes takes them
+    size_t i, j;
+    for (i = 0; i < indexed_lanes.size(); ++i)
+    {
+        HighDLane const *lane = indexed_lanes[i];
+        point_idxs.clear();
+        lane->check_encapsulation(points, &point_idxs);
+        for (j = 0; j < point_idxs.count(); ++j)
+        {
+            if ((*lanes)[point_idxs[j]] == nullptr)
+            {
+                (*lanes)[point_idxs[j]] = lane;
+            }
+        }
+    }
 }
 
 ILaneArray<uint8_t> const* HighDMap::get_lanes(structures::IArray<uint8_t> const *ids) const
@@ -175,14 +232,21 @@ ILaneArray<uint8_t> const* HighDMap::get_lanes(structures::IArray<uint8_t> const
 
 ILaneArray<uint8_t> const* HighDMap::get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const
 {
-    // WARNING: This doesn't actually calculate which lanes are in range, it just returns them all,
-    // mainly because the primary use of this method is for rendering, and nearly all the High-D scenes
-    // are comprised of ~6 lanes which are always in view simultaneously
-    structures::IArray<HighDLane*> const *lane_array =
-            id_to_lane_dict->get_values();
-    ILaneArray<uint8_t> *lanes =
-            new LivingLaneStackArray<uint8_t>(id_to_lane_dict->count());
-    cast_array<HighDLane*, ILane<uint8_t> const*>(*lane_array, *lanes);
+    LivingLaneStackArray<uint8_t> *lanes = new LivingLaneStackArray<uint8_t>;
+
+    structures::stl::STLStackArray<size_t> lane_idxs;
+    lane_index.get_indices_overlapping(point.y() - distance, point.y() + distance, &lane_idxs);
+    for (size_t i = 0; i < lane_idxs.count(); ++i)
+    {
+        HighDLane const *lane = indexed_lanes[lane_idxs[i]];
+        geometry::Rect const &lane_bounding_box = lane->get_bounding_box();
+        if (lane_bounding_box.get_min_x() <= point.x() + distance &&
+                lane_bounding_box.get_max_x() >= point.x() - distance)
+        {
+            lanes->push_back(lane);
+        }
+    }
+
     return lanes;
 }
 
@@ -231,6 +295,8 @@ HighDMap* HighDMap::shallow_copy() const
 
     map_copy->stray_ghosts = new structures::stl::STLSet<IMapObject<uint8_t> const*>(this->stray_ghosts);
 
+    map_copy->build_lane_index();
+
     return map_copy;
 }
 
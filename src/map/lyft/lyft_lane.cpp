@@ -38,7 +38,7 @@ LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, rapidjso
             current_link_normalized = current_link.normalized();
             if (i > 1)
             {
-                FP_DATA_TYPE link_dot_product = std::max(std::min(current_link_normalized.dot(previous_link_normalized), 1.0f), -1.0f);
+                FP_DATA_TYPE link_dot_product = std::max(std::min(current_link_normalized.dot(previous_link_normalized), FP_DATA_TYPE(1)), FP_DATA_TYPE(-1));
                 FP_DATA_TYPE angle_mag = std::acos(link_dot_product);
                 FP_DATA_TYPE angle;
                 if (current_link_normalized.dot(trig_buff->get_rot_mat(angle_mag) * previous_link_normalized) >=
@@ -80,7 +80,7 @@ LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, rapidjso
             current_link_normalized = current_link.normalized();
             if (i > 1)
             {
-                FP_DATA_TYPE link_dot_product = std::max(std::min(current_link_normalized.dot(previous_link_normalized), 1.0f), -1.0f);
+                FP_DATA_TYPE link_dot_product = std::max(std::min(current_link_normalized.dot(previous_link_normalized), FP_DATA_TYPE(1)), FP_DATA_TYPE(-1));
                 FP_DATA_TYPE angle_mag = std::acos(link_dot_product);
                 FP_DATA_TYPE angle;
                 if (current_link_normalized.dot(trig_buff->get_rot_mat(angle_mag) * previous_link_normalized) >=
@@ -132,6 +132,7 @@ LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, rapidjso
             ++j;
         }
     }
+    tri_batch = geometry::TriBatch(tris);
 
 
     rapidjson::Value::ConstArray const &centroid_data = json_lane_data["aerial_centroid"].GetArray();
@@ -146,6 +147,9 @@ LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, rapidjso
             bounding_box_data[2].GetDouble(), bounding_box_data[3].GetDouble());
 
 
+    left_boundary_arc_lengths = geometry::ArcLengthTable(left_boundary);
+
+
     access_restriction = AccessRestriction(json_lane_data["access_restriction"].GetInt());
 
     std::string const left_adjacent_lane_id(json_lane_data["adjacent_left_id"].GetString(), json_lane_data["adjacent_left_id"].GetStringLength());
@@ -216,6 +220,141 @@ LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, rapidjso
     set_traffic_lights(traffic_lights);
 }
 
+LyftLane::LyftLane(std::string const &id, IMap<std::string> const *map, LyftMapCacheFile const &cache_file,
+                   LyftMapCacheLaneEntry const &cache_lane_entry) :
+    ALivingLane(id, map)
+{
+    size_t i;
+
+    LyftMapCachePoint const *left_boundary_data =
+            cache_file.get_elements<LyftMapCachePoint>(LyftMapCacheSection::POINTS, cache_lane_entry.left_boundary);
+    size_t const left_boundary_size = cache_lane_entry.left_boundary.count;
+    left_boundary = geometry::Vecs::Zero(2, left_boundary_size);
+
+    for (i = 0; i < left_boundary_size; ++i)
+    {
+        left_boundary(0, i) = left_boundary_data[i].x;
+        left_boundary(1, i) = left_boundary_data[i].y;
+    }
+
+    LyftMapCachePoint const *right_boundary_data =
+            cache_file.get_elements<LyftMapCachePoint>(LyftMapCacheSection::POINTS, cache_lane_entry.right_boundary);
+    size_t const right_boundary_size = cache_lane_entry.right_boundary.count;
+    right_boundary = geometry::Vecs::Zero(2, right_boundary_size);
+
+    for (i = 0; i < right_boundary_size; ++i)
+    {
+        right_boundary(0, i) = right_boundary_data[i].x;
+        right_boundary(1, i) = right_boundary_data[i].y;
+    }
+
+    mean_steer = cache_lane_entry.mean_steer;
+
+
+    point_count = left_boundary_size + right_boundary_size;
+
+
+    LyftMapCacheTri const *tri_data =
+            cache_file.get_elements<LyftMapCacheTri>(LyftMapCacheSection::TRIS, cache_lane_entry.tris);
+    size_t const tri_count = cache_lane_entry.tris.count;
+    tris = new structures::stl::STLStackArray<geometry::Tri>(tri_count);
+
+    for (i = 0; i < tri_count; ++i)
+    {
+        (*tris)[i] = geometry::Tri(geometry::Vec(tri_data[i].points[0].x, tri_data[i].points[0].y),
+                                   geometry::Vec(tri_data[i].points[1].x, tri_data[i].points[1].y),
+                                   geometry::Vec(tri_data[i].points[2].x, tri_data[i].points[2].y));
+    }
+    tri_batch = geometry::TriBatch(tris);
+
+
+    centroid(0) = cache_lane_entry.centroid.x;
+    centroid(1) = cache_lane_entry.centroid.y;
+
+
+    bounding_box = geometry::Rect(cache_lane_entry.bounding_box[0], cache_lane_entry.bounding_box[1],
+            cache_lane_entry.bounding_box[2], cache_lane_entry.bounding_box[3]);
+
+
+    left_boundary_arc_lengths = geometry::ArcLengthTable(left_boundary);
+
+
+    access_restriction = AccessRestriction(cache_lane_entry.access_restriction);
+
+    std::string const left_adjacent_lane_id = cache_file.get_string(cache_lane_entry.left_adjacent_lane_id);
+    if (left_adjacent_lane_id != "")
+    {
+        ILane *left_adjacent_lane = new GhostLane<std::string>(left_adjacent_lane_id, map);
+        set_left_adjacent_lane(left_adjacent_lane);
+        map->register_stray_ghost(left_adjacent_lane);
+    }
+    else
+    {
+        set_left_adjacent_lane(nullptr);
+    }
+
+    std::string const right_adjacent_lane_id = cache_file.get_string(cache_lane_entry.right_adjacent_lane_id);
+    if (right_adjacent_lane_id != "")
+    {
+        ILane *right_adjacent_lane = new GhostLane<std::string>(right_adjacent_lane_id, map);
+        set_right_adjacent_lane(right_adjacent_lane);
+        map->register_stray_ghost(right_adjacent_lane);
+    }
+    else
+    {
+        set_right_adjacent_lane(nullptr);
+    }
+
+
+    LyftMapCacheStringRef const *fore_lane_data =
+            cache_file.get_elements<LyftMapCacheStringRef>(LyftMapCacheSection::STRING_REFS,
+                                                           cache_lane_entry.fore_lane_ids);
+    size_t const fore_lane_count = cache_lane_entry.fore_lane_ids.count;
+    structures::stl::STLStackArray<std::string>* const fore_lane_ids =
+            new structures::stl::STLStackArray<std::string>(fore_lane_count);
+
+    for (i = 0; i < fore_lane_count; ++i)
+    {
+        (*fore_lane_ids)[i] = cache_file.get_string(fore_lane_data[i]);
+    }
+
+    ILaneArray<std::string> const* const fore_lanes = new GhostLaneArray<std::string>(fore_lane_ids, map);
+    set_fore_lanes(fore_lanes);
+
+
+    LyftMapCacheStringRef const *aft_lane_data =
+            cache_file.get_elements<LyftMapCacheStringRef>(LyftMapCacheSection::STRING_REFS,
+                                                           cache_lane_entry.aft_lane_ids);
+    size_t const aft_lane_count = cache_lane_entry.aft_lane_ids.count;
+    structures::stl::STLStackArray<std::string>* const aft_lane_ids =
+            new structures::stl::STLStackArray<std::string>(aft_lane_count);
+
+    for (i = 0; i < aft_lane_count; ++i)
+    {
+        (*aft_lane_ids)[i] = cache_file.get_string(aft_lane_data[i]);
+    }
+
+    ILaneArray<std::string> const* const aft_lanes = new GhostLaneArray<std::string>(aft_lane_ids, map);
+    set_aft_lanes(aft_lanes);
+
+
+    LyftMapCacheStringRef const *traffic_light_data =
+            cache_file.get_elements<LyftMapCacheStringRef>(LyftMapCacheSection::STRING_REFS,
+                                                           cache_lane_entry.traffic_light_ids);
+    size_t const traffic_light_count = cache_lane_entry.traffic_light_ids.count;
+    structures::stl::STLStackArray<std::string>* const traffic_light_ids =
+            new structures::stl::STLStackArray<std::string>(traffic_light_count);
+
+    for (i = 0; i < traffic_light_count; ++i)
+    {
+        (*traffic_light_ids)[i] = cache_file.get_string(traffic_light_data[i]);
+    }
+
+    ITrafficLightArray<std::string> const* const traffic_lights =
+            new GhostTrafficLightArray<std::string>(traffic_light_ids, map);
+    set_traffic_lights(traffic_lights);
+}
+
 LyftLane::~LyftLane()
 {
     delete tris;
@@ -231,6 +370,11 @@ geometry::Vecs const& LyftLane::get_right_boundary() const
     return right_boundary;
 }
 
+geometry::ArcLengthTable const& LyftLane::get_left_boundary_arc_lengths() const
+{
+    return left_boundary_arc_lengths;
+}
+
 structures::IArray<geometry::Tri> const* LyftLane::get_tris() const
 {
     return tris;
@@ -238,18 +382,13 @@ structures::IArray<geometry::Tri> const* LyftLane::get_tris() const
 
 bool LyftLane::check_encapsulation(geometry::Vec const &point) const
 {
-    if (bounding_box.check_encapsulation(point))
-    {
-        size_t i;
-        for (i = 0; i < tris->count(); ++i)
-        {
-            if ((*tris)[i].check_encapsulation(point))
-            {
-                return true;
-            }
-        }
-    }
-    return false;
+    return bounding_box.check_encapsulation(point) && tri_batch.check_encapsulation(point);
+}
+
+void LyftLane::check_encapsulation(geometry::Vecs const &points,
+                                   structures::IStackArray<size_t> *encapsulated_point_indices) const
+{
+    tri_batch.check_encapsulation(points, bounding_box, encapsulated_point_indices);
 }
 
 geometry::Vec const& LyftLane::get_centroid() const
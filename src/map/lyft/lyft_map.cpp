@@ -1,5 +1,6 @@
 
 #include <ori/simcars/utils/exceptions.hpp>
+#include <ori/simcars/utils/json_stream_splitter.hpp>
 #include <ori/simcars/structures/stl/stl_stack_array.hpp>
 #include <ori/simcars/structures/stl/stl_dictionary.hpp>
 #include <ori/simcars/structures/stl/stl_set.hpp>
@@ -10,6 +11,18 @@
 #include <rapidjson/istreamwrapper.h>
 
 #include <exception>
+#include <filesystem>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
 
 namespace ori
 {
@@ -30,9 +43,6 @@ void LyftMap::load_virt(std::ifstream &input_filestream)
     lz4_stream::istream input_lz4_stream(input_filestream);
     rapidjson::BasicIStreamWrapper input_lz4_json_stream(input_lz4_stream);
 
-    rapidjson::Document json_document;
-    json_document.ParseStream(input_lz4_json_stream);
-
     id_to_lane_dict = new structures::stl::STLDictionary<std::string, LyftLane*>();
     id_to_traffic_light_dict = new structures::stl::STLDictionary<std::string, LyftTrafficLight*>();
 
@@ -40,6 +50,55 @@ void LyftMap::load_virt(std::ifstream &input_filestream)
 
     map_grid_dict = new geometry::GridDictionary<MapGridRect<std::string>>(geometry::Vec(0, 0), 100);
 
+    // Lanes make up the bulk of the file and are built as they are streamed in, only the comparatively small
+    // traffic light sections are kept around as a document since they reference one another
+    rapidjson::Document json_document;
+    json_document.SetObject();
+    rapidjson::Document::AllocatorType &json_allocator = json_document.GetAllocator();
+    for (char const *section_name : { "id_traffic_light_face_id_traffic_light_dict",
+                                      "id_traffic_light_face_frames_dict",
+                                      "id_traffic_light_face_dict",
+                                      "id_traffic_light_dict" })
+    {
+        json_document.AddMember(rapidjson::Value(rapidjson::StringRef(section_name)).Move(),
+                                rapidjson::Value(rapidjson::kObjectType).Move(), json_allocator);
+    }
+
+    utils::JSONStreamSplitter json_stream_splitter(
+                2,
+                [&](std::vector<std::string> const &element_path, rapidjson::Document &json_element)
+                {
+                    std::string const &section_name = element_path[0];
+                    std::string const &element_id = element_path[1];
+
+                    if (section_name == "id_lane_dict")
+                    {
+                        LyftLane *lane = new LyftLane(element_id, this, json_element.GetObject());
+                        id_to_lane_dict->update(element_id, lane);
+
+                        geometry::Rect const &lane_bounding_box = lane->get_bounding_box();
+                        map_grid_dict->chebyshev_proliferate(
+                            lane_bounding_box.get_origin(),
+                            lane_bounding_box.get_width() / 2.0f,
+                            lane_bounding_box.get_height() / 2.0f);
+                        map_grid_dict->visit_chebyshev_grid_rects_in_range(
+                                    lane_bounding_box.get_origin(),
+                                    lane_bounding_box.get_width() / 2.0f,
+                                    lane_bounding_box.get_height() / 2.0f,
+                                    [lane](MapGridRect<std::string> *map_grid_rect)
+                                    {
+                                        map_grid_rect->insert_lane(lane);
+                                    });
+                    }
+                    else if (json_document.HasMember(section_name.c_str()))
+                    {
+                        json_document[section_name.c_str()].AddMember(
+                                    rapidjson::Value(element_id.c_str(), json_allocator).Move(),
+                                    rapidjson::Value(json_element, json_allocator).Move(), json_allocator);
+                    }
+                });
+    json_stream_splitter.parse(input_lz4_json_stream);
+
     structures::IDictionary<std::string, ITrafficLightStateHolder::IFaceDictionary*> *id_to_face_colour_to_face_type_dict =
                 new structures::stl::STLDictionary<std::string, ITrafficLightStateHolder::IFaceDictionary*>;
     structures::IDictionary<std::string, ITrafficLightStateHolder::TemporalStateDictionary*> *id_to_timestamp_to_state_dict =
@@ -198,32 +257,6 @@ void LyftMap::load_virt(std::ifstream &input_filestream)
         }
     }
 
-    rapidjson::Value::Object lane_id_to_lane_data = json_document["id_lane_dict"].GetObject();
-
-    for (rapidjson::Value::ConstMemberIterator lane_id_to_lane_itr = lane_id_to_lane_data.MemberBegin();
-         lane_id_to_lane_itr != lane_id_to_lane_data.MemberEnd(); ++lane_id_to_lane_itr)
-    {
-        std::string const &lane_id = lane_id_to_lane_itr->name.GetString();
-        LyftLane *lane = new LyftLane(lane_id, this, lane_id_to_lane_itr->value.GetObject());
-        id_to_lane_dict->update(lane_id, lane);
-
-        geometry::Rect const &lane_bounding_box = lane->get_bounding_box();
-        map_grid_dict->chebyshev_proliferate(
-            lane_bounding_box.get_origin(),
-            lane_bounding_box.get_width() / 2.0f,
-            lane_bounding_box.get_height() / 2.0f);
-        structures::IArray<MapGridRect<std::string>*> *map_grid_rects =
-                map_grid_dict->chebyshev_grid_rects_in_range(
-                    lane_bounding_box.get_origin(),
-                    lane_bounding_box.get_width() / 2.0f,
-                    lane_bounding_box.get_height() / 2.0f);
-        for (size_t i = 0; i < map_grid_rects->count(); ++i)
-        {
-            (*map_grid_rects)[i]->insert_lane(lane);
-        }
-        delete map_grid_rects;
-    }
-
     rapidjson::Value::Object traffic_light_id_to_traffic_light_data = json_document["id_traffic_light_dict"].GetObject();
 
     for (rapidjson::Value::ConstMemberIterator traffic_light_id_to_traffic_light_itr = traffic_light_id_to_traffic_light_data.MemberBegin();
@@ -280,6 +313,453 @@ void LyftMap::load_virt(std::ifstream &input_filestream)
     delete id_to_timestamp_to_state_dict;
 }
 
+void LyftMap::load_cache(LyftMapCacheFile const &cache_file)
+{
+    LyftMapCacheHeader const &header = cache_file.get_header();
+
+    id_to_lane_dict = new structures::stl::STLDictionary<std::string, LyftLane*>(
+                cache_file.get_count(LyftMapCacheSection::LANES));
+    id_to_traffic_light_dict = new structures::stl::STLDictionary<std::string, LyftTrafficLight*>(
+                cache_file.get_count(LyftMapCacheSection::TRAFFIC_LIGHTS));
+
+    stray_ghosts = new structures::stl::STLSet<IMapObject<std::string> const*>();
+
+    map_grid_dict = new geometry::GridDictionary<MapGridRect<std::string>>(
+                geometry::Vec(header.grid_origin[0], header.grid_origin[1]), header.grid_spacing);
+
+    size_t i, j;
+
+    LyftMapCacheLaneEntry const *cache_lane_entries =
+            cache_file.get_elements<LyftMapCacheLaneEntry>(LyftMapCacheSection::LANES);
+    std::vector<LyftLane*> lanes(cache_file.get_count(LyftMapCacheSection::LANES));
+    for (i = 0; i < lanes.size(); ++i)
+    {
+        std::string const lane_id = cache_file.get_string(cache_lane_entries[i].id);
+        lanes[i] = new LyftLane(lane_id, this, cache_file, cache_lane_entries[i]);
+        id_to_lane_dict->update(lane_id, lanes[i]);
+    }
+
+    LyftMapCacheTrafficLightEntry const *cache_traffic_light_entries =
+            cache_file.get_elements<LyftMapCacheTrafficLightEntry>(LyftMapCacheSection::TRAFFIC_LIGHTS);
+    std::vector<LyftTrafficLight*> traffic_lights(cache_file.get_count(LyftMapCacheSection::TRAFFIC_LIGHTS));
+    for (i = 0; i < traffic_lights.size(); ++i)
+    {
+        LyftMapCacheTrafficLightEntry const &cache_traffic_light_entry = cache_traffic_light_entries[i];
+
+        ITrafficLightStateHolder::IFaceDictionary *face_colour_to_face_type_dict = nullptr;
+        if (cache_traffic_light_entry.has_faces)
+        {
+            face_colour_to_face_type_dict =
+                    new structures::stl::STLDictionary<ITrafficLightStateHolder::FaceColour, ITrafficLightStateHolder::FaceType>();
+            LyftMapCacheFace const *cache_faces =
+                    cache_file.get_elements<LyftMapCacheFace>(LyftMapCacheSection::FACES, cache_traffic_light_entry.faces);
+            for (j = 0; j < cache_traffic_light_entry.faces.count; ++j)
+            {
+                face_colour_to_face_type_dict->update(ITrafficLightStateHolder::FaceColour(cache_faces[j].face_colour),
+                                                      ITrafficLightStateHolder::FaceType(cache_faces[j].face_type));
+            }
+        }
+
+        ITrafficLightStateHolder::TemporalStateDictionary *timestamp_to_state_dict = nullptr;
+        if (cache_traffic_light_entry.has_states)
+        {
+            timestamp_to_state_dict = new ITrafficLightStateHolder::TemporalStateDictionary(temporal::Duration(50), 10);
+            LyftMapCacheState const *cache_states =
+                    cache_file.get_elements<LyftMapCacheState>(LyftMapCacheSection::STATES, cache_traffic_light_entry.states);
+            for (j = 0; j < cache_traffic_light_entry.states.count; ++j)
+            {
+                timestamp_to_state_dict->update(
+                            temporal::Time(temporal::Duration(cache_states[j].timestamp)),
+                            new ITrafficLightStateHolder::State(ITrafficLightStateHolder::FaceColour(cache_states[j].active_face)));
+            }
+        }
+
+        std::string const traffic_light_id = cache_file.get_string(cache_traffic_light_entry.id);
+        traffic_lights[i] = new LyftTrafficLight(
+                    traffic_light_id, this, face_colour_to_face_type_dict, timestamp_to_state_dict,
+                    geometry::Vec(cache_traffic_light_entry.position.x, cache_traffic_light_entry.position.y),
+                    cache_traffic_light_entry.orientation);
+        id_to_traffic_light_dict->update(traffic_light_id, traffic_lights[i]);
+    }
+
+    LyftMapCacheGridCellEntry const *cache_grid_cell_entries =
+            cache_file.get_elements<LyftMapCacheGridCellEntry>(LyftMapCacheSection::GRID_CELLS);
+    for (i = 0; i < cache_file.get_count(LyftMapCacheSection::GRID_CELLS); ++i)
+    {
+        LyftMapCacheGridCellEntry const &cache_grid_cell_entry = cache_grid_cell_entries[i];
+
+        geometry::Vec const grid_cell_origin(cache_grid_cell_entry.origin.x, cache_grid_cell_entry.origin.y);
+        MapGridRect<std::string> *map_grid_rect = new MapGridRect<std::string>(grid_cell_origin, header.grid_spacing);
+        map_grid_dict->update(grid_cell_origin, map_grid_rect);
+
+        uint64_t const *lane_idxs =
+                cache_file.get_elements<uint64_t>(LyftMapCacheSection::INDICES, cache_grid_cell_entry.lanes);
+        for (j = 0; j < cache_grid_cell_entry.lanes.count; ++j)
+        {
+            if (lane_idxs[j] >= lanes.size())
+            {
+                throw std::runtime_error("Lyft map cache file has an invalid lane index");
+            }
+            map_grid_rect->insert_lane(lanes[lane_idxs[j]]);
+        }
+
+        uint64_t const *traffic_light_idxs =
+                cache_file.get_elements<uint64_t>(LyftMapCacheSection::INDICES, cache_grid_cell_entry.traffic_lights);
+        for (j = 0; j < cache_grid_cell_entry.traffic_lights.count; ++j)
+        {
+            if (traffic_light_idxs[j] >= traffic_lights.size())
+            {
+                throw std::runtime_error("Lyft map cache file has an invalid traffic light index");
+            }
+            map_grid_rect->insert_traffic_light(traffic_lights[traffic_light_idxs[j]]);
+        }
+    }
+}
+
+void LyftMap::save_cache(std::string const &output_file_path_str, uint64_t source_hash, uint64_t source_size,
+                         int64_t source_mtime) const
+{
+    std::vector<LyftMapCacheLaneEntry> cache_lane_entries;
+    std::vector<LyftMapCacheTrafficLightEntry> cache_traffic_light_entries;
+    std::vector<LyftMapCacheGridCellEntry> cache_grid_cell_entries;
+    std::vector<LyftMapCachePoint> cache_points;
+    std::vector<LyftMapCacheTri> cache_tris;
+    std::vector<LyftMapCacheStringRef> cache_string_refs;
+    std::vector<uint64_t> cache_idxs;
+    std::vector<LyftMapCacheFace> cache_faces;
+    std::vector<LyftMapCacheState> cache_states;
+    std::string cache_strings;
+
+    auto add_string =
+            [&](std::string const &str)
+            {
+                LyftMapCacheStringRef string_ref{cache_strings.size(), str.size()};
+                cache_strings += str;
+                return string_ref;
+            };
+    auto add_points =
+            [&](geometry::Vecs const &points)
+            {
+                LyftMapCacheRange range{cache_points.size(), uint64_t(points.cols())};
+                for (Eigen::Index k = 0; k < points.cols(); ++k)
+                {
+                    cache_points.push_back(LyftMapCachePoint{points(0, k), points(1, k)});
+                }
+                return range;
+            };
+    // Lanes the source map references but does not contain resolve to nothing, they are stored with an empty id
+    // which resolves to nothing again when the cache is loaded
+    auto add_lane_ids =
+            [&](ILaneArray<std::string> const *lanes)
+            {
+                LyftMapCacheRange range{cache_string_refs.size(), 0};
+                for (size_t k = 0; lanes != nullptr && k < lanes->count(); ++k)
+                {
+                    cache_string_refs.push_back(add_string((*lanes)[k] != nullptr ? (*lanes)[k]->get_id() : ""));
+                    ++range.count;
+                }
+                return range;
+            };
+
+    size_t i, j;
+
+    structures::IArray<LyftLane*> const *lane_array = id_to_lane_dict->get_values();
+    structures::stl::STLDictionary<ILane<std::string> const*, uint64_t> lane_to_idx_dict(lane_array->count());
+    for (i = 0; i < lane_array->count(); ++i)
+    {
+        LyftLane const *lane = (*lane_array)[i];
+        lane_to_idx_dict.update(lane, i);
+
+        // Cleared so that padding the scalar type leaves in the entry is written deterministically
+        LyftMapCacheLaneEntry cache_lane_entry;
+        std::memset(&cache_lane_entry, 0, sizeof(LyftMapCacheLaneEntry));
+        cache_lane_entry.id = add_string(lane->get_id());
+        cache_lane_entry.left_boundary = add_points(lane->get_left_boundary());
+        cache_lane_entry.right_boundary = add_points(lane->get_right_boundary());
+
+        structures::IArray<geometry::Tri> const *tris = lane->get_tris();
+        cache_lane_entry.tris = LyftMapCacheRange{cache_tris.size(), tris->count()};
+        for (j = 0; j < tris->count(); ++j)
+        {
+            geometry::Tri const &tri = (*tris)[j];
+            cache_tris.push_back(LyftMapCacheTri{{LyftMapCachePoint{tri[0].x(), tri[0].y()},
+                                                  LyftMapCachePoint{tri[1].x(), tri[1].y()},
+                                                  LyftMapCachePoint{tri[2].x(), tri[2].y()}}});
+        }
+
+        cache_lane_entry.centroid = LyftMapCachePoint{lane->get_centroid().x(), lane->get_centroid().y()};
+        geometry::Rect const &bounding_box = lane->get_bounding_box();
+        cache_lane_entry.bounding_box[0] = bounding_box.get_min_x();
+        cache_lane_entry.bounding_box[1] = bounding_box.get_min_y();
+        cache_lane_entry.bounding_box[2] = bounding_box.get_max_x();
+        cache_lane_entry.bounding_box[3] = bounding_box.get_max_y();
+        cache_lane_entry.mean_steer = lane->get_mean_steer();
+        cache_lane_entry.access_restriction = int32_t(lane->get_access_restriction());
+
+        ILane<std::string> const *left_adjacent_lane = lane->get_left_adjacent_lane();
+        cache_lane_entry.left_adjacent_lane_id = add_string(left_adjacent_lane != nullptr ? left_adjacent_lane->get_id() : "");
+        ILane<std::string> const *right_adjacent_lane = lane->get_right_adjacent_lane();
+        cache_lane_entry.right_adjacent_lane_id = add_string(right_adjacent_lane != nullptr ? right_adjacent_lane->get_id() : "");
+
+        cache_lane_entry.fore_lane_ids = add_lane_ids(lane->get_fore_lanes());
+        cache_lane_entry.aft_lane_ids = add_lane_ids(lane->get_aft_lanes());
+
+        ITrafficLightArray<std::string> const *lane_traffic_lights = lane->get_traffic_lights();
+        cache_lane_entry.traffic_light_ids = LyftMapCacheRange{cache_string_refs.size(), 0};
+        for (j = 0; lane_traffic_lights != nullptr && j < lane_traffic_lights->count(); ++j)
+        {
+            ITrafficLight<std::string> const *lane_traffic_light = (*lane_traffic_lights)[j];
+            cache_string_refs.push_back(add_string(lane_traffic_light != nullptr ? lane_traffic_light->get_id() : ""));
+            ++cache_lane_entry.traffic_light_ids.count;
+        }
+
+        cache_lane_entries.push_back(cache_lane_entry);
+    }
+
+    structures::IArray<LyftTrafficLight*> const *traffic_light_array = id_to_traffic_light_dict->get_values();
+    structures::stl::STLDictionary<ITrafficLight<std::string> const*, uint64_t> traffic_light_to_idx_dict(
+                traffic_light_array->count());
+    for (i = 0; i < traffic_light_array->count(); ++i)
+    {
+        LyftTrafficLight const *traffic_light = (*traffic_light_array)[i];
+        traffic_light_to_idx_dict.update(traffic_light, i);
+
+        LyftMapCacheTrafficLightEntry cache_traffic_light_entry;
+        std::memset(&cache_traffic_light_entry, 0, sizeof(LyftMapCacheTrafficLightEntry));
+        cache_traffic_light_entry.id = add_string(traffic_light->get_id());
+        cache_traffic_light_entry.position = LyftMapCachePoint{traffic_light->get_position().x(),
+                                                               traffic_light->get_position().y()};
+        cache_traffic_light_entry.orientation = traffic_light->get_orientation();
+
+        ITrafficLightStateHolder::IFaceDictionary const *face_colour_to_face_type_dict =
+                traffic_light->get_face_colour_to_face_type_dict();
+        cache_traffic_light_entry.has_faces = face_colour_to_face_type_dict != nullptr;
+        cache_traffic_light_entry.faces = LyftMapCacheRange{cache_faces.size(), 0};
+        if (face_colour_to_face_type_dict != nullptr)
+        {
+            structures::IArray<ITrafficLightStateHolder::FaceColour> const *face_colours =
+                    face_colour_to_face_type_dict->get_keys();
+            for (j = 0; j < face_colours->count(); ++j)
+            {
+                ITrafficLightStateHolder::FaceColour const face_colour = (*face_colours)[j];
+                cache_faces.push_back(LyftMapCacheFace{int32_t(face_colour),
+                                                       int32_t((*face_colour_to_face_type_dict)[face_colour])});
+            }
+            cache_traffic_light_entry.faces.count = face_colours->count();
+        }
+
+        ITrafficLightStateHolder::TemporalStateDictionary const *timestamp_to_state_dict =
+                traffic_light->get_timestamp_to_state_dict();
+        cache_traffic_light_entry.has_states = timestamp_to_state_dict != nullptr;
+        cache_traffic_light_entry.states = LyftMapCacheRange{cache_states.size(), 0};
+        if (timestamp_to_state_dict != nullptr)
+        {
+            structures::IArray<temporal::Time> const *timestamps = timestamp_to_state_dict->get_keys();
+            for (j = 0; j < timestamps->count(); ++j)
+            {
+                temporal::Time const timestamp = (*timestamps)[j];
+                cache_states.push_back(LyftMapCacheState{timestamp.time_since_epoch().count(),
+                                                         int32_t((*timestamp_to_state_dict)[timestamp]->active_face), 0});
+            }
+            cache_traffic_light_entry.states.count = timestamps->count();
+        }
+
+        cache_traffic_light_entries.push_back(cache_traffic_light_entry);
+    }
+
+    structures::IArray<geometry::Vec> const *grid_cell_origins = map_grid_dict->get_keys();
+    for (i = 0; i < grid_cell_origins->count(); ++i)
+    {
+        geometry::Vec const &grid_cell_origin = (*grid_cell_origins)[i];
+        MapGridRect<std::string> const *map_grid_rect = (*map_grid_dict)[grid_cell_origin];
+
+        LyftMapCacheGridCellEntry cache_grid_cell_entry;
+        cache_grid_cell_entry.origin = LyftMapCachePoint{grid_cell_origin.x(), grid_cell_origin.y()};
+
+        structures::IArray<ILane<std::string> const*> const *grid_cell_lanes = map_grid_rect->get_lanes()->get_array();
+        cache_grid_cell_entry.lanes = LyftMapCacheRange{cache_idxs.size(), grid_cell_lanes->count()};
+        for (j = 0; j < grid_cell_lanes->count(); ++j)
+        {
+            cache_idxs.push_back(lane_to_idx_dict[(*grid_cell_lanes)[j]]);
+        }
+
+        structures::IArray<ITrafficLight<std::string> const*> const *grid_cell_traffic_lights =
+                map_grid_rect->get_traffic_lights()->get_array();
+        cache_grid_cell_entry.traffic_lights = LyftMapCacheRange{cache_idxs.size(), grid_cell_traffic_lights->count()};
+        for (j = 0; j < grid_cell_traffic_lights->count(); ++j)
+        {
+            cache_idxs.push_back(traffic_light_to_idx_dict[(*grid_cell_traffic_lights)[j]]);
+        }
+
+        cache_grid_cell_entries.push_back(cache_grid_cell_entry);
+    }
+
+    LyftMapCacheHeader header;
+    std::memset(&header, 0, sizeof(LyftMapCacheHeader));
+    std::memcpy(header.magic, LYFT_MAP_CACHE_MAGIC, LYFT_MAP_CACHE_MAGIC_LENGTH);
+    header.version = LYFT_MAP_CACHE_VERSION;
+    header.byte_order_mark = LYFT_MAP_CACHE_BYTE_ORDER_MARK;
+    header.scalar_size = sizeof(FP_DATA_TYPE);
+    header.source_hash = source_hash;
+    header.source_size = source_size;
+    header.source_mtime = source_mtime;
+    header.grid_origin[0] = map_grid_dict->get_origin().x();
+    header.grid_origin[1] = map_grid_dict->get_origin().y();
+    header.grid_spacing = map_grid_dict->get_spacing();
+
+    std::pair<void const*, size_t> const sections[LYFT_MAP_CACHE_SECTION_COUNT] = {
+        { cache_lane_entries.data(), cache_lane_entries.size() },
+        { cache_traffic_light_entries.data(), cache_traffic_light_entries.size() },
+        { cache_grid_cell_entries.data(), cache_grid_cell_entries.size() },
+        { cache_points.data(), cache_points.size() },
+        { cache_tris.data(), cache_tris.size() },
+        { cache_string_refs.data(), cache_string_refs.size() },
+        { cache_idxs.data(), cache_idxs.size() },
+        { cache_faces.data(), cache_faces.size() },
+        { cache_states.data(), cache_states.size() },
+        { cache_strings.data(), cache_strings.size() }
+    };
+    size_t const section_element_sizes[LYFT_MAP_CACHE_SECTION_COUNT] = {
+        sizeof(LyftMapCacheLaneEntry), sizeof(LyftMapCacheTrafficLightEntry), sizeof(LyftMapCacheGridCellEntry),
+        sizeof(LyftMapCachePoint), sizeof(LyftMapCacheTri), sizeof(LyftMapCacheStringRef), sizeof(uint64_t),
+        sizeof(LyftMapCacheFace), sizeof(LyftMapCacheState), sizeof(char)
+    };
+
+    uint64_t offset = sizeof(LyftMapCacheHeader);
+    for (i = 0; i < LYFT_MAP_CACHE_SECTION_COUNT; ++i)
+    {
+        header.sections[i].offset = offset;
+        header.sections[i].count = sections[i].second;
+        offset += sections[i].second * section_element_sizes[i];
+        offset = (offset + LYFT_MAP_CACHE_SECTION_ALIGNMENT - 1) / LYFT_MAP_CACHE_SECTION_ALIGNMENT *
+                LYFT_MAP_CACHE_SECTION_ALIGNMENT;
+    }
+
+    // Written under a temporary name and renamed into place, so that jobs loading the same map concurrently never
+    // see a partially written cache
+    std::string const temporary_file_path_str = output_file_path_str + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream output_filestream(temporary_file_path_str, std::ios_base::binary);
+        if (!output_filestream)
+        {
+            throw std::runtime_error("Could not open Lyft map cache file '" + temporary_file_path_str + "'");
+        }
+
+        char const padding[LYFT_MAP_CACHE_SECTION_ALIGNMENT] = {};
+
+        output_filestream.write(reinterpret_cast<char const*>(&header), sizeof(LyftMapCacheHeader));
+        for (i = 0; i < LYFT_MAP_CACHE_SECTION_COUNT; ++i)
+        {
+            size_t const section_size = sections[i].second * section_element_sizes[i];
+            output_filestream.write(static_cast<char const*>(sections[i].first), section_size);
+            size_t const section_end = header.sections[i].offset + section_size;
+            size_t const next_section_offset = i + 1 < LYFT_MAP_CACHE_SECTION_COUNT ? header.sections[i + 1].offset : offset;
+            output_filestream.write(padding, next_section_offset - section_end);
+        }
+
+        if (!output_filestream)
+        {
+            output_filestream.close();
+            std::filesystem::remove(temporary_file_path_str);
+            throw std::runtime_error("Could not write Lyft map cache file '" + temporary_file_path_str + "'");
+        }
+    }
+    std::filesystem::rename(temporary_file_path_str, output_file_path_str);
+}
+
+LyftMap const* LyftMap::load_cached(std::string const &input_file_path_str, std::string const &cache_file_path_str)
+{
+    std::string const resolved_cache_file_path_str =
+            cache_file_path_str != "" ? cache_file_path_str : input_file_path_str + ".cache";
+
+    std::filesystem::path const input_file_path(input_file_path_str);
+    if (!std::filesystem::is_regular_file(input_file_path))
+    {
+        throw std::invalid_argument("Input file path '" + input_file_path_str + "' does not indicate a valid file");
+    }
+
+    uint64_t source_size = std::filesystem::file_size(input_file_path);
+    int64_t const source_mtime = std::filesystem::last_write_time(input_file_path).time_since_epoch().count();
+
+    // The source is only hashed when its size and modification time alone cannot show the cache is up to date
+    bool source_hashed = false;
+    uint64_t source_hash = 0;
+
+    if (std::filesystem::is_regular_file(std::filesystem::path(resolved_cache_file_path_str)))
+    {
+        try
+        {
+            std::unique_ptr<LyftMap> map;
+            {
+                LyftMapCacheFile cache_file(resolved_cache_file_path_str);
+                LyftMapCacheHeader const &header = cache_file.get_header();
+
+                bool cache_valid = false;
+                if (header.source_size == source_size)
+                {
+                    if (header.source_mtime == source_mtime)
+                    {
+                        cache_valid = true;
+                    }
+                    else
+                    {
+                        // Copying or touching a map changes its modification time without changing its contents
+                        source_hash = LyftMapCacheFile::hash_source_file(input_file_path_str, source_size);
+                        source_hashed = true;
+                        cache_valid = header.source_hash == source_hash && header.source_size == source_size;
+                    }
+                }
+
+                if (cache_valid)
+                {
+                    map.reset(new LyftMap);
+                    map->load_cache(cache_file);
+                }
+            }
+
+            if (map)
+            {
+                if (source_hashed)
+                {
+                    // Records the new modification time, so that the next load need not hash the source again
+                    try
+                    {
+                        map->save_cache(resolved_cache_file_path_str, source_hash, source_size, source_mtime);
+                    }
+                    catch (std::exception const&)
+                    {
+                        // Only costs the next load another hash of the source
+                    }
+                }
+
+                return map.release();
+            }
+        }
+        catch (std::exception const&)
+        {
+            // Unreadable caches are rebuilt below, the same as stale ones
+        }
+    }
+
+    if (!source_hashed)
+    {
+        source_hash = LyftMapCacheFile::hash_source_file(input_file_path_str, source_size);
+    }
+
+    LyftMap const *map = load(input_file_path_str);
+
+    try
+    {
+        map->save_cache(resolved_cache_file_path_str, source_hash, source_size, source_mtime);
+    }
+    catch (std::exception const&)
+    {
+        // Failing to write the cache only costs the next load its speed up
+    }
+
+    return map;
+}
+
 LyftMap::~LyftMap()
 {
     size_t i;
@@ -325,16 +805,38 @@ ILane<std::string> const* LyftMap::get_lane(std::string id) const
 
 ILaneArray<std::string> const* LyftMap::get_encapsulating_lanes(geometry::Vec point) const
 {
-    if (map_grid_dict->contains(point))
+    LivingLaneStackArray<std::string> *lanes = new LivingLaneStackArray<std::string>;
+    get_encapsulating_lanes(point, lanes);
+    return lanes;
+}
+
+void LyftMap::get_encapsulating_lanes(geometry::Vec point,
+                                      structures::IStackArray<ILane<std::string> const*> *lanes) const
+{
+    lanes->clear();
+
+    MapGridRect<std::string> const *map_grid_rect = map_grid_dict->get_grid_rect(point);
+    if (map_grid_rect)
     {
-        MapGridRect<std::string> *map_grid_rect = (*map_grid_dict)[point];
-        if (map_grid_rect)
-        {
-            return map_grid_rect->get_encapsulating_lanes(point);
-        }
+        map_grid_rect->get_encapsulating_lanes(point, lanes);
     }
+}
 
-    return new LivingLaneStackArray<std::string>;
+void LyftMap::get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                            structures::IStackArray<ILane<std::string> const*> *lanes) const
+{
+    lanes->clear();
+    lanes->resize(points.cols());
+
+    visit_encapsulating_lanes(
+                map_grid_dict, points,
+                [lanes](ILane<std::string> const *lane, size_t point_idx)
+                {
+                    if ((*lanes)[point_idx] == nullptr)
+                    {
+                        (*lanes)[point_idx] = lane;
+                    }
+                });
 }
 
 ILaneArray<std::string> const* LyftMap::get_lanes(structures::IArray<std::string> const *ids) const
@@ -353,22 +855,19 @@ ILaneArray<std::string> const* LyftMap::get_lanes(structures::IArray<std::string
 
 ILaneArray<std::string> const* LyftMap::get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const
 {
-    structures::IArray<MapGridRect<std::string>*> *map_grid_rects =
-            map_grid_dict->chebyshev_grid_rects_in_range(point, distance);
-
     structures::stl::STLSet<ILane<std::string> const*> lanes;
 
-    for (size_t i = 0; i < map_grid_rects->count(); ++i)
-    {
-        lanes.union_with((*map_grid_rects)[i]->get_lanes());
-    }
+    map_grid_dict->visit_chebyshev_grid_rects_in_range(
+                point, distance,
+                [&lanes](MapGridRect<std::string> const *map_grid_rect)
+                {
+                    lanes.union_with(map_grid_rect->get_lanes());
+                });
 
     LivingLaneStackArray<std::string> *lane_array = new LivingLaneStackArray<std::string>;
 
     lanes.get_array(lane_array);
 
-    delete map_grid_rects;
-
     return lane_array;
 }
 
@@ -400,22 +899,19 @@ ITrafficLightArray<std::string> const* LyftMap::get_traffic_lights(structures::I
 
 ITrafficLightArray<std::string> const* LyftMap::get_traffic_lights_in_range(geometry::Vec point, FP_DATA_TYPE distance) const
 {
-    structures::IArray<MapGridRect<std::string>*> *map_grid_rects =
-            map_grid_dict->chebyshev_grid_rects_in_range(point, distance);
-
     structures::stl::STLSet<ITrafficLight<std::string> const*> traffic_lights;
 
-    for (size_t i = 0; i < map_grid_rects->count(); ++i)
-    {
-        traffic_lights.union_with((*map_grid_rects)[i]->get_traffic_lights());
-    }
+    map_grid_dict->visit_chebyshev_grid_rects_in_range(
+                point, distance,
+                [&traffic_lights](MapGridRect<std::string> const *map_grid_rect)
+                {
+                    traffic_lights.union_with(map_grid_rect->get_traffic_lights());
+                });
 
     LivingTrafficLightStackArray<std::string> *traffic_light_array = new LivingTrafficLightStackArray<std::string>;
 
     traffic_lights.get_array(traffic_light_array);
 
-    delete map_grid_rects;
-
     return traffic_light_array;
 }
 
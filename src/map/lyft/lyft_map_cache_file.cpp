@@ -0,0 +1,242 @@
+
+#include <ori/simcars/map/lyft/lyft_map_cache_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define FNV_1A_OFFSET_BASIS 0xcbf29ce484222325ull
+#define FNV_1A_PRIME 0x100000001b3ull
+
+namespace ori
+{
+namespace simcars
+{
+namespace map
+{
+namespace lyft
+{
+
+static size_t get_section_element_size(LyftMapCacheSection section)
+{
+    switch (section)
+    {
+    case LyftMapCacheSection::LANES:
+        return sizeof(LyftMapCacheLaneEntry);
+    case LyftMapCacheSection::TRAFFIC_LIGHTS:
+        return sizeof(LyftMapCacheTrafficLightEntry);
+    case LyftMapCacheSection::GRID_CELLS:
+        return sizeof(LyftMapCacheGridCellEntry);
+    case LyftMapCacheSection::POINTS:
+        return sizeof(LyftMapCachePoint);
+    case LyftMapCacheSection::TRIS:
+        return sizeof(LyftMapCacheTri);
+    case LyftMapCacheSection::STRING_REFS:
+        return sizeof(LyftMapCacheStringRef);
+    case LyftMapCacheSection::INDICES:
+        return sizeof(uint64_t);
+    case LyftMapCacheSection::FACES:
+        return sizeof(LyftMapCacheFace);
+    case LyftMapCacheSection::STATES:
+        return sizeof(LyftMapCacheState);
+    default:
+        return sizeof(char);
+    }
+}
+
+static void unmap_file(void *data, size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+LyftMapCacheFile::LyftMapCacheFile(std::string const &input_file_path_str) : data(nullptr), size(0)
+{
+    if (!std::filesystem::is_regular_file(std::filesystem::path(input_file_path_str)))
+    {
+        throw std::invalid_argument("Input file path '" + input_file_path_str + "' does not indicate a valid file");
+    }
+
+#ifdef _WIN32
+    HANDLE const file_handle = CreateFileA(input_file_path_str.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Could not open Lyft map cache file '" + input_file_path_str + "'");
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size) || size_t(file_size.QuadPart) < sizeof(LyftMapCacheHeader))
+    {
+        CloseHandle(file_handle);
+        throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' is truncated");
+    }
+
+    size = file_size.QuadPart;
+    HANDLE const mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+
+    // The view keeps the mapping alive once its handle is closed
+    if (mapping_handle != nullptr)
+    {
+        data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping_handle);
+    }
+
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Could not map Lyft map cache file '" + input_file_path_str + "'");
+    }
+#else
+    int const file_descriptor = open(input_file_path_str.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        throw std::runtime_error("Could not open Lyft map cache file '" + input_file_path_str + "'");
+    }
+
+    struct stat file_stat;
+    if (fstat(file_descriptor, &file_stat) != 0 || size_t(file_stat.st_size) < sizeof(LyftMapCacheHeader))
+    {
+        close(file_descriptor);
+        throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' is truncated");
+    }
+
+    size = file_stat.st_size;
+    void *const mapped_data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+
+    if (mapped_data == MAP_FAILED)
+    {
+        throw std::runtime_error("Could not map Lyft map cache file '" + input_file_path_str + "'");
+    }
+
+    data = mapped_data;
+#endif
+
+    try
+    {
+        LyftMapCacheHeader const &header = get_header();
+
+        if (std::memcmp(header.magic, LYFT_MAP_CACHE_MAGIC, LYFT_MAP_CACHE_MAGIC_LENGTH) != 0)
+        {
+            throw std::runtime_error("File '" + input_file_path_str + "' is not a Lyft map cache file");
+        }
+        if (header.byte_order_mark != LYFT_MAP_CACHE_BYTE_ORDER_MARK)
+        {
+            throw std::runtime_error("Lyft map cache file '" + input_file_path_str +
+                                     "' was written on a machine with a different byte order");
+        }
+        if (header.version != LYFT_MAP_CACHE_VERSION)
+        {
+            throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' has unsupported version " +
+                                     std::to_string(header.version));
+        }
+        if (header.scalar_size != sizeof(FP_DATA_TYPE))
+        {
+            throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' was written with " +
+                                     std::to_string(header.scalar_size * 8) + " bit scalars, but this build uses " +
+                                     std::to_string(sizeof(FP_DATA_TYPE) * 8) + " bit scalars");
+        }
+        if (!(header.grid_spacing > 0))
+        {
+            throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' has an invalid grid spacing");
+        }
+
+        for (size_t i = 0; i < LYFT_MAP_CACHE_SECTION_COUNT; ++i)
+        {
+            LyftMapCacheSectionEntry const &section_entry = header.sections[i];
+            size_t const element_size = get_section_element_size(LyftMapCacheSection(i));
+
+            if (section_entry.offset % LYFT_MAP_CACHE_SECTION_ALIGNMENT != 0 ||
+                    section_entry.offset > size ||
+                    section_entry.count > (size - section_entry.offset) / element_size)
+            {
+                throw std::runtime_error("Lyft map cache file '" + input_file_path_str + "' is truncated");
+            }
+        }
+    }
+    catch (...)
+    {
+        unmap_file(data, size);
+        throw;
+    }
+}
+
+LyftMapCacheFile::~LyftMapCacheFile()
+{
+    unmap_file(data, size);
+}
+
+uint64_t LyftMapCacheFile::hash_source_file(std::string const &input_file_path_str, uint64_t &source_size)
+{
+    std::ifstream input_filestream(input_file_path_str, std::ios_base::binary);
+
+    if (!input_filestream)
+    {
+        throw std::invalid_argument("Input file path '" + input_file_path_str + "' does not indicate a valid file");
+    }
+
+    uint64_t hash = FNV_1A_OFFSET_BASIS;
+    source_size = 0;
+
+    char buffer[1 << 16];
+    while (input_filestream)
+    {
+        input_filestream.read(buffer, sizeof(buffer));
+        std::streamsize const read_count = input_filestream.gcount();
+        for (std::streamsize i = 0; i < read_count; ++i)
+        {
+            hash ^= uint64_t(static_cast<unsigned char>(buffer[i]));
+            hash *= FNV_1A_PRIME;
+        }
+        source_size += read_count;
+    }
+
+    return hash;
+}
+
+LyftMapCacheHeader const& LyftMapCacheFile::get_header() const
+{
+    return *static_cast<LyftMapCacheHeader const*>(data);
+}
+
+size_t LyftMapCacheFile::get_count(LyftMapCacheSection section) const
+{
+    return get_header().sections[size_t(section)].count;
+}
+
+void const* LyftMapCacheFile::get_section(LyftMapCacheSection section) const
+{
+    return static_cast<char const*>(data) + get_header().sections[size_t(section)].offset;
+}
+
+std::string LyftMapCacheFile::get_string(LyftMapCacheStringRef const &string_ref) const
+{
+    size_t const string_pool_size = get_count(LyftMapCacheSection::STRINGS);
+
+    if (string_ref.offset > string_pool_size || string_ref.length > string_pool_size - string_ref.offset)
+    {
+        throw std::runtime_error("Lyft map cache file has an invalid string");
+    }
+
+    return std::string(get_elements<char>(LyftMapCacheSection::STRINGS) + string_ref.offset, string_ref.length);
+}
+
+}
+}
+}
+}
@@ -29,6 +29,13 @@ LyftTrafficLight::LyftTrafficLight(std::string const &id, IMap<std::string> cons
     orientation = M_PI * json_traffic_light_data["bearing_degrees"].GetDouble() / 180.0;
 }
 
+LyftTrafficLight::LyftTrafficLight(std::string const &id, IMap<std::string> const *map,
+                                   ITrafficLightStateHolder::IFaceDictionary *face_colour_to_face_type_dict,
+                                   ITrafficLightStateHolder::TemporalStateDictionary *timestamp_to_state_dict,
+                                   geometry::Vec const &position, FP_DATA_TYPE orientation)
+    : ALivingTrafficLight(id, map), position(position), orientation(orientation),
+      face_colour_to_face_type_dict(face_colour_to_face_type_dict), timestamp_to_state_dict(timestamp_to_state_dict) {}
+
 LyftTrafficLight::~LyftTrafficLight()
 {
     delete face_colour_to_face_type_dict;
@@ -88,6 +95,16 @@ ITrafficLightStateHolder::FaceType LyftTrafficLight::get_face_type(ITrafficLight
     }
 }
 
+ITrafficLightStateHolder::IFaceDictionary const* LyftTrafficLight::get_face_colour_to_face_type_dict() const
+{
+    return face_colour_to_face_type_dict;
+}
+
+ITrafficLightStateHolder::TemporalStateDictionary const* LyftTrafficLight::get_timestamp_to_state_dict() const
+{
+    return timestamp_to_state_dict;
+}
+
 }
 }
 }
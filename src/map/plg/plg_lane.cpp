@@ -109,7 +109,7 @@ PLGLane::PLGLane(uint8_t id, IMap<uint8_t> const *map, geometry::Vecs *vertices)
                             std::max(std::min(
                                          previous_vertex_diff_normalised.dot(
                                              current_vertex_diff_normalised),
-                                         1.0f), -1.0f);
+                                         FP_DATA_TYPE(1)), FP_DATA_TYPE(-1));
                     FP_DATA_TYPE angle_mag = std::acos(vertex_diff_dot_prod);
                     FP_DATA_TYPE angle;
                     if (current_vertex_diff_normalised.dot(
@@ -158,6 +158,8 @@ PLGLane::PLGLane(uint8_t id, IMap<uint8_t> const *map, geometry::Vecs *vertices)
 
     bounding_box = geometry::Rect(min_x, min_y, max_x, max_y);
 
+    left_boundary_arc_lengths = geometry::ArcLengthTable(left_boundary);
+
     tris = new structures::stl::STLStackArray<geometry::Tri>;
     i = 0;
     size_t j = 0;
@@ -177,6 +179,7 @@ PLGLane::PLGLane(uint8_t id, IMap<uint8_t> const *map, geometry::Vecs *vertices)
             ++j;
         }
     }
+    tri_batch = geometry::TriBatch(tris);
 }
 
 PLGLane::~PLGLane()
@@ -194,6 +197,11 @@ geometry::Vecs const& PLGLane::get_right_boundary() const
     return right_boundary;
 }
 
+geometry::ArcLengthTable const& PLGLane::get_left_boundary_arc_lengths() const
+{
+    return left_boundary_arc_lengths;
+}
+
 structures::IArray<geometry::Tri> const* PLGLane::get_tris() const
 {
     return tris;
@@ -201,18 +209,13 @@ structures::IArray<geometry::Tri> const* PLGLane::get_tris() const
 
 bool PLGLane::check_encapsulation(geometry::Vec const &point) const
 {
-    if (bounding_box.check_encapsulation(point))
-    {
-        size_t i;
-        for (i = 0; i < tris->count(); ++i)
-        {
-            if ((*tris)[i].check_encapsulation(point))
-            {
-                return true;
-            }
-        }
-    }
-    return false;
+    return bounding_box.check_encapsulation(point) && tri_batch.check_encapsulation(point);
+}
+
+void PLGLane::check_encapsulation(geometry::Vecs const &points,
+                                  structures::IStackArray<size_t> *encapsulated_point_indices) const
+{
+    tri_batch.check_encapsulation(points, bounding_box, encapsulated_point_indices);
 }
 
 geometry::Vec const& PLGLane::get_centroid() const
@@ -108,6 +108,34 @@ void PLGMap::load_virt(std::ifstream &input_filestream)
 
         delete vertices;
     }
+
+    build_map_grid_dict();
+}
+
+void PLGMap::build_map_grid_dict()
+{
+    map_grid_dict = new geometry::GridDictionary<MapGridRect<uint8_t>>(geometry::Vec(0, 0), PLG_MAP_GRID_SPACING,
+                                                                       id_to_lane_dict->count());
+
+    structures::IArray<PLGLane*> const *lane_array =
+            id_to_lane_dict->get_values();
+    for (size_t i = 0; i < lane_array->count(); ++i)
+    {
+        PLGLane const *lane = (*lane_array)[i];
+        geometry::Rect const &lane_bounding_box = lane->get_bounding_box();
+        map_grid_dict->chebyshev_proliferate(
+                    lane_bounding_box.get_origin(),
+                    lane_bounding_box.get_width() / 2.0f,
+                    lane_bounding_box.get_height() / 2.0f);
+        map_grid_dict->visit_chebyshev_grid_rects_in_range(
+                    lane_bounding_box.get_origin(),
+                    lane_bounding_box.get_width() / 2.0f,
+                    lane_bounding_box.get_height() / 2.0f,
+                    [lane](MapGridRect<uint8_t> *map_grid_rect)
+                    {
+                        map_grid_rect->insert_lane(lane);
+                    });
+    }
 }
 
 PLGMap::~PLGMap()
@@ -129,6 +157,8 @@ PLGMap::~PLGMap()
         delete (*ghost_array)[i];
     }
     delete stray_ghosts;
+
+    delete map_grid_dict;
 }
 
 ILane<uint8_t> const* PLGMap::get_lane(uint8_t id) const
@@ -145,19 +175,51 @@ ILane<uint8_t> const* PLGMap::get_lane(uint8_t id) const
 
 ILaneArray<uint8_t> const* PLGMap::get_encapsulating_lanes(geometry::Vec point) const
 {
-    map::LivingLaneStackArray<uint8_t> *encapsulating_lanes = new map::LivingLaneStackArray<uint8_t>;
+    LivingLaneStackArray<uint8_t> *lanes = new LivingLaneStackArray<uint8_t>;
+    get_encapsulating_lanes(point, lanes);
+    return lanes;
+}
 
-    structures::IArray<PLGLane*> const *lane_array =
-            id_to_lane_dict->get_values();
-    for (size_t i = 0; i < lane_array->count(); ++i)
+void PLGMap::get_encapsulating_lanes(geometry::Vec point, structures::IStackArray<ILane<uint8_t> const*> *lanes) const
+{
+    lanes->clear();
+
+    MapGridRect<uint8_t> const *map_grid_rect = map_grid_dict->get_grid_rect(point);
+    if (map_grid_rect)
+    {
+        map_grid_rect->get_encapsulating_lanes(point, lanes);
+    }
+
+    // Grid cells hold their lanes in pointer hash order, lanes are put in id order so that which of a set of
+    // overlapping lanes comes first does not depend upon where they were allocated
+    size_t i, j;
+    for (i = 1; i < lanes->count(); ++i)
     {
-        if ((*lane_array)[i]->check_encapsulation(point))
+        ILane<uint8_t> const *lane = (*lanes)[i];
+        for (j = i; j > 0 && (*lanes)[j - 1]->get_id() > lane->get_id(); --j)
         {
-            encapsulating_lanes->push_back((*lane_array)[i]);
+            (*lanes)[j] = (*lanes)[j - 1];
         }
+        (*lanes)[j] = lane;
     }
+}
 
-    return encapsulating_lanes;
+void PLGMap::get_first_encapsulating_lanes(geometry::Vecs const &points,
+                                           structures::IStackArray<ILane<uint8_t> const*> *lanes) const
+{
+    lanes->clear();
+    lanes->resize(points.cols());
+
+    // Lanes are put in id order by get_encapsulating_lanes, so the first of them is the one with the smallest id
+    visit_encapsulating_lanes(
+                map_grid_dict, points,
+                [lanes](ILane<uint8_t> const *lane, size_t point_idx)
+                {
+                    if ((*lanes)[point_idx] == nullptr || lane->get_id() < (*lanes)[point_idx]->get_id())
+                    {
+                        (*lanes)[point_idx] = lane;
+                    }
+                });
 }
 
 ILaneArray<uint8_t> const* PLGMap::get_lanes(structures::IArray<uint8_t> const *ids) const
@@ -176,13 +238,20 @@ ILaneArray<uint8_t> const* PLGMap::get_lanes(structures::IArray<uint8_t> const *
 
 ILaneArray<uint8_t> const* PLGMap::get_lanes_in_range(geometry::Vec point, FP_DATA_TYPE distance) const
 {
-    // WARNING: This doesn't actually calculate which lanes are in range, it just returns them all
-    structures::IArray<PLGLane*> const *lane_array =
-            id_to_lane_dict->get_values();
-    ILaneArray<uint8_t> *lanes =
-            new LivingLaneStackArray<uint8_t>(id_to_lane_dict->count());
-    cast_array<PLGLane*, ILane<uint8_t> const*>(*lane_array, *lanes);
-    return lanes;
+    structures::stl::STLSet<ILane<uint8_t> const*> lanes;
+
+    map_grid_dict->visit_chebyshev_grid_rects_in_range(
+                point, distance,
+                [&lanes](MapGridRect<uint8_t> const *map_grid_rect)
+                {
+                    lanes.union_with(map_grid_rect->get_lanes());
+                });
+
+    LivingLaneStackArray<uint8_t> *lane_array = new LivingLaneStackArray<uint8_t>;
+
+    lanes.get_array(lane_array);
+
+    return lane_array;
 }
 
 ITrafficLight<uint8_t> const* PLGMap::get_traffic_light(uint8_t id) const
@@ -230,6 +299,9 @@ PLGMap* PLGMap::shallow_copy() const
 
     map_copy->stray_ghosts = new structures::stl::STLSet<IMapObject<uint8_t> const*>(this->stray_ghosts);
 
+    // Grid rects are owned by their grid, so copies get a grid of their own over the shared lanes
+    map_copy->build_map_grid_dict();
+
     return map_copy;
 }
 
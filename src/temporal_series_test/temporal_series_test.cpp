@@ -0,0 +1,243 @@
+
+#include <ori/simcars/structures/dictionary_interface.hpp>
+#include <ori/simcars/temporal/temporal_rounding_dictionary.hpp>
+#include <ori/simcars/temporal/temporal_series.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#define NUM_TRIALS 1000
+#define NUM_OPERATIONS 200
+#define TIME_STEP_MS 100
+#define TIME_RANGE_MS 5000
+#define NULL_VALUE 0
+#define DEFAULT_SEED 0
+
+using namespace ori::simcars::temporal;
+
+// Checks every lookup that variables make of their series against the same lookups of a
+// TemporalRoundingDictionary, which series replaced, after each of a random sequence of updates,
+// erasures and propagations
+static bool check_equivalence(TemporalRoundingDictionary<size_t> const &dictionary,
+                              TemporalSeries<size_t> const &series)
+{
+    if (dictionary.count() != series.count())
+    {
+        std::cerr << "Count mismatch: " << dictionary.count() << " != " << series.count() << std::endl;
+        return false;
+    }
+
+    if (series.count() == 0)
+    {
+        return true;
+    }
+
+    if (dictionary.get_earliest_timestamp() != series.get_earliest_timestamp() ||
+            dictionary.get_latest_timestamp() != series.get_latest_timestamp())
+    {
+        std::cerr << "Timestamp limit mismatch" << std::endl;
+        return false;
+    }
+
+    Duration time_step(TIME_STEP_MS);
+    for (Time time = dictionary.get_earliest_timestamp() - time_step;
+         time <= dictionary.get_latest_timestamp() + time_step;
+         time += Duration(TIME_STEP_MS / 4))
+    {
+        if (dictionary.contains(time) != series.contains(time) ||
+                dictionary.contains(time, true) != series.contains(time, true))
+        {
+            std::cerr << "Contains mismatch at " << time.time_since_epoch().count() << std::endl;
+            return false;
+        }
+
+        if (time <= dictionary.get_latest_timestamp() && dictionary[time] != series[time])
+        {
+            std::cerr << "Value mismatch at " << time.time_since_epoch().count() << ": " << dictionary[time] << " != " <<
+                         series[time] << std::endl;
+            return false;
+        }
+    }
+
+    // Series enumerate each run, dictionaries each distinct value, in order of first appearance
+    ori::simcars::structures::stl::STLStackArray<size_t> dictionary_values;
+    dictionary.get_values(&dictionary_values);
+    ori::simcars::structures::stl::STLStackArray<size_t> series_values;
+    for (size_t i = 0; i < series.get_run_count(); ++i)
+    {
+        if (!series_values.contains(series.get_run_value(i)))
+        {
+            series_values.push_back(series.get_run_value(i));
+        }
+    }
+    if (dictionary_values.count() != series_values.count())
+    {
+        std::cerr << "Distinct value count mismatch" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < dictionary_values.count(); ++i)
+    {
+        if (dictionary_values[i] != series_values[i])
+        {
+            std::cerr << "Distinct value mismatch" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Dictionaries cannot erase their last slot, so erasing the last slot of a series is checked on its own, slot by slot
+// until the series is empty, every other slot keeping its value and the runs following the remaining values
+static bool check_last_slot_erasure(TemporalSeries<size_t> series)
+{
+    Duration time_step(TIME_STEP_MS);
+
+    std::vector<size_t> values;
+    for (Time time = series.get_earliest_timestamp(); time <= series.get_latest_timestamp(); time += time_step)
+    {
+        values.push_back(series[time]);
+    }
+
+    while (values.size() > 1)
+    {
+        series.erase(series.get_latest_timestamp());
+        values.pop_back();
+
+        if (series.count() != values.size())
+        {
+            std::cerr << "Count mismatch after last slot erasure: " << series.count() << " != " << values.size() <<
+                         std::endl;
+            return false;
+        }
+
+        size_t run_count = 0;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            Time time = series.get_earliest_timestamp() + time_step * DurationRep(i);
+            if (series[time] != values[i])
+            {
+                std::cerr << "Value mismatch after last slot erasure at " << time.time_since_epoch().count() << ": " <<
+                             series[time] << " != " << values[i] << std::endl;
+                return false;
+            }
+            if (i == 0 || values[i] != values[i - 1])
+            {
+                if (run_count >= series.get_run_count() || series.get_run_value(run_count) != values[i] ||
+                        series.get_run_start_time(run_count) != time)
+                {
+                    std::cerr << "Run mismatch after last slot erasure at " << time.time_since_epoch().count() <<
+                                 std::endl;
+                    return false;
+                }
+                ++run_count;
+            }
+        }
+        if (run_count != series.get_run_count())
+        {
+            std::cerr << "Run count mismatch after last slot erasure: " << series.get_run_count() << " != " <<
+                         run_count << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Takes an optional seed, failures are reported along with the seed so that they can be reproduced
+int main(int argc, char *argv[])
+{
+    unsigned long seed = DEFAULT_SEED;
+    if (argc > 1)
+    {
+        seed = std::stoul(argv[1]);
+    }
+
+    std::minstd_rand generator(seed);
+    std::uniform_int_distribution<int> time_distribution(0, TIME_RANGE_MS);
+    std::uniform_int_distribution<int> operation_distribution(0, 9);
+
+    size_t failed_trials = 0;
+
+    for (size_t i = 0; i < NUM_TRIALS; ++i)
+    {
+        TemporalRoundingDictionary<size_t> dictionary(Duration(TIME_STEP_MS), NULL_VALUE);
+        TemporalSeries<size_t> series(Duration(TIME_STEP_MS), NULL_VALUE);
+
+        // As with the event indices variables store, each new value is distinct from every earlier one
+        size_t next_value = NULL_VALUE + 1;
+
+        // Times are kept non-negative, which dictionaries require, but start midway so that updates
+        // before the first are exercised too
+        Time initial_time(Duration(TIME_RANGE_MS / 2));
+        dictionary.update(initial_time, next_value);
+        series.update(initial_time, next_value);
+        ++next_value;
+
+        for (size_t j = 0; j < NUM_OPERATIONS; ++j)
+        {
+            Time time(Duration(time_distribution(generator)));
+            int operation = operation_distribution(generator);
+
+            if (operation < 5)
+            {
+                dictionary.update(time, next_value);
+                series.update(time, next_value);
+                ++next_value;
+            }
+            else if (operation < 7)
+            {
+                // Erasing the last slot of a dictionary is not exercised, as the dictionary loops past
+                // the front of its deque in that case, series are checked erasing their last slots after
+                // each trial instead
+                if (dictionary.count() > 1 && time >= dictionary.get_earliest_timestamp() &&
+                        time < dictionary.get_latest_timestamp())
+                {
+                    dictionary.erase(time);
+                    series.erase(time);
+                }
+            }
+            else if (operation < 8)
+            {
+                dictionary.propogate_values_forward();
+                series.propogate_values_forward();
+            }
+            else
+            {
+                if (dictionary.count() > 0 && time >= dictionary.get_earliest_timestamp())
+                {
+                    dictionary.propogate_values_forward(time);
+                    series.propogate_values_forward(time);
+                }
+            }
+
+            if (dictionary.count() == 0)
+            {
+                dictionary.update(initial_time, next_value);
+                series.update(initial_time, next_value);
+                ++next_value;
+            }
+
+            if (!check_equivalence(dictionary, series))
+            {
+                std::cerr << "Trial " << i << " diverged after operation " << j << " (seed " << seed << ")" <<
+                             std::endl;
+                ++failed_trials;
+                break;
+            }
+
+            if (j == NUM_OPERATIONS - 1 && !check_last_slot_erasure(series))
+            {
+                std::cerr << "Trial " << i << " diverged erasing last slots (seed " << seed << ")" << std::endl;
+                ++failed_trials;
+            }
+        }
+    }
+
+    std::cout << NUM_TRIALS - failed_trials << " of " << NUM_TRIALS << " trials matched (seed " << seed << ")" <<
+                 std::endl;
+
+    return failed_trials == 0 ? 0 : -1;
+}
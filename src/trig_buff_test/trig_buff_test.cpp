@@ -3,11 +3,14 @@
 
 #include <chrono>
 #include <random>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 #define ARRAY_SIZE 1000000
 #define GENERATED_NUM_DEMONINATOR 10e-3
+#define INTERPOLATED_NUM_BINS 4096
+#define ACCURACY_ANGLE_RANGE 100.0f
 
 using namespace ori::simcars::geometry;
 using namespace std::chrono;
@@ -15,12 +18,14 @@ using namespace std::chrono;
 int main()
 {
     TrigBuff const *trig_buff = TrigBuff::init_instance(2000, AngleType::RADIANS);
+    TrigBuff const interpolated_trig_buff(INTERPOLATED_NUM_BINS, AngleType::RADIANS, true);
 
     time_point<high_resolution_clock> start_time;
     microseconds time_elapsed;
 
     FP_DATA_TYPE *input_array = new FP_DATA_TYPE[ARRAY_SIZE];
     FP_DATA_TYPE *output_array = new FP_DATA_TYPE[ARRAY_SIZE];
+    FP_DATA_TYPE *second_output_array = new FP_DATA_TYPE[ARRAY_SIZE];
 
     std::minstd_rand generator(system_clock::now().time_since_epoch().count());
 
@@ -53,6 +58,17 @@ int main()
     std::cout << "Trig Buff Sin: " << time_elapsed.count() << " us" << std::endl;
 
 
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < ARRAY_SIZE; ++i)
+    {
+        output_array[i] = interpolated_trig_buff.get_sin(input_array[i]);
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Interpolated Trig Buff Sin: " << time_elapsed.count() << " us" << std::endl;
+
+
     start_time = high_resolution_clock::now();
 
     for (i = 0; i < ARRAY_SIZE; ++i)
@@ -75,6 +91,37 @@ int main()
     std::cout << "Trig Buff Cos: " << time_elapsed.count() << " us" << std::endl;
 
 
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < ARRAY_SIZE; ++i)
+    {
+        output_array[i] = interpolated_trig_buff.get_cos(input_array[i]);
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Interpolated Trig Buff Cos: " << time_elapsed.count() << " us" << std::endl;
+
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < ARRAY_SIZE; ++i)
+    {
+        output_array[i] = sin(input_array[i]);
+        second_output_array[i] = cos(input_array[i]);
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Normal Sin & Cos: " << time_elapsed.count() << " us" << std::endl;
+
+
+    start_time = high_resolution_clock::now();
+
+    interpolated_trig_buff.get_sin_cos(input_array, output_array, second_output_array, ARRAY_SIZE);
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    std::cout << "Interpolated Trig Buff Batch Sin & Cos: " << time_elapsed.count() << " us" << std::endl;
+
+
     start_time = high_resolution_clock::now();
 
     for (i = 0; i < ARRAY_SIZE; ++i)
@@ -96,8 +143,40 @@ int main()
     time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
     std::cout << "Trig Buff Tan: " << time_elapsed.count() << " us" << std::endl;
 
+
+    // Accuracy is measured over angles of moderate magnitude, as single precision cannot represent the phase of
+    // the large angles used for timing
+    std::uniform_real_distribution<FP_DATA_TYPE> angle_distribution(-ACCURACY_ANGLE_RANGE, ACCURACY_ANGLE_RANGE);
+    for (i = 0; i < ARRAY_SIZE; ++i)
+    {
+        input_array[i] = angle_distribution(generator);
+    }
+
+    FP_DATA_TYPE trig_buff_max_error = 0.0f;
+    FP_DATA_TYPE interpolated_trig_buff_max_error = 0.0f;
+
+    interpolated_trig_buff.get_sin_cos(input_array, output_array, second_output_array, ARRAY_SIZE);
+
+    for (i = 0; i < ARRAY_SIZE; ++i)
+    {
+        FP_DATA_TYPE sin_a = sin(double(input_array[i]));
+        FP_DATA_TYPE cos_a = cos(double(input_array[i]));
+        trig_buff_max_error = std::max(trig_buff_max_error, std::abs(trig_buff->get_sin(input_array[i]) - sin_a));
+        trig_buff_max_error = std::max(trig_buff_max_error, std::abs(trig_buff->get_cos(input_array[i]) - cos_a));
+        interpolated_trig_buff_max_error = std::max(interpolated_trig_buff_max_error,
+                                                    std::abs(output_array[i] - sin_a));
+        interpolated_trig_buff_max_error = std::max(interpolated_trig_buff_max_error,
+                                                    std::abs(second_output_array[i] - cos_a));
+    }
+
+    std::cout << "Trig Buff Max Sin & Cos Error (" << trig_buff->get_num_bins() << " bins): " <<
+                 trig_buff_max_error << std::endl;
+    std::cout << "Interpolated Trig Buff Max Sin & Cos Error (" << interpolated_trig_buff.get_num_bins() <<
+                 " bins): " << interpolated_trig_buff_max_error << std::endl;
+
     delete[] input_array;
     delete[] output_array;
+    delete[] second_output_array;
 
     TrigBuff::destroy_instance();
 }
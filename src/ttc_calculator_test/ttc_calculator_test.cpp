@@ -0,0 +1,207 @@
+
+#include <ori/simcars/structures/stl/stl_stack_array.hpp>
+#include <ori/simcars/geometry/trig_buff.hpp>
+#include <ori/simcars/geometry/o_box.hpp>
+#include <ori/simcars/geometry/sweep_and_prune.hpp>
+#include <ori/simcars/agent/driving_scene_state_buffer.hpp>
+#include <ori/simcars/agent/heuristic_driving_agent_ttc_calculator.hpp>
+#include <ori/simcars/agent/swept_box_driving_agent_ttc_calculator.hpp>
+
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#define AGENT_SPACING 7.0
+#define LANE_COUNT 6
+#define LANE_WIDTH 3.5
+#define BB_LENGTH 4.5f
+#define BB_WIDTH 1.9f
+#define CALC_COUNT 500000
+#define TTC_CANDIDATE_BLOCK_SIZE 16
+
+using namespace ori::simcars;
+using namespace std::chrono;
+
+// Gives the smallest TTC of every agent in the buffer, with candidates swept out along x from each agent and passed to
+// the calculator in blocks, as the simulator's broad phase does
+static void calc_smallest_ttcs(agent::IDrivingAgentTTCCalculator const *ttc_calculator,
+                               agent::DrivingSceneStateBuffer const &state_buffer,
+                               geometry::SweepAndPrune const &sweep_and_prune, FP_DATA_TYPE max_speed,
+                               FP_DATA_TYPE max_half_span, std::vector<temporal::Duration> &smallest_ttcs)
+{
+    structures::stl::STLStackArray<size_t> ttc_candidate_indices;
+
+    // The buffer holds no agent states, only the columns the calculators read
+    size_t i;
+    for (i = 0; i < smallest_ttcs.size(); ++i)
+    {
+        geometry::Vec position_1 = state_buffer.next.get_position(i);
+        geometry::Vec velocity_1 = state_buffer.next.get_linear_velocity(i);
+
+        temporal::Duration smallest_ttc = temporal::Duration::max();
+        ttc_candidate_indices.clear();
+
+        double speed_bound = 1.001 * (double(velocity_1.norm()) + double(max_speed));
+        double contact_distance = 1.01 * (double(state_buffer.bb_half_spans[i]) + double(max_half_span));
+        size_t lower_rank = sweep_and_prune.get_lower_bound_rank(position_1.x());
+        size_t upper_rank = lower_rank;
+        while (lower_rank > 0 || upper_rank < sweep_and_prune.count())
+        {
+            bool lower_flag = upper_rank == sweep_and_prune.count() ||
+                    (lower_rank > 0 &&
+                     position_1.x() - sweep_and_prune.get_x(lower_rank - 1) <
+                     sweep_and_prune.get_x(upper_rank) - position_1.x());
+            size_t rank = lower_flag ? --lower_rank : upper_rank++;
+
+            if (smallest_ttc != temporal::Duration::max() &&
+                    std::abs(double(sweep_and_prune.get_x(rank)) - double(position_1.x())) - contact_distance >=
+                    double(smallest_ttc.count() + 1) * speed_bound)
+            {
+                break;
+            }
+
+            ttc_candidate_indices.push_back(sweep_and_prune.get_index(rank));
+
+            if (ttc_candidate_indices.count() == TTC_CANDIDATE_BLOCK_SIZE)
+            {
+                smallest_ttc = ttc_calculator->calc_smallest_buffered_ttc(
+                            &state_buffer, i, &ttc_candidate_indices, smallest_ttc);
+                ttc_candidate_indices.clear();
+            }
+        }
+        if (ttc_candidate_indices.count() > 0)
+        {
+            smallest_ttc = ttc_calculator->calc_smallest_buffered_ttc(
+                        &state_buffer, i, &ttc_candidate_indices, smallest_ttc);
+        }
+        smallest_ttcs[i] = smallest_ttc;
+    }
+}
+
+static void print_ttc_summary(std::string const &label, microseconds time_elapsed, size_t calc_count,
+                              std::vector<temporal::Duration> const &smallest_ttcs)
+{
+    size_t collision_count = 0;
+    double ttc_sum = 0.0;
+    for (temporal::Duration const &smallest_ttc : smallest_ttcs)
+    {
+        if (smallest_ttc != temporal::Duration::max())
+        {
+            ++collision_count;
+            ttc_sum += double(smallest_ttc.count());
+        }
+    }
+
+    std::cout << label << ": " << time_elapsed.count() << " us (" <<
+                 1000.0 * double(time_elapsed.count()) / double(calc_count) << " ns per agent, " << collision_count <<
+                 " of " << smallest_ttcs.size() << " agents with a TTC, mean TTC " <<
+                 (collision_count > 0 ? ttc_sum / double(collision_count) : 0.0) << " ms)" << std::endl;
+}
+
+// Agents are spread along the lanes of a highway, the first half of the lanes heading in the opposite direction
+// to the second half, with velocities in metres per millisecond as in simulation
+int main(int argc, char *argv[])
+{
+    size_t agent_count = 300;
+    if (argc > 1)
+    {
+        agent_count = std::stoull(argv[1]);
+    }
+
+    geometry::TrigBuff const *trig_buff = geometry::TrigBuff::init_instance(360000, geometry::AngleType::RADIANS);
+
+    agent::HeuristicDrivingAgentTTCCalculator const heuristic_ttc_calculator;
+    agent::SweptBoxDrivingAgentTTCCalculator const swept_box_ttc_calculator;
+
+    time_point<high_resolution_clock> start_time;
+    microseconds time_elapsed;
+
+    std::minstd_rand generator(0);
+    std::uniform_real_distribution<double> position_distribution(0.0, agent_count * AGENT_SPACING);
+    std::uniform_real_distribution<double> lateral_offset_distribution(-0.3, 0.3);
+    std::uniform_real_distribution<double> heading_offset_distribution(-0.05, 0.05);
+    std::uniform_real_distribution<double> speed_distribution(0.02, 0.035);
+
+    agent::DrivingSceneStateBuffer state_buffer;
+    state_buffer.next.resize(agent_count);
+    state_buffer.bb_lengths.resize(agent_count);
+    state_buffer.bb_widths.resize(agent_count);
+    state_buffer.bb_half_spans.resize(agent_count);
+    state_buffer.bounding_boxes.resize(agent_count);
+
+    geometry::SweepAndPrune sweep_and_prune;
+    sweep_and_prune.reset(agent_count);
+
+    FP_DATA_TYPE max_speed = 0.0f;
+    FP_DATA_TYPE max_half_span = 0.0f;
+
+    size_t i;
+    for (i = 0; i < agent_count; ++i)
+    {
+        size_t lane = i % LANE_COUNT;
+        bool reversed = lane < LANE_COUNT / 2;
+        FP_DATA_TYPE rotation = heading_offset_distribution(generator) + (reversed ? M_PI : 0.0);
+        geometry::Vec position(position_distribution(generator),
+                               lane * LANE_WIDTH + lateral_offset_distribution(generator));
+        geometry::Vec linear_velocity = FP_DATA_TYPE(speed_distribution(generator)) *
+                geometry::Vec(trig_buff->get_cos(rotation), trig_buff->get_sin(rotation));
+
+        state_buffer.next.set_position(i, position);
+        state_buffer.next.set_linear_velocity(i, linear_velocity);
+        state_buffer.next.rotations[i] = rotation;
+        state_buffer.bb_lengths[i] = BB_LENGTH;
+        state_buffer.bb_widths[i] = BB_WIDTH;
+        state_buffer.bb_half_spans[i] = 0.5f * std::sqrt(BB_LENGTH * BB_LENGTH + BB_WIDTH * BB_WIDTH);
+        state_buffer.bounding_boxes[i] = geometry::OBox::create(position, BB_LENGTH, BB_WIDTH, rotation, trig_buff);
+
+        sweep_and_prune.set_position(i, position);
+
+        max_speed = std::max(max_speed, linear_velocity.norm());
+        max_half_span = std::max(max_half_span, state_buffer.bb_half_spans[i]);
+    }
+    sweep_and_prune.sort();
+
+    size_t const repeat_count = std::max(size_t(1), CALC_COUNT / agent_count);
+    size_t const calc_count = repeat_count * agent_count;
+
+    std::vector<temporal::Duration> heuristic_smallest_ttcs(agent_count);
+    std::vector<temporal::Duration> swept_box_smallest_ttcs(agent_count);
+
+    std::cout << "Agent Count: " << agent_count << std::endl;
+
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < repeat_count; ++i)
+    {
+        calc_smallest_ttcs(&heuristic_ttc_calculator, state_buffer, sweep_and_prune, max_speed, max_half_span,
+                           heuristic_smallest_ttcs);
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    print_ttc_summary("Heuristic TTC", time_elapsed, calc_count, heuristic_smallest_ttcs);
+
+
+    start_time = high_resolution_clock::now();
+
+    for (i = 0; i < repeat_count; ++i)
+    {
+        calc_smallest_ttcs(&swept_box_ttc_calculator, state_buffer, sweep_and_prune, max_speed, max_half_span,
+                           swept_box_smallest_ttcs);
+    }
+
+    time_elapsed = duration_cast<microseconds>(high_resolution_clock::now() - start_time);
+    print_ttc_summary("Swept Box TTC", time_elapsed, calc_count, swept_box_smallest_ttcs);
+
+
+    size_t agreement_count = 0;
+    for (i = 0; i < agent_count; ++i)
+    {
+        agreement_count += heuristic_smallest_ttcs[i] == swept_box_smallest_ttcs[i];
+    }
+    std::cout << "Agents With Matching TTCs: " << agreement_count << " of " << agent_count << std::endl;
+
+    geometry::TrigBuff::destroy_instance();
+}
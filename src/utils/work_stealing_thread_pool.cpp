@@ -0,0 +1,221 @@
+
+#include <ori/simcars/utils/work_stealing_thread_pool.hpp>
+
+#include <algorithm>
+
+namespace ori
+{
+namespace simcars
+{
+namespace utils
+{
+
+static thread_local WorkStealingThreadPool const *current_thread_pool = nullptr;
+static thread_local size_t current_worker_idx = 0;
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t thread_count)
+    : thread_count(thread_count), queued_task_count(0), unfinished_task_count(0), next_worker_idx(0),
+      idle_worker_count(0), stopping(false)
+{
+    if (this->thread_count == 0)
+    {
+        this->thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    worker_queues = new WorkerQueue[this->thread_count];
+
+    size_t i;
+    for (i = 0; i < this->thread_count; ++i)
+    {
+        worker_threads.push_back(std::thread(&WorkStealingThreadPool::run_worker, this, i));
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> idle_lock(idle_mutex);
+        stopping = true;
+    }
+    task_available_condition.notify_all();
+
+    size_t i;
+    for (i = 0; i < thread_count; ++i)
+    {
+        worker_threads[i].join();
+    }
+
+    delete[] worker_queues;
+}
+
+bool WorkStealingThreadPool::try_pop_task(size_t worker_idx, std::function<void()> &task)
+{
+    {
+        WorkerQueue &worker_queue = worker_queues[worker_idx];
+        std::lock_guard<std::mutex> queue_lock(worker_queue.mutex);
+        if (!worker_queue.tasks.empty())
+        {
+            task = std::move(worker_queue.tasks.back());
+            worker_queue.tasks.pop_back();
+            --queued_task_count;
+            return true;
+        }
+    }
+
+    size_t i;
+    for (i = 1; i < thread_count; ++i)
+    {
+        WorkerQueue &victim_queue = worker_queues[(worker_idx + i) % thread_count];
+        std::lock_guard<std::mutex> queue_lock(victim_queue.mutex);
+        if (!victim_queue.tasks.empty())
+        {
+            task = std::move(victim_queue.tasks.front());
+            victim_queue.tasks.pop_front();
+            --queued_task_count;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkStealingThreadPool::run_worker(size_t worker_idx)
+{
+    current_thread_pool = this;
+    current_worker_idx = worker_idx;
+
+    std::function<void()> task;
+
+    while (true)
+    {
+        if (!try_pop_task(worker_idx, task))
+        {
+            // Submitters only take the idle lock when they see a worker counted as idle, and a worker only
+            // counts itself as idle before checking for queued tasks, so one of the two always sees the other
+            std::unique_lock<std::mutex> idle_lock(idle_mutex);
+            ++idle_worker_count;
+            task_available_condition.wait(idle_lock, [this]()
+            {
+                return stopping || queued_task_count > 0;
+            });
+            --idle_worker_count;
+            if (stopping && queued_task_count == 0)
+            {
+                return;
+            }
+
+            // A task pushed to a queue already passed over is picked up on the next pass
+            continue;
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // Anything captured by the task is released before the task is reported as finished
+        task = nullptr;
+
+        if (exception)
+        {
+            std::lock_guard<std::mutex> state_lock(state_mutex);
+            if (!task_exception)
+            {
+                task_exception = exception;
+            }
+            exception = nullptr;
+        }
+
+        if (--unfinished_task_count == 0)
+        {
+            // Taken so that a waiter cannot miss the notification between checking the count and waiting
+            std::lock_guard<std::mutex> state_lock(state_mutex);
+            tasks_finished_condition.notify_all();
+        }
+    }
+}
+
+size_t WorkStealingThreadPool::get_thread_count() const
+{
+    return thread_count;
+}
+
+bool WorkStealingThreadPool::get_current_worker_idx(size_t &worker_idx) const
+{
+    if (current_thread_pool == this)
+    {
+        worker_idx = current_worker_idx;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void WorkStealingThreadPool::submit(std::function<void()> const &task)
+{
+    ++unfinished_task_count;
+
+    size_t worker_idx;
+    if (current_thread_pool == this)
+    {
+        worker_idx = current_worker_idx;
+    }
+    else
+    {
+        worker_idx = next_worker_idx++ % thread_count;
+    }
+
+    try
+    {
+        WorkerQueue &worker_queue = worker_queues[worker_idx];
+        std::lock_guard<std::mutex> queue_lock(worker_queue.mutex);
+        worker_queue.tasks.push_back(task);
+        ++queued_task_count;
+    }
+    catch (...)
+    {
+        // The task was never queued, so it must not hold up anyone waiting on the pool
+        if (--unfinished_task_count == 0)
+        {
+            std::lock_guard<std::mutex> state_lock(state_mutex);
+            tasks_finished_condition.notify_all();
+        }
+        throw;
+    }
+
+    if (idle_worker_count > 0)
+    {
+        // Taken so that a worker cannot miss the notification between checking for tasks and sleeping
+        {
+            std::lock_guard<std::mutex> idle_lock(idle_mutex);
+        }
+        task_available_condition.notify_one();
+    }
+}
+
+void WorkStealingThreadPool::wait()
+{
+    std::unique_lock<std::mutex> state_lock(state_mutex);
+    tasks_finished_condition.wait(state_lock, [this]()
+    {
+        return unfinished_task_count == 0;
+    });
+
+    if (task_exception)
+    {
+        std::exception_ptr exception = task_exception;
+        task_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+}
+}
+}
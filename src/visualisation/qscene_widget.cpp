@@ -196,7 +196,8 @@ void QSceneWidget::add_scene_to_render_stack()
                      focal_entities->contains(entity->get_name())))
             {
                 agent::IValuelessVariable const *position_valueless_variable =
-                        entity->get_variable_parameter(entity->get_name() + ".position.base");
+                        entity->get_variable_parameter(
+                            agent::ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position);
 
                 if (position_valueless_variable == nullptr)
                 {
@@ -229,6 +230,44 @@ void QSceneWidget::add_scene_to_render_stack()
     }
 }
 
+void QSceneWidget::get_vehicle_positions(geometry::Vecs &positions) const
+{
+    structures::IArray<agent::IEntity const*> *entities = scene->get_entities();
+
+    positions.resize(2, entities->count());
+    size_t vehicle_count = 0;
+
+    size_t i;
+    for (i = 0; i < entities->count(); ++i)
+    {
+        agent::IEntity const *entity = (*entities)[i];
+        if (entity->get_name().find("vehicle") != std::string::npos)
+        {
+            agent::IValuelessVariable const *position_valueless_variable =
+                    entity->get_variable_parameter(
+                        agent::ParameterRegistry::get_instance()->get_driving_agent_parameter_handles().position);
+
+            if (position_valueless_variable == nullptr)
+            {
+                continue;
+            }
+
+            agent::IVariable<geometry::Vec> const *position_variable =
+                    dynamic_cast<agent::IVariable<geometry::Vec> const*>(position_valueless_variable);
+
+            geometry::Vec position;
+            if (position_variable->get_value(this->get_time(), position))
+            {
+                positions.col(vehicle_count++) = position;
+            }
+        }
+    }
+
+    delete entities;
+
+    positions.conservativeResize(2, vehicle_count);
+}
+
 void QSceneWidget::populate_render_stack()
 {
     add_scene_to_render_stack();